@@ -0,0 +1,141 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/code/basicfp.c"
+  "/root/repo/code/basicfp.h"
+  "/root/repo/code/batch.c"
+  "/root/repo/code/batch.h"
+  "/root/repo/code/breakpoints.c"
+  "/root/repo/code/breakpoints.h"
+  "/root/repo/code/codemap.c"
+  "/root/repo/code/codemap.h"
+  "/root/repo/code/cpu.c"
+  "/root/repo/code/cpu.h"
+  "/root/repo/code/explore.c"
+  "/root/repo/code/explore.h"
+  "/root/repo/code/gdbstub.c"
+  "/root/repo/code/gdbstub.h"
+  "/root/repo/code/heatmap.c"
+  "/root/repo/code/heatmap.h"
+  "/root/repo/code/hle.c"
+  "/root/repo/code/hle.h"
+  "/root/repo/code/hostcall.c"
+  "/root/repo/code/hostcall.h"
+  "/root/repo/code/jobserver.c"
+  "/root/repo/code/jobserver.h"
+  "/root/repo/code/libace64.c"
+  "/root/repo/code/libace64.h"
+  "/root/repo/code/loops.c"
+  "/root/repo/code/loops.h"
+  "/root/repo/code/memo.c"
+  "/root/repo/code/memo.h"
+  "/root/repo/code/opcodes.c"
+  "/root/repo/code/opcodes.h"
+  "/root/repo/code/opinfo.c"
+  "/root/repo/code/opinfo.h"
+  "/root/repo/code/profile.c"
+  "/root/repo/code/profile.h"
+  "/root/repo/code/resultcache.c"
+  "/root/repo/code/resultcache.h"
+  "/root/repo/code/run.c"
+  "/root/repo/code/run.h"
+  "/root/repo/code/statehash.c"
+  "/root/repo/code/statehash.h"
+  "/root/repo/code/trace.c"
+  "/root/repo/code/trace.h"
+  "/root/repo/code/trace_ring.h"
+  "/root/repo/code/writers.c"
+  "/root/repo/code/writers.h"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/src/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/cmake/gmock.pc.in"
+  "/usr/src/googletest/googlemock/cmake/gmock_main.pc.in"
+  "/usr/src/googletest/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googletest/cmake/Config.cmake.in"
+  "/usr/src/googletest/googletest/cmake/gtest.pc.in"
+  "/usr/src/googletest/googletest/cmake/gtest_main.pc.in"
+  "/usr/src/googletest/googletest/cmake/internal_utils.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/googletest/generated/gmock.pc"
+  "_deps/googletest-build/googletest/generated/gmock_main.pc"
+  "_deps/googletest-build/googlemock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/googletest/generated/GTestConfigVersion.cmake"
+  "_deps/googletest-build/googletest/generated/GTestConfig.cmake"
+  "_deps/googletest-build/googletest/generated/gtest.pc"
+  "_deps/googletest-build/googletest/generated/gtest_main.pc"
+  "_deps/googletest-build/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/ace64_core.dir/DependInfo.cmake"
+  "CMakeFiles/ace64_test.dir/DependInfo.cmake"
+  "CMakeFiles/ace64_taint_core.dir/DependInfo.cmake"
+  "CMakeFiles/ace64_taint_test.dir/DependInfo.cmake"
+  "CMakeFiles/ace64_shared.dir/DependInfo.cmake"
+  "CMakeFiles/ace64_functional.dir/DependInfo.cmake"
+  "CMakeFiles/ace64.dir/DependInfo.cmake"
+  "CMakeFiles/ace64d.dir/DependInfo.cmake"
+  "CMakeFiles/ace64-trace.dir/DependInfo.cmake"
+  "CMakeFiles/ace64-gdb.dir/DependInfo.cmake"
+  "CMakeFiles/ace64_bench.dir/DependInfo.cmake"
+  "CMakeFiles/ace64_workloads.dir/DependInfo.cmake"
+  "_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "_deps/googletest-build/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
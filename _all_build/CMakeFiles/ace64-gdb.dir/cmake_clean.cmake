@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ace64-gdb.dir/code/ace64_gdb.c.o"
+  "CMakeFiles/ace64-gdb.dir/code/ace64_gdb.c.o.d"
+  "ace64-gdb"
+  "ace64-gdb.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ace64-gdb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ace64-trace.dir/code/ace64_trace.c.o"
+  "CMakeFiles/ace64-trace.dir/code/ace64_trace.c.o.d"
+  "ace64-trace"
+  "ace64-trace.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ace64-trace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ace64.dir/code/ace64.c.o"
+  "CMakeFiles/ace64.dir/code/ace64.c.o.d"
+  "ace64"
+  "ace64.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ace64.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ace64_bench.dir/bench/ace64_bench.c.o"
+  "CMakeFiles/ace64_bench.dir/bench/ace64_bench.c.o.d"
+  "ace64_bench"
+  "ace64_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ace64_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ace64_core.dir/code/basicfp.c.o"
+  "CMakeFiles/ace64_core.dir/code/basicfp.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/batch.c.o"
+  "CMakeFiles/ace64_core.dir/code/batch.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/breakpoints.c.o"
+  "CMakeFiles/ace64_core.dir/code/breakpoints.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/codemap.c.o"
+  "CMakeFiles/ace64_core.dir/code/codemap.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/cpu.c.o"
+  "CMakeFiles/ace64_core.dir/code/cpu.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/explore.c.o"
+  "CMakeFiles/ace64_core.dir/code/explore.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/gdbstub.c.o"
+  "CMakeFiles/ace64_core.dir/code/gdbstub.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/heatmap.c.o"
+  "CMakeFiles/ace64_core.dir/code/heatmap.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/hle.c.o"
+  "CMakeFiles/ace64_core.dir/code/hle.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/hostcall.c.o"
+  "CMakeFiles/ace64_core.dir/code/hostcall.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/jobserver.c.o"
+  "CMakeFiles/ace64_core.dir/code/jobserver.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/libace64.c.o"
+  "CMakeFiles/ace64_core.dir/code/libace64.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/loops.c.o"
+  "CMakeFiles/ace64_core.dir/code/loops.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/memo.c.o"
+  "CMakeFiles/ace64_core.dir/code/memo.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/opcodes.c.o"
+  "CMakeFiles/ace64_core.dir/code/opcodes.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/opinfo.c.o"
+  "CMakeFiles/ace64_core.dir/code/opinfo.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/profile.c.o"
+  "CMakeFiles/ace64_core.dir/code/profile.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/resultcache.c.o"
+  "CMakeFiles/ace64_core.dir/code/resultcache.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/run.c.o"
+  "CMakeFiles/ace64_core.dir/code/run.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/statehash.c.o"
+  "CMakeFiles/ace64_core.dir/code/statehash.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/trace.c.o"
+  "CMakeFiles/ace64_core.dir/code/trace.c.o.d"
+  "CMakeFiles/ace64_core.dir/code/writers.c.o"
+  "CMakeFiles/ace64_core.dir/code/writers.c.o.d"
+  "libace64_core.a"
+  "libace64_core.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ace64_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
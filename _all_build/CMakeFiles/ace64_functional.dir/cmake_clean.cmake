@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ace64_functional.dir/code/functional.c.o"
+  "CMakeFiles/ace64_functional.dir/code/functional.c.o.d"
+  "ace64_functional"
+  "ace64_functional.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ace64_functional.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
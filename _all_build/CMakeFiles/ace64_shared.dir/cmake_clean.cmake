@@ -0,0 +1,55 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ace64_shared.dir/code/basicfp.c.o"
+  "CMakeFiles/ace64_shared.dir/code/basicfp.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/batch.c.o"
+  "CMakeFiles/ace64_shared.dir/code/batch.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/breakpoints.c.o"
+  "CMakeFiles/ace64_shared.dir/code/breakpoints.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/codemap.c.o"
+  "CMakeFiles/ace64_shared.dir/code/codemap.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/cpu.c.o"
+  "CMakeFiles/ace64_shared.dir/code/cpu.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/explore.c.o"
+  "CMakeFiles/ace64_shared.dir/code/explore.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/gdbstub.c.o"
+  "CMakeFiles/ace64_shared.dir/code/gdbstub.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/heatmap.c.o"
+  "CMakeFiles/ace64_shared.dir/code/heatmap.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/hle.c.o"
+  "CMakeFiles/ace64_shared.dir/code/hle.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/hostcall.c.o"
+  "CMakeFiles/ace64_shared.dir/code/hostcall.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/jobserver.c.o"
+  "CMakeFiles/ace64_shared.dir/code/jobserver.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/libace64.c.o"
+  "CMakeFiles/ace64_shared.dir/code/libace64.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/loops.c.o"
+  "CMakeFiles/ace64_shared.dir/code/loops.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/memo.c.o"
+  "CMakeFiles/ace64_shared.dir/code/memo.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/opcodes.c.o"
+  "CMakeFiles/ace64_shared.dir/code/opcodes.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/opinfo.c.o"
+  "CMakeFiles/ace64_shared.dir/code/opinfo.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/profile.c.o"
+  "CMakeFiles/ace64_shared.dir/code/profile.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/resultcache.c.o"
+  "CMakeFiles/ace64_shared.dir/code/resultcache.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/run.c.o"
+  "CMakeFiles/ace64_shared.dir/code/run.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/statehash.c.o"
+  "CMakeFiles/ace64_shared.dir/code/statehash.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/trace.c.o"
+  "CMakeFiles/ace64_shared.dir/code/trace.c.o.d"
+  "CMakeFiles/ace64_shared.dir/code/writers.c.o"
+  "CMakeFiles/ace64_shared.dir/code/writers.c.o.d"
+  "libace64.pdb"
+  "libace64.so"
+  "libace64.so.1"
+  "libace64.so.1.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ace64_shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
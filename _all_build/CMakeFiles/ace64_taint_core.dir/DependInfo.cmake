@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/code/basicfp.c" "CMakeFiles/ace64_taint_core.dir/code/basicfp.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/basicfp.c.o.d"
+  "/root/repo/code/batch.c" "CMakeFiles/ace64_taint_core.dir/code/batch.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/batch.c.o.d"
+  "/root/repo/code/breakpoints.c" "CMakeFiles/ace64_taint_core.dir/code/breakpoints.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/breakpoints.c.o.d"
+  "/root/repo/code/codemap.c" "CMakeFiles/ace64_taint_core.dir/code/codemap.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/codemap.c.o.d"
+  "/root/repo/code/cpu.c" "CMakeFiles/ace64_taint_core.dir/code/cpu.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/cpu.c.o.d"
+  "/root/repo/code/explore.c" "CMakeFiles/ace64_taint_core.dir/code/explore.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/explore.c.o.d"
+  "/root/repo/code/gdbstub.c" "CMakeFiles/ace64_taint_core.dir/code/gdbstub.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/gdbstub.c.o.d"
+  "/root/repo/code/heatmap.c" "CMakeFiles/ace64_taint_core.dir/code/heatmap.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/heatmap.c.o.d"
+  "/root/repo/code/hle.c" "CMakeFiles/ace64_taint_core.dir/code/hle.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/hle.c.o.d"
+  "/root/repo/code/hostcall.c" "CMakeFiles/ace64_taint_core.dir/code/hostcall.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/hostcall.c.o.d"
+  "/root/repo/code/jobserver.c" "CMakeFiles/ace64_taint_core.dir/code/jobserver.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/jobserver.c.o.d"
+  "/root/repo/code/libace64.c" "CMakeFiles/ace64_taint_core.dir/code/libace64.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/libace64.c.o.d"
+  "/root/repo/code/loops.c" "CMakeFiles/ace64_taint_core.dir/code/loops.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/loops.c.o.d"
+  "/root/repo/code/memo.c" "CMakeFiles/ace64_taint_core.dir/code/memo.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/memo.c.o.d"
+  "/root/repo/code/opcodes.c" "CMakeFiles/ace64_taint_core.dir/code/opcodes.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/opcodes.c.o.d"
+  "/root/repo/code/opinfo.c" "CMakeFiles/ace64_taint_core.dir/code/opinfo.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/opinfo.c.o.d"
+  "/root/repo/code/profile.c" "CMakeFiles/ace64_taint_core.dir/code/profile.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/profile.c.o.d"
+  "/root/repo/code/resultcache.c" "CMakeFiles/ace64_taint_core.dir/code/resultcache.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/resultcache.c.o.d"
+  "/root/repo/code/run.c" "CMakeFiles/ace64_taint_core.dir/code/run.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/run.c.o.d"
+  "/root/repo/code/statehash.c" "CMakeFiles/ace64_taint_core.dir/code/statehash.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/statehash.c.o.d"
+  "/root/repo/code/taint.c" "CMakeFiles/ace64_taint_core.dir/code/taint.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/taint.c.o.d"
+  "/root/repo/code/trace.c" "CMakeFiles/ace64_taint_core.dir/code/trace.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/trace.c.o.d"
+  "/root/repo/code/writers.c" "CMakeFiles/ace64_taint_core.dir/code/writers.c.o" "gcc" "CMakeFiles/ace64_taint_core.dir/code/writers.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libace64_taint_core.a"
+)
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ace64_taint_test.dir/test/ace64_test.cpp.o"
+  "CMakeFiles/ace64_taint_test.dir/test/ace64_test.cpp.o.d"
+  "CMakeFiles/ace64_taint_test.dir/test/taint_test.cpp.o"
+  "CMakeFiles/ace64_taint_test.dir/test/taint_test.cpp.o.d"
+  "ace64_taint_test"
+  "ace64_taint_test.pdb"
+  "ace64_taint_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ace64_taint_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
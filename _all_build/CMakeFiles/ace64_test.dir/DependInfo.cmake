@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ace64_test.cpp" "CMakeFiles/ace64_test.dir/test/ace64_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/ace64_test.cpp.o.d"
+  "/root/repo/test/alu_reference_test.cpp" "CMakeFiles/ace64_test.dir/test/alu_reference_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/alu_reference_test.cpp.o.d"
+  "/root/repo/test/basicfp_test.cpp" "CMakeFiles/ace64_test.dir/test/basicfp_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/basicfp_test.cpp.o.d"
+  "/root/repo/test/batch_test.cpp" "CMakeFiles/ace64_test.dir/test/batch_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/batch_test.cpp.o.d"
+  "/root/repo/test/breakpoints_test.cpp" "CMakeFiles/ace64_test.dir/test/breakpoints_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/breakpoints_test.cpp.o.d"
+  "/root/repo/test/codemap_test.cpp" "CMakeFiles/ace64_test.dir/test/codemap_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/codemap_test.cpp.o.d"
+  "/root/repo/test/explore_test.cpp" "CMakeFiles/ace64_test.dir/test/explore_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/explore_test.cpp.o.d"
+  "/root/repo/test/gdbstub_test.cpp" "CMakeFiles/ace64_test.dir/test/gdbstub_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/gdbstub_test.cpp.o.d"
+  "/root/repo/test/heatmap_test.cpp" "CMakeFiles/ace64_test.dir/test/heatmap_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/heatmap_test.cpp.o.d"
+  "/root/repo/test/hle_test.cpp" "CMakeFiles/ace64_test.dir/test/hle_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/hle_test.cpp.o.d"
+  "/root/repo/test/hostcall_test.cpp" "CMakeFiles/ace64_test.dir/test/hostcall_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/hostcall_test.cpp.o.d"
+  "/root/repo/test/jobserver_test.cpp" "CMakeFiles/ace64_test.dir/test/jobserver_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/jobserver_test.cpp.o.d"
+  "/root/repo/test/libace64_test.cpp" "CMakeFiles/ace64_test.dir/test/libace64_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/libace64_test.cpp.o.d"
+  "/root/repo/test/loops_test.cpp" "CMakeFiles/ace64_test.dir/test/loops_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/loops_test.cpp.o.d"
+  "/root/repo/test/machine_test.cpp" "CMakeFiles/ace64_test.dir/test/machine_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/machine_test.cpp.o.d"
+  "/root/repo/test/memo_test.cpp" "CMakeFiles/ace64_test.dir/test/memo_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/memo_test.cpp.o.d"
+  "/root/repo/test/profile_test.cpp" "CMakeFiles/ace64_test.dir/test/profile_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/profile_test.cpp.o.d"
+  "/root/repo/test/resultcache_test.cpp" "CMakeFiles/ace64_test.dir/test/resultcache_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/resultcache_test.cpp.o.d"
+  "/root/repo/test/run_test.cpp" "CMakeFiles/ace64_test.dir/test/run_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/run_test.cpp.o.d"
+  "/root/repo/test/statehash_test.cpp" "CMakeFiles/ace64_test.dir/test/statehash_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/statehash_test.cpp.o.d"
+  "/root/repo/test/trace_test.cpp" "CMakeFiles/ace64_test.dir/test/trace_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/trace_test.cpp.o.d"
+  "/root/repo/test/writers_test.cpp" "CMakeFiles/ace64_test.dir/test/writers_test.cpp.o" "gcc" "CMakeFiles/ace64_test.dir/test/writers_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_all_build/CMakeFiles/ace64_core.dir/DependInfo.cmake"
+  "/root/repo/_all_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_all_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
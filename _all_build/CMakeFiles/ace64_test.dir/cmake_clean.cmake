@@ -0,0 +1,54 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ace64_test.dir/test/ace64_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/ace64_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/alu_reference_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/alu_reference_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/basicfp_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/basicfp_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/batch_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/batch_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/breakpoints_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/breakpoints_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/codemap_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/codemap_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/explore_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/explore_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/gdbstub_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/gdbstub_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/heatmap_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/heatmap_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/hle_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/hle_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/hostcall_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/hostcall_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/jobserver_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/jobserver_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/libace64_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/libace64_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/loops_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/loops_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/machine_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/machine_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/memo_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/memo_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/profile_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/profile_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/resultcache_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/resultcache_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/run_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/run_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/statehash_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/statehash_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/trace_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/trace_test.cpp.o.d"
+  "CMakeFiles/ace64_test.dir/test/writers_test.cpp.o"
+  "CMakeFiles/ace64_test.dir/test/writers_test.cpp.o.d"
+  "ace64_test"
+  "ace64_test.pdb"
+  "ace64_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ace64_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/ace64_workloads.c" "CMakeFiles/ace64_workloads.dir/bench/ace64_workloads.c.o" "gcc" "CMakeFiles/ace64_workloads.dir/bench/ace64_workloads.c.o.d"
+  "/root/repo/bench/workloads.c" "CMakeFiles/ace64_workloads.dir/bench/workloads.c.o" "gcc" "CMakeFiles/ace64_workloads.dir/bench/workloads.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_all_build/CMakeFiles/ace64_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
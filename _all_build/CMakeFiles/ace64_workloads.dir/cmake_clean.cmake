@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ace64_workloads.dir/bench/ace64_workloads.c.o"
+  "CMakeFiles/ace64_workloads.dir/bench/ace64_workloads.c.o.d"
+  "CMakeFiles/ace64_workloads.dir/bench/workloads.c.o"
+  "CMakeFiles/ace64_workloads.dir/bench/workloads.c.o.d"
+  "ace64_workloads"
+  "ace64_workloads.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ace64_workloads.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ace64d.dir/code/ace64d.c.o"
+  "CMakeFiles/ace64d.dir/code/ace64d.c.o.d"
+  "ace64d"
+  "ace64d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ace64d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_all_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_all_build/ace64_test[1]_include.cmake")
+include("/root/repo/_all_build/ace64_taint_test[1]_include.cmake")
+add_test(workloads "/root/repo/_all_build/ace64_workloads" "-n" "1")
+set_tests_properties(workloads PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;295;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("_deps/googletest-build")
@@ -0,0 +1,279 @@
+add_test([=[taint.ace64Test.StackPointerCheckOverflow]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.StackPointerCheckOverflow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.StackPointerCheckOverflow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.StackPointerCheckUnderflow]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.StackPointerCheckUnderflow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.StackPointerCheckUnderflow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDAImmediate]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDAImmediate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDAImmediate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDAZeroPage]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDAZeroPage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDAZeroPage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDAZeroPageX]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDAZeroPageX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDAZeroPageX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDAZeroPageXBoundaryCheck]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDAZeroPageXBoundaryCheck]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDAZeroPageXBoundaryCheck]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDAImmediateZeroValue]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDAImmediateZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDAImmediateZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDAAbsolute]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDAAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDAAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDAAbsoluteX]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDAAbsoluteX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDAAbsoluteX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDAAbsoluteXBoundary]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDAAbsoluteXBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDAAbsoluteXBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDAAbsoluteY]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDAAbsoluteY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDAAbsoluteY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDAAbsoluteYBoundary]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDAAbsoluteYBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDAAbsoluteYBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDAIndirectX]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDAIndirectX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDAIndirectX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDAIndirectY]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDAIndirectY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDAIndirectY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDAAIndirectYBoundary]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDAAIndirectYBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDAAIndirectYBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDXImmediate]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDXImmediate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDXImmediate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDXZeroPage]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDXZeroPage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDXZeroPage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDXZeroPageY]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDXZeroPageY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDXZeroPageY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDXZeroPageYBoundaryCheck]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDXZeroPageYBoundaryCheck]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDXZeroPageYBoundaryCheck]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDXAbsolute]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDXAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDXAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDXAbsoluteY]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDXAbsoluteY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDXAbsoluteY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDXAbsoluteYBoundary]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDXAbsoluteYBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDXAbsoluteYBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDYImmediate]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDYImmediate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDYImmediate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDYZeroPage]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDYZeroPage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDYZeroPage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDYZeroPageX]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDYZeroPageX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDYZeroPageX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDYZeroPageXBoundaryCheck]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDYZeroPageXBoundaryCheck]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDYZeroPageXBoundaryCheck]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDYAbsolute]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDYAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDYAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDYAbsoluteX]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDYAbsoluteX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDYAbsoluteX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LDYAbsoluteXBoundary]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LDYAbsoluteXBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LDYAbsoluteXBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STAZPWritesARegisterToMemory]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STAZPWritesARegisterToMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STAZPWritesARegisterToMemory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STAZPXWritesARegisterToMemory]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STAZPXWritesARegisterToMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STAZPXWritesARegisterToMemory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STAAbsolute]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STAAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STAAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STAAbsoluteX]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STAAbsoluteX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STAAbsoluteX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STAAbsoluteXBoundary]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STAAbsoluteXBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STAAbsoluteXBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STAAbsoluteY]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STAAbsoluteY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STAAbsoluteY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STAAbsoluteYBoundary]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STAAbsoluteYBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STAAbsoluteYBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STAIndirectX]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STAIndirectX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STAIndirectX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STAIndirectY]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STAIndirectY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STAIndirectY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STAAIndirectYBoundary]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STAAIndirectYBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STAAIndirectYBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STX_ZeroPoint_Writes_X_Register_To_Memory]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STX_ZeroPoint_Writes_X_Register_To_Memory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STX_ZeroPoint_Writes_X_Register_To_Memory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STXAbsolute]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STXAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STXAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STX_ZeroPoint_Indexed_Address_Contains_Value]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STX_ZeroPoint_Indexed_Address_Contains_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STX_ZeroPoint_Indexed_Address_Contains_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.STY_ZerPoint_Address_Contains_Value]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.STY_ZerPoint_Address_Contains_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.STY_ZerPoint_Address_Contains_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.DEC_ZeroPage_Decreases_Value]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.DEC_ZeroPage_Decreases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.DEC_ZeroPage_Decreases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.DEC_ZeroPage_Indexed_Decreases_Value]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.DEC_ZeroPage_Indexed_Decreases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.DEC_ZeroPage_Indexed_Decreases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.DEC_ZeroPage_ZeroValue]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.DEC_ZeroPage_ZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.DEC_ZeroPage_ZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.INC_ZeroPage_Increases_Value]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.INC_ZeroPage_Increases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.INC_ZeroPage_Increases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.INC_ZeroPage_FFValue]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.INC_ZeroPage_FFValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.INC_ZeroPage_FFValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.INC_ZeroPage_Indexed_Increased_Value]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.INC_ZeroPage_Indexed_Increased_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.INC_ZeroPage_Indexed_Increased_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.DEC_Absolute_Decreases_Value]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.DEC_Absolute_Decreases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.DEC_Absolute_Decreases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.INC_Absolute_Decreases_Value]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.INC_Absolute_Decreases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.INC_Absolute_Decreases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.DEC_Absolute_Indexed_Decreases_Value]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.DEC_Absolute_Indexed_Decreases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.DEC_Absolute_Indexed_Decreases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.INC_Absolute_Indexed_Increases_Value]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.INC_Absolute_Indexed_Increases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.INC_Absolute_Indexed_Increases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.JMPAbsolutePCContainsAddress]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.JMPAbsolutePCContainsAddress]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.JMPAbsolutePCContainsAddress]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.JSRTestPushAndJump]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.JSRTestPushAndJump]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.JSRTestPushAndJump]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.TAXTestValues]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.TAXTestValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.TAXTestValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.TAXTestZeroValue]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.TAXTestZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.TAXTestZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.TAYTestValues]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.TAYTestValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.TAYTestValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.TAYTestZeroValue]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.TAYTestZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.TAYTestZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.TXATestValues]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.TXATestValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.TXATestValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.TXATestZeroValue]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.TXATestZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.TXATestZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.TYATestValues]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.TYATestValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.TYATestValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.TYATestZeroValue]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.TYATestZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.TYATestZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.TSXTestValues]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.TSXTestValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.TSXTestValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.TSXTestZeroValue]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.TSXTestZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.TSXTestZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.TXSTestValues]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.TXSTestValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.TXSTestValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.PHATestStackPush]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.PHATestStackPush]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.PHATestStackPush]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.PHPTestStackPush]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.PHPTestStackPush]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.PHPTestStackPush]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.PLATestAccumulatorLoad]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.PLATestAccumulatorLoad]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.PLATestAccumulatorLoad]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.PLPTestStatusLoad]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.PLPTestStatusLoad]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.PLPTestStatusLoad]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ASLAccumulatorMode]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ASLAccumulatorMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ASLAccumulatorMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ASLZeroPageMode]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ASLZeroPageMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ASLZeroPageMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ASLZeroPageXMode]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ASLZeroPageXMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ASLZeroPageXMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ASLZeroPageXWrappingTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ASLZeroPageXWrappingTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ASLZeroPageXWrappingTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ASLAbsoluteTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ASLAbsoluteTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ASLAbsoluteTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ASLAbsoluteXIndexedTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ASLAbsoluteXIndexedTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ASLAbsoluteXIndexedTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LSRAccumulatorTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LSRAccumulatorTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LSRAccumulatorTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LSRZeroPageTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LSRZeroPageTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LSRZeroPageTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LSRZeroPageXTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LSRZeroPageXTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LSRZeroPageXTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LSRAbsoluteTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LSRAbsoluteTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LSRAbsoluteTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LSRAbsoluteXTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LSRAbsoluteXTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LSRAbsoluteXTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.EORImmediate]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.EORImmediate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.EORImmediate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.EORZeroPage]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.EORZeroPage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.EORZeroPage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.EORZeroPageX]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.EORZeroPageX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.EORZeroPageX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.EORAbsolute]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.EORAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.EORAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.EORAbsoluteXPagePenalty]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.EORAbsoluteXPagePenalty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.EORAbsoluteXPagePenalty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.EORIndirectX]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.EORIndirectX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.EORIndirectX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.EORIndirectY]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.EORIndirectY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.EORIndirectY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ORAImmediate]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ORAImmediate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ORAImmediate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ORAZeroPage]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ORAZeroPage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ORAZeroPage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ORAZeroPageX]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ORAZeroPageX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ORAZeroPageX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ORAAbsolute]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ORAAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ORAAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ORAAbsoluteYPagePenalty]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ORAAbsoluteYPagePenalty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ORAAbsoluteYPagePenalty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ORAAbsoluteXPagePenalty]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ORAAbsoluteXPagePenalty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ORAAbsoluteXPagePenalty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ORAIndirectX]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ORAIndirectX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ORAIndirectX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ORAIndirectY]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ORAIndirectY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ORAIndirectY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ROLAccumulatorTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ROLAccumulatorTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ROLAccumulatorTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.RORAccumulatorTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.RORAccumulatorTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.RORAccumulatorTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ROLZeroPageTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ROLZeroPageTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ROLZeroPageTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.RORAbsoluteXTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.RORAbsoluteXTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.RORAbsoluteXTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ROLMultiValueTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ROLMultiValueTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ROLMultiValueTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.RORMultiValueTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.RORMultiValueTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.RORMultiValueTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.BITAbsoluteTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.BITAbsoluteTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.BITAbsoluteTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.CMPImmediateGreater]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.CMPImmediateGreater]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.CMPImmediateGreater]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.CMPZeroPageEqual]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.CMPZeroPageEqual]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.CMPZeroPageEqual]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.CMPZeroPageXLess]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.CMPZeroPageXLess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.CMPZeroPageXLess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.CMPAbsolute]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.CMPAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.CMPAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.CMPAbsoluteXPagePenalty]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.CMPAbsoluteXPagePenalty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.CMPAbsoluteXPagePenalty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.CMPIndirectX]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.CMPIndirectX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.CMPIndirectX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.CMPIndirectY]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.CMPIndirectY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.CMPIndirectY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.CPXImmediateGreater]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.CPXImmediateGreater]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.CPXImmediateGreater]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.CPXZeroPageEqual]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.CPXZeroPageEqual]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.CPXZeroPageEqual]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.CPXAbsolute]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.CPXAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.CPXAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.CPYImmediateGreater]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.CPYImmediateGreater]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.CPYImmediateGreater]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.CPYZeroPageEqual]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.CPYZeroPageEqual]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.CPYZeroPageEqual]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.CPYAbsolute]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.CPYAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.CPYAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.JMPIndirectPageBoundaryBug]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.JMPIndirectPageBoundaryBug]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.JMPIndirectPageBoundaryBug]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.JSR_RTS_RoundTrip]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.JSR_RTS_RoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.JSR_RTS_RoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.RTIReturnTest]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.RTIReturnTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.RTIReturnTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ADC_Simple]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ADC_Simple]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ADC_Simple]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ADC_Carry]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ADC_Carry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ADC_Carry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ADC_OverflowPositive]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ADC_OverflowPositive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ADC_OverflowPositive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ADC_OverflowNegative]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ADC_OverflowNegative]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ADC_OverflowNegative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ADC_WithCarryIn]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ADC_WithCarryIn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ADC_WithCarryIn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ADCDecimalBasic]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ADCDecimalBasic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ADCDecimalBasic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.SBCDecimalBasic]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.SBCDecimalBasic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.SBCDecimalBasic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.ADCDecimalFlagQuirk]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.ADCDecimalFlagQuirk]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.ADCDecimalFlagQuirk]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.BRKAndRTIRoundTrip]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.BRKAndRTIRoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.BRKAndRTIRoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.RegisterIncDecTests]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.RegisterIncDecTests]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.RegisterIncDecTests]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.AllBranchOpcodesLogic]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.AllBranchOpcodesLogic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.AllBranchOpcodesLogic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.ace64Test.LAXAllAddressingModes]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=ace64Test.LAXAllAddressingModes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.ace64Test.LAXAllAddressingModes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.taintTest.LoadAndStoreCopyTags]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=taintTest.LoadAndStoreCopyTags]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.taintTest.LoadAndStoreCopyTags]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.taintTest.ImmediateLoadClearsTags]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=taintTest.ImmediateLoadClearsTags]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.taintTest.ImmediateLoadClearsTags]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.taintTest.AdcMergesOperandAndCarryTags]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=taintTest.AdcMergesOperandAndCarryTags]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.taintTest.AdcMergesOperandAndCarryTags]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.taintTest.ReadModifyWriteKeepsMemoryTags]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=taintTest.ReadModifyWriteKeepsMemoryTags]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.taintTest.ReadModifyWriteKeepsMemoryTags]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.taintTest.StackCarriesTags]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=taintTest.StackCarriesTags]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.taintTest.StackCarriesTags]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.taintTest.InputSourceTagsEveryRead]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=taintTest.InputSourceTagsEveryRead]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.taintTest.InputSourceTagsEveryRead]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.taintTest.TaintedReturnAddressIsFlagged]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=taintTest.TaintedReturnAddressIsFlagged]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.taintTest.TaintedReturnAddressIsFlagged]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[taint.taintTest.ResetClearsTagsAndSources]=]  /root/repo/_all_build/ace64_taint_test [==[--gtest_filter=taintTest.ResetClearsTagsAndSources]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[taint.taintTest.ResetClearsTagsAndSources]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  ace64_taint_test_TESTS taint.ace64Test.StackPointerCheckOverflow taint.ace64Test.StackPointerCheckUnderflow taint.ace64Test.LDAImmediate taint.ace64Test.LDAZeroPage taint.ace64Test.LDAZeroPageX taint.ace64Test.LDAZeroPageXBoundaryCheck taint.ace64Test.LDAImmediateZeroValue taint.ace64Test.LDAAbsolute taint.ace64Test.LDAAbsoluteX taint.ace64Test.LDAAbsoluteXBoundary taint.ace64Test.LDAAbsoluteY taint.ace64Test.LDAAbsoluteYBoundary taint.ace64Test.LDAIndirectX taint.ace64Test.LDAIndirectY taint.ace64Test.LDAAIndirectYBoundary taint.ace64Test.LDXImmediate taint.ace64Test.LDXZeroPage taint.ace64Test.LDXZeroPageY taint.ace64Test.LDXZeroPageYBoundaryCheck taint.ace64Test.LDXAbsolute taint.ace64Test.LDXAbsoluteY taint.ace64Test.LDXAbsoluteYBoundary taint.ace64Test.LDYImmediate taint.ace64Test.LDYZeroPage taint.ace64Test.LDYZeroPageX taint.ace64Test.LDYZeroPageXBoundaryCheck taint.ace64Test.LDYAbsolute taint.ace64Test.LDYAbsoluteX taint.ace64Test.LDYAbsoluteXBoundary taint.ace64Test.STAZPWritesARegisterToMemory taint.ace64Test.STAZPXWritesARegisterToMemory taint.ace64Test.STAAbsolute taint.ace64Test.STAAbsoluteX taint.ace64Test.STAAbsoluteXBoundary taint.ace64Test.STAAbsoluteY taint.ace64Test.STAAbsoluteYBoundary taint.ace64Test.STAIndirectX taint.ace64Test.STAIndirectY taint.ace64Test.STAAIndirectYBoundary taint.ace64Test.STX_ZeroPoint_Writes_X_Register_To_Memory taint.ace64Test.STXAbsolute taint.ace64Test.STX_ZeroPoint_Indexed_Address_Contains_Value taint.ace64Test.STY_ZerPoint_Address_Contains_Value taint.ace64Test.DEC_ZeroPage_Decreases_Value taint.ace64Test.DEC_ZeroPage_Indexed_Decreases_Value taint.ace64Test.DEC_ZeroPage_ZeroValue taint.ace64Test.INC_ZeroPage_Increases_Value taint.ace64Test.INC_ZeroPage_FFValue taint.ace64Test.INC_ZeroPage_Indexed_Increased_Value taint.ace64Test.DEC_Absolute_Decreases_Value taint.ace64Test.INC_Absolute_Decreases_Value taint.ace64Test.DEC_Absolute_Indexed_Decreases_Value taint.ace64Test.INC_Absolute_Indexed_Increases_Value taint.ace64Test.JMPAbsolutePCContainsAddress taint.ace64Test.JSRTestPushAndJump taint.ace64Test.TAXTestValues taint.ace64Test.TAXTestZeroValue taint.ace64Test.TAYTestValues taint.ace64Test.TAYTestZeroValue taint.ace64Test.TXATestValues taint.ace64Test.TXATestZeroValue taint.ace64Test.TYATestValues taint.ace64Test.TYATestZeroValue taint.ace64Test.TSXTestValues taint.ace64Test.TSXTestZeroValue taint.ace64Test.TXSTestValues taint.ace64Test.PHATestStackPush taint.ace64Test.PHPTestStackPush taint.ace64Test.PLATestAccumulatorLoad taint.ace64Test.PLPTestStatusLoad taint.ace64Test.ASLAccumulatorMode taint.ace64Test.ASLZeroPageMode taint.ace64Test.ASLZeroPageXMode taint.ace64Test.ASLZeroPageXWrappingTest taint.ace64Test.ASLAbsoluteTest taint.ace64Test.ASLAbsoluteXIndexedTest taint.ace64Test.LSRAccumulatorTest taint.ace64Test.LSRZeroPageTest taint.ace64Test.LSRZeroPageXTest taint.ace64Test.LSRAbsoluteTest taint.ace64Test.LSRAbsoluteXTest taint.ace64Test.EORImmediate taint.ace64Test.EORZeroPage taint.ace64Test.EORZeroPageX taint.ace64Test.EORAbsolute taint.ace64Test.EORAbsoluteXPagePenalty taint.ace64Test.EORIndirectX taint.ace64Test.EORIndirectY taint.ace64Test.ORAImmediate taint.ace64Test.ORAZeroPage taint.ace64Test.ORAZeroPageX taint.ace64Test.ORAAbsolute taint.ace64Test.ORAAbsoluteYPagePenalty taint.ace64Test.ORAAbsoluteXPagePenalty taint.ace64Test.ORAIndirectX taint.ace64Test.ORAIndirectY taint.ace64Test.ROLAccumulatorTest taint.ace64Test.RORAccumulatorTest taint.ace64Test.ROLZeroPageTest taint.ace64Test.RORAbsoluteXTest taint.ace64Test.ROLMultiValueTest taint.ace64Test.RORMultiValueTest taint.ace64Test.BITAbsoluteTest taint.ace64Test.CMPImmediateGreater taint.ace64Test.CMPZeroPageEqual taint.ace64Test.CMPZeroPageXLess taint.ace64Test.CMPAbsolute taint.ace64Test.CMPAbsoluteXPagePenalty taint.ace64Test.CMPIndirectX taint.ace64Test.CMPIndirectY taint.ace64Test.CPXImmediateGreater taint.ace64Test.CPXZeroPageEqual taint.ace64Test.CPXAbsolute taint.ace64Test.CPYImmediateGreater taint.ace64Test.CPYZeroPageEqual taint.ace64Test.CPYAbsolute taint.ace64Test.JMPIndirectPageBoundaryBug taint.ace64Test.JSR_RTS_RoundTrip taint.ace64Test.RTIReturnTest taint.ace64Test.ADC_Simple taint.ace64Test.ADC_Carry taint.ace64Test.ADC_OverflowPositive taint.ace64Test.ADC_OverflowNegative taint.ace64Test.ADC_WithCarryIn taint.ace64Test.ADCDecimalBasic taint.ace64Test.SBCDecimalBasic taint.ace64Test.ADCDecimalFlagQuirk taint.ace64Test.BRKAndRTIRoundTrip taint.ace64Test.RegisterIncDecTests taint.ace64Test.AllBranchOpcodesLogic taint.ace64Test.LAXAllAddressingModes taint.taintTest.LoadAndStoreCopyTags taint.taintTest.ImmediateLoadClearsTags taint.taintTest.AdcMergesOperandAndCarryTags taint.taintTest.ReadModifyWriteKeepsMemoryTags taint.taintTest.StackCarriesTags taint.taintTest.InputSourceTagsEveryRead taint.taintTest.TaintedReturnAddressIsFlagged taint.taintTest.ResetClearsTagsAndSources)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_all_build/ace64_test[1]_tests.cmake")
+  include("/root/repo/_all_build/ace64_test[1]_tests.cmake")
+else()
+  add_test(ace64_test_NOT_BUILT ace64_test_NOT_BUILT)
+endif()
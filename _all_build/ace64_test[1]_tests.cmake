@@ -0,0 +1,563 @@
+add_test([=[ace64Test.StackPointerCheckOverflow]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.StackPointerCheckOverflow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.StackPointerCheckOverflow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.StackPointerCheckUnderflow]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.StackPointerCheckUnderflow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.StackPointerCheckUnderflow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDAImmediate]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDAImmediate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDAImmediate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDAZeroPage]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDAZeroPage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDAZeroPage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDAZeroPageX]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDAZeroPageX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDAZeroPageX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDAZeroPageXBoundaryCheck]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDAZeroPageXBoundaryCheck]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDAZeroPageXBoundaryCheck]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDAImmediateZeroValue]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDAImmediateZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDAImmediateZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDAAbsolute]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDAAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDAAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDAAbsoluteX]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDAAbsoluteX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDAAbsoluteX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDAAbsoluteXBoundary]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDAAbsoluteXBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDAAbsoluteXBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDAAbsoluteY]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDAAbsoluteY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDAAbsoluteY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDAAbsoluteYBoundary]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDAAbsoluteYBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDAAbsoluteYBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDAIndirectX]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDAIndirectX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDAIndirectX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDAIndirectY]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDAIndirectY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDAIndirectY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDAAIndirectYBoundary]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDAAIndirectYBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDAAIndirectYBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDXImmediate]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDXImmediate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDXImmediate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDXZeroPage]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDXZeroPage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDXZeroPage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDXZeroPageY]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDXZeroPageY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDXZeroPageY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDXZeroPageYBoundaryCheck]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDXZeroPageYBoundaryCheck]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDXZeroPageYBoundaryCheck]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDXAbsolute]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDXAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDXAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDXAbsoluteY]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDXAbsoluteY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDXAbsoluteY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDXAbsoluteYBoundary]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDXAbsoluteYBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDXAbsoluteYBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDYImmediate]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDYImmediate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDYImmediate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDYZeroPage]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDYZeroPage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDYZeroPage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDYZeroPageX]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDYZeroPageX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDYZeroPageX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDYZeroPageXBoundaryCheck]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDYZeroPageXBoundaryCheck]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDYZeroPageXBoundaryCheck]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDYAbsolute]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDYAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDYAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDYAbsoluteX]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDYAbsoluteX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDYAbsoluteX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LDYAbsoluteXBoundary]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LDYAbsoluteXBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LDYAbsoluteXBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STAZPWritesARegisterToMemory]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STAZPWritesARegisterToMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STAZPWritesARegisterToMemory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STAZPXWritesARegisterToMemory]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STAZPXWritesARegisterToMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STAZPXWritesARegisterToMemory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STAAbsolute]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STAAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STAAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STAAbsoluteX]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STAAbsoluteX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STAAbsoluteX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STAAbsoluteXBoundary]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STAAbsoluteXBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STAAbsoluteXBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STAAbsoluteY]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STAAbsoluteY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STAAbsoluteY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STAAbsoluteYBoundary]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STAAbsoluteYBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STAAbsoluteYBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STAIndirectX]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STAIndirectX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STAIndirectX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STAIndirectY]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STAIndirectY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STAIndirectY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STAAIndirectYBoundary]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STAAIndirectYBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STAAIndirectYBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STX_ZeroPoint_Writes_X_Register_To_Memory]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STX_ZeroPoint_Writes_X_Register_To_Memory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STX_ZeroPoint_Writes_X_Register_To_Memory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STXAbsolute]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STXAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STXAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STX_ZeroPoint_Indexed_Address_Contains_Value]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STX_ZeroPoint_Indexed_Address_Contains_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STX_ZeroPoint_Indexed_Address_Contains_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.STY_ZerPoint_Address_Contains_Value]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.STY_ZerPoint_Address_Contains_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.STY_ZerPoint_Address_Contains_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.DEC_ZeroPage_Decreases_Value]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.DEC_ZeroPage_Decreases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.DEC_ZeroPage_Decreases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.DEC_ZeroPage_Indexed_Decreases_Value]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.DEC_ZeroPage_Indexed_Decreases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.DEC_ZeroPage_Indexed_Decreases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.DEC_ZeroPage_ZeroValue]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.DEC_ZeroPage_ZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.DEC_ZeroPage_ZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.INC_ZeroPage_Increases_Value]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.INC_ZeroPage_Increases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.INC_ZeroPage_Increases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.INC_ZeroPage_FFValue]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.INC_ZeroPage_FFValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.INC_ZeroPage_FFValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.INC_ZeroPage_Indexed_Increased_Value]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.INC_ZeroPage_Indexed_Increased_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.INC_ZeroPage_Indexed_Increased_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.DEC_Absolute_Decreases_Value]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.DEC_Absolute_Decreases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.DEC_Absolute_Decreases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.INC_Absolute_Decreases_Value]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.INC_Absolute_Decreases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.INC_Absolute_Decreases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.DEC_Absolute_Indexed_Decreases_Value]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.DEC_Absolute_Indexed_Decreases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.DEC_Absolute_Indexed_Decreases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.INC_Absolute_Indexed_Increases_Value]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.INC_Absolute_Indexed_Increases_Value]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.INC_Absolute_Indexed_Increases_Value]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.JMPAbsolutePCContainsAddress]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.JMPAbsolutePCContainsAddress]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.JMPAbsolutePCContainsAddress]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.JSRTestPushAndJump]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.JSRTestPushAndJump]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.JSRTestPushAndJump]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.TAXTestValues]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.TAXTestValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.TAXTestValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.TAXTestZeroValue]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.TAXTestZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.TAXTestZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.TAYTestValues]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.TAYTestValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.TAYTestValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.TAYTestZeroValue]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.TAYTestZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.TAYTestZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.TXATestValues]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.TXATestValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.TXATestValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.TXATestZeroValue]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.TXATestZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.TXATestZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.TYATestValues]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.TYATestValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.TYATestValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.TYATestZeroValue]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.TYATestZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.TYATestZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.TSXTestValues]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.TSXTestValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.TSXTestValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.TSXTestZeroValue]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.TSXTestZeroValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.TSXTestZeroValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.TXSTestValues]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.TXSTestValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.TXSTestValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.PHATestStackPush]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.PHATestStackPush]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.PHATestStackPush]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.PHPTestStackPush]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.PHPTestStackPush]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.PHPTestStackPush]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.PLATestAccumulatorLoad]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.PLATestAccumulatorLoad]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.PLATestAccumulatorLoad]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.PLPTestStatusLoad]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.PLPTestStatusLoad]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.PLPTestStatusLoad]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ASLAccumulatorMode]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ASLAccumulatorMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ASLAccumulatorMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ASLZeroPageMode]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ASLZeroPageMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ASLZeroPageMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ASLZeroPageXMode]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ASLZeroPageXMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ASLZeroPageXMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ASLZeroPageXWrappingTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ASLZeroPageXWrappingTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ASLZeroPageXWrappingTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ASLAbsoluteTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ASLAbsoluteTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ASLAbsoluteTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ASLAbsoluteXIndexedTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ASLAbsoluteXIndexedTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ASLAbsoluteXIndexedTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LSRAccumulatorTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LSRAccumulatorTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LSRAccumulatorTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LSRZeroPageTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LSRZeroPageTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LSRZeroPageTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LSRZeroPageXTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LSRZeroPageXTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LSRZeroPageXTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LSRAbsoluteTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LSRAbsoluteTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LSRAbsoluteTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LSRAbsoluteXTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LSRAbsoluteXTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LSRAbsoluteXTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.EORImmediate]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.EORImmediate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.EORImmediate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.EORZeroPage]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.EORZeroPage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.EORZeroPage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.EORZeroPageX]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.EORZeroPageX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.EORZeroPageX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.EORAbsolute]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.EORAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.EORAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.EORAbsoluteXPagePenalty]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.EORAbsoluteXPagePenalty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.EORAbsoluteXPagePenalty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.EORIndirectX]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.EORIndirectX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.EORIndirectX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.EORIndirectY]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.EORIndirectY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.EORIndirectY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ORAImmediate]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ORAImmediate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ORAImmediate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ORAZeroPage]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ORAZeroPage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ORAZeroPage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ORAZeroPageX]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ORAZeroPageX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ORAZeroPageX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ORAAbsolute]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ORAAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ORAAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ORAAbsoluteYPagePenalty]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ORAAbsoluteYPagePenalty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ORAAbsoluteYPagePenalty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ORAAbsoluteXPagePenalty]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ORAAbsoluteXPagePenalty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ORAAbsoluteXPagePenalty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ORAIndirectX]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ORAIndirectX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ORAIndirectX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ORAIndirectY]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ORAIndirectY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ORAIndirectY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ROLAccumulatorTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ROLAccumulatorTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ROLAccumulatorTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.RORAccumulatorTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.RORAccumulatorTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.RORAccumulatorTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ROLZeroPageTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ROLZeroPageTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ROLZeroPageTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.RORAbsoluteXTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.RORAbsoluteXTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.RORAbsoluteXTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ROLMultiValueTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ROLMultiValueTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ROLMultiValueTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.RORMultiValueTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.RORMultiValueTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.RORMultiValueTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.BITAbsoluteTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.BITAbsoluteTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.BITAbsoluteTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.CMPImmediateGreater]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.CMPImmediateGreater]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.CMPImmediateGreater]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.CMPZeroPageEqual]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.CMPZeroPageEqual]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.CMPZeroPageEqual]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.CMPZeroPageXLess]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.CMPZeroPageXLess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.CMPZeroPageXLess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.CMPAbsolute]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.CMPAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.CMPAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.CMPAbsoluteXPagePenalty]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.CMPAbsoluteXPagePenalty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.CMPAbsoluteXPagePenalty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.CMPIndirectX]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.CMPIndirectX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.CMPIndirectX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.CMPIndirectY]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.CMPIndirectY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.CMPIndirectY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.CPXImmediateGreater]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.CPXImmediateGreater]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.CPXImmediateGreater]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.CPXZeroPageEqual]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.CPXZeroPageEqual]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.CPXZeroPageEqual]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.CPXAbsolute]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.CPXAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.CPXAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.CPYImmediateGreater]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.CPYImmediateGreater]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.CPYImmediateGreater]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.CPYZeroPageEqual]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.CPYZeroPageEqual]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.CPYZeroPageEqual]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.CPYAbsolute]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.CPYAbsolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.CPYAbsolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.JMPIndirectPageBoundaryBug]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.JMPIndirectPageBoundaryBug]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.JMPIndirectPageBoundaryBug]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.JSR_RTS_RoundTrip]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.JSR_RTS_RoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.JSR_RTS_RoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.RTIReturnTest]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.RTIReturnTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.RTIReturnTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ADC_Simple]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ADC_Simple]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ADC_Simple]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ADC_Carry]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ADC_Carry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ADC_Carry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ADC_OverflowPositive]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ADC_OverflowPositive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ADC_OverflowPositive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ADC_OverflowNegative]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ADC_OverflowNegative]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ADC_OverflowNegative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ADC_WithCarryIn]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ADC_WithCarryIn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ADC_WithCarryIn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ADCDecimalBasic]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ADCDecimalBasic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ADCDecimalBasic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.SBCDecimalBasic]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.SBCDecimalBasic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.SBCDecimalBasic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.ADCDecimalFlagQuirk]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.ADCDecimalFlagQuirk]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.ADCDecimalFlagQuirk]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.BRKAndRTIRoundTrip]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.BRKAndRTIRoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.BRKAndRTIRoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.RegisterIncDecTests]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.RegisterIncDecTests]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.RegisterIncDecTests]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.AllBranchOpcodesLogic]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.AllBranchOpcodesLogic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.AllBranchOpcodesLogic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ace64Test.LAXAllAddressingModes]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=ace64Test.LAXAllAddressingModes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ace64Test.LAXAllAddressingModes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[profileTest.AttachSwapsDispatchTableAndDetachRestoresIt]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=profileTest.AttachSwapsDispatchTableAndDetachRestoresIt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[profileTest.AttachSwapsDispatchTableAndDetachRestoresIt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[profileTest.CountsExecutionsCyclesAndHistogram]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=profileTest.CountsExecutionsCyclesAndHistogram]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[profileTest.CountsExecutionsCyclesAndHistogram]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[profileTest.InstrumentedTableMatchesPlainTable]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=profileTest.InstrumentedTableMatchesPlainTable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[profileTest.InstrumentedTableMatchesPlainTable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[profileTest.CountsTakenBranchesAndBranchPageCrossings]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=profileTest.CountsTakenBranchesAndBranchPageCrossings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[profileTest.CountsTakenBranchesAndBranchPageCrossings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[profileTest.MergeAddsCounters]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=profileTest.MergeAddsCounters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[profileTest.MergeAddsCounters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[profileTest.CsvHasOneRowPerExecutedOpcode]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=profileTest.CsvHasOneRowPerExecutedOpcode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[profileTest.CsvHasOneRowPerExecutedOpcode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[heatmapTest.CountersSaturateInsteadOfWrapping]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=heatmapTest.CountersSaturateInsteadOfWrapping]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[heatmapTest.CountersSaturateInsteadOfWrapping]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[heatmapTest.PageTotalSumsOnePage]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=heatmapTest.PageTotalSumsOnePage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[heatmapTest.PageTotalSumsOnePage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[heatmapTest.BinaryDumpRoundTrips]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=heatmapTest.BinaryDumpRoundTrips]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[heatmapTest.BinaryDumpRoundTrips]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[heatmapTest.PgmIs256By256WithAddressLayout]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=heatmapTest.PgmIs256By256WithAddressLayout]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[heatmapTest.PgmIs256By256WithAddressLayout]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[heatmapTest.AccessorsCountReadsWritesAndExecutes]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=heatmapTest.AccessorsCountReadsWritesAndExecutes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[heatmapTest.AccessorsCountReadsWritesAndExecutes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[heatmapTest.DetachedCpuDoesNotCount]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=heatmapTest.DetachedCpuDoesNotCount]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[heatmapTest.DetachedCpuDoesNotCount]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[traceTest.RecordIsSixteenBytes]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=traceTest.RecordIsSixteenBytes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[traceTest.RecordIsSixteenBytes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[traceTest.CapacityRoundsUpToPowerOfTwo]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=traceTest.CapacityRoundsUpToPowerOfTwo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[traceTest.CapacityRoundsUpToPowerOfTwo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[traceTest.RecordsStateBeforeEachInstruction]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=traceTest.RecordsStateBeforeEachInstruction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[traceTest.RecordsStateBeforeEachInstruction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[traceTest.DisarmedCpuRecordsNothing]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=traceTest.DisarmedCpuRecordsNothing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[traceTest.DisarmedCpuRecordsNothing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[traceTest.RingKeepsNewestRecordsInOrder]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=traceTest.RingKeepsNewestRecordsInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[traceTest.RingKeepsNewestRecordsInOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[traceTest.DumpRoundTrips]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=traceTest.DumpRoundTrips]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[traceTest.DumpRoundTrips]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[traceTest.SnapshotsWhileRunningAreNeverTorn]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=traceTest.SnapshotsWhileRunningAreNeverTorn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[traceTest.SnapshotsWhileRunningAreNeverTorn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[traceTest.DisassemblesEveryAddressingMode]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=traceTest.DisassemblesEveryAddressingMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[traceTest.DisassemblesEveryAddressingMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[breakpointsTest.ConditionOperators]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=breakpointsTest.ConditionOperators]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[breakpointsTest.ConditionOperators]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[breakpointsTest.RemovingBreakpointsClearsBitmaps]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=breakpointsTest.RemovingBreakpointsClearsBitmaps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[breakpointsTest.RemovingBreakpointsClearsBitmaps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[breakpointsTest.ExecuteBreakpointStopsBeforeInstruction]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=breakpointsTest.ExecuteBreakpointStopsBeforeInstruction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[breakpointsTest.ExecuteBreakpointStopsBeforeInstruction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[breakpointsTest.ResumeRunsTheInstructionUnderTheBreakpoint]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=breakpointsTest.ResumeRunsTheInstructionUnderTheBreakpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[breakpointsTest.ResumeRunsTheInstructionUnderTheBreakpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[breakpointsTest.ConditionalBreakpointOnlyStopsWhenConditionHolds]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=breakpointsTest.ConditionalBreakpointOnlyStopsWhenConditionHolds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[breakpointsTest.ConditionalBreakpointOnlyStopsWhenConditionHolds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[breakpointsTest.RangeWriteWatchpointReportsAccess]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=breakpointsTest.RangeWriteWatchpointReportsAccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[breakpointsTest.RangeWriteWatchpointReportsAccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[breakpointsTest.ReadWatchpointWithValueCondition]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=breakpointsTest.ReadWatchpointWithValueCondition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[breakpointsTest.ReadWatchpointWithValueCondition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[breakpointsTest.AccessorsAreUnhookedOutsideRun]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=breakpointsTest.AccessorsAreUnhookedOutsideRun]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[breakpointsTest.AccessorsAreUnhookedOutsideRun]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[gdbstubTest.ReadsAndWritesRegisters]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=gdbstubTest.ReadsAndWritesRegisters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[gdbstubTest.ReadsAndWritesRegisters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[gdbstubTest.KillEndsTheSession]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=gdbstubTest.KillEndsTheSession]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[gdbstubTest.KillEndsTheSession]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[gdbstubTest.ReadsAndWritesMemory]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=gdbstubTest.ReadsAndWritesMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[gdbstubTest.ReadsAndWritesMemory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[gdbstubTest.StepExecutesOneInstruction]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=gdbstubTest.StepExecutesOneInstruction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[gdbstubTest.StepExecutesOneInstruction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[gdbstubTest.ContinueStopsAtInsertedBreakpoint]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=gdbstubTest.ContinueStopsAtInsertedBreakpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[gdbstubTest.ContinueStopsAtInsertedBreakpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[gdbstubTest.MonitorConditionIsEvaluatedInTheEmulator]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=gdbstubTest.MonitorConditionIsEvaluatedInTheEmulator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[gdbstubTest.MonitorConditionIsEvaluatedInTheEmulator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[gdbstubTest.InterruptStopsContinue]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=gdbstubTest.InterruptStopsContinue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[gdbstubTest.InterruptStopsContinue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[gdbstubTest.WriteWatchpointReportsAddress]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=gdbstubTest.WriteWatchpointReportsAddress]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[gdbstubTest.WriteWatchpointReportsAddress]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[gdbstubTest.MonitorReportsLastWriter]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=gdbstubTest.MonitorReportsLastWriter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[gdbstubTest.MonitorReportsLastWriter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[writersTest.UnwrittenAddressHasNoWriter]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=writersTest.UnwrittenAddressHasNoWriter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[writersTest.UnwrittenAddressHasNoWriter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[writersTest.StampRoundTripsPcAndCycle]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=writersTest.StampRoundTripsPcAndCycle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[writersTest.StampRoundTripsPcAndCycle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[writersTest.RecordsLastWritingInstruction]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=writersTest.RecordsLastWritingInstruction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[writersTest.RecordsLastWritingInstruction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[writersTest.DetachedCpuDoesNotRecord]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=writersTest.DetachedCpuDoesNotRecord]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[writersTest.DetachedCpuDoesNotRecord]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[codemapTest.ClassifiesByAttributes]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=codemapTest.ClassifiesByAttributes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[codemapTest.ClassifiesByAttributes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[codemapTest.WritingBeforeExecutingIsNotSelfModifying]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=codemapTest.WritingBeforeExecutingIsNotSelfModifying]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[codemapTest.WritingBeforeExecutingIsNotSelfModifying]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[codemapTest.HotspotsAreSortedByCount]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=codemapTest.HotspotsAreSortedByCount]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[codemapTest.HotspotsAreSortedByCount]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[codemapTest.MapListsRunsOfOneClass]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=codemapTest.MapListsRunsOfOneClass]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[codemapTest.MapListsRunsOfOneClass]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[codemapTest.DetectsPatchedImmediate]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=codemapTest.DetectsPatchedImmediate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[codemapTest.DetectsPatchedImmediate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[statehashTest.HashFollowsMemoryAndRegisters]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=statehashTest.HashFollowsMemoryAndRegisters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[statehashTest.HashFollowsMemoryAndRegisters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[statehashTest.PokeKeepsValueCurrent]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=statehashTest.PokeKeepsValueCurrent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[statehashTest.PokeKeepsValueCurrent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[statehashTest.StateSetRejectsDuplicatesAndGrows]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=statehashTest.StateSetRejectsDuplicatesAndGrows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[statehashTest.StateSetRejectsDuplicatesAndGrows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[statehashTest.RevisitedStateDetectsInfiniteLoop]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=statehashTest.RevisitedStateDetectsInfiniteLoop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[statehashTest.RevisitedStateDetectsInfiniteLoop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[statehashTest.IncrementalHashMatchesRecomputation]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=statehashTest.IncrementalHashMatchesRecomputation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[statehashTest.IncrementalHashMatchesRecomputation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[exploreTest.BreadthFirstPrunesDuplicateStates]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=exploreTest.BreadthFirstPrunesDuplicateStates]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[exploreTest.BreadthFirstPrunesDuplicateStates]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[exploreTest.ChildrenShareUnchangedChunks]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=exploreTest.ChildrenShareUnchangedChunks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[exploreTest.ChildrenShareUnchangedChunks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[exploreTest.DepthFirstExpandsBestChildFirst]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=exploreTest.DepthFirstExpandsBestChildFirst]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[exploreTest.DepthFirstExpandsBestChildFirst]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[exploreTest.DepthFirstVisitsEveryStateOnce]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=exploreTest.DepthFirstVisitsEveryStateOnce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[exploreTest.DepthFirstVisitsEveryStateOnce]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[exploreTest.BeamKeepsBestStatesOfEachLevel]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=exploreTest.BeamKeepsBestStatesOfEachLevel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[exploreTest.BeamKeepsBestStatesOfEachLevel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[exploreTest.NegativeScorePrunes]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=exploreTest.NegativeScorePrunes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[exploreTest.NegativeScorePrunes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[exploreTest.UnimplementedOpcodeHaltsChild]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=exploreTest.UnimplementedOpcodeHaltsChild]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[exploreTest.UnimplementedOpcodeHaltsChild]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[exploreTest.RejectsEmptyAlphabet]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=exploreTest.RejectsEmptyAlphabet]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[exploreTest.RejectsEmptyAlphabet]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[memoTest.RecordsReadsBeforeWritesOnly]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=memoTest.RecordsReadsBeforeWritesOnly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[memoTest.RecordsReadsBeforeWritesOnly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[memoTest.TooManyReadsMakeTheCallUncacheable]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=memoTest.TooManyReadsMakeTheCallUncacheable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[memoTest.TooManyReadsMakeTheCallUncacheable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[memoTest.ReplaysRepeatedCallExactly]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=memoTest.ReplaysRepeatedCallExactly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[memoTest.ReplaysRepeatedCallExactly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[memoTest.PatchedRoutineIsRecordedAgain]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=memoTest.PatchedRoutineIsRecordedAgain]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[memoTest.PatchedRoutineIsRecordedAgain]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[memoTest.LongCallIsNotCached]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=memoTest.LongCallIsNotCached]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[memoTest.LongCallIsNotCached]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[loopsTest.FillsScreenInOneRun]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=loopsTest.FillsScreenInOneRun]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[loopsTest.FillsScreenInOneRun]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[loopsTest.CopiesThroughPointersAcrossPages]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=loopsTest.CopiesThroughPointersAcrossPages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[loopsTest.CopiesThroughPointersAcrossPages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[loopsTest.OverlappingCopyPropagatesInLoopOrder]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=loopsTest.OverlappingCopyPropagatesInLoopOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[loopsTest.OverlappingCopyPropagatesInLoopOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[loopsTest.CompareStopsAtFirstMismatch]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=loopsTest.CompareStopsAtFirstMismatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[loopsTest.CompareStopsAtFirstMismatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[loopsTest.CompareRunsToTheLimitWhenEqual]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=loopsTest.CompareRunsToTheLimitWhenEqual]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[loopsTest.CompareRunsToTheLimitWhenEqual]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[loopsTest.MatchesInterpreterForEveryStartIndex]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=loopsTest.MatchesInterpreterForEveryStartIndex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[loopsTest.MatchesInterpreterForEveryStartIndex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[loopsTest.DecrementFromZeroStopsAtTheWrap]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=loopsTest.DecrementFromZeroStopsAtTheWrap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[loopsTest.DecrementFromZeroStopsAtTheWrap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[loopsTest.StoresIntoOwnCodeAreInterpreted]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=loopsTest.StoresIntoOwnCodeAreInterpreted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[loopsTest.StoresIntoOwnCodeAreInterpreted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[loopsTest.IOPagesAreInterpreted]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=loopsTest.IOPagesAreInterpreted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[loopsTest.IOPagesAreInterpreted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[loopsTest.PointerStoresAreInterpreted]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=loopsTest.PointerStoresAreInterpreted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[loopsTest.PointerStoresAreInterpreted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[loopsTest.ExecuteRunsLoopsWhileAttached]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=loopsTest.ExecuteRunsLoopsWhileAttached]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[loopsTest.ExecuteRunsLoopsWhileAttached]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[loopsTest.TracedCpuIsInterpreted]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=loopsTest.TracedCpuIsInterpreted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[loopsTest.TracedCpuIsInterpreted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hleTest.ChroutOutputsAndReturns]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hleTest.ChroutOutputsAndReturns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hleTest.ChroutOutputsAndReturns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hleTest.GetinReturnsQueuedKeysThenZero]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hleTest.GetinReturnsQueuedKeysThenZero]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hleTest.GetinReturnsQueuedKeysThenZero]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hleTest.LoadUsesTheFileAddressForSecondaryAddressOne]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hleTest.LoadUsesTheFileAddressForSecondaryAddressOne]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hleTest.LoadUsesTheFileAddressForSecondaryAddressOne]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hleTest.LoadRelocatesForSecondaryAddressZero]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hleTest.LoadRelocatesForSecondaryAddressZero]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hleTest.LoadRelocatesForSecondaryAddressZero]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hleTest.VerifyFlagsMismatchInStatus]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hleTest.VerifyFlagsMismatchInStatus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hleTest.VerifyFlagsMismatchInStatus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hleTest.MissingFileSetsCarry]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hleTest.MissingFileSetsCarry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hleTest.MissingFileSetsCarry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hleTest.SaveWritesLoadAddressAndRange]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hleTest.SaveWritesLoadAddressAndRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hleTest.SaveWritesLoadAddressAndRange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hleTest.DecliningHandlerLeavesTheRoutineToRom]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hleTest.DecliningHandlerLeavesTheRoutineToRom]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hleTest.DecliningHandlerLeavesTheRoutineToRom]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hleTest.ExactModeAndUntrapStopTraps]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hleTest.ExactModeAndUntrapStopTraps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hleTest.ExactModeAndUntrapStopTraps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hleTest.ExecutePrintsWithoutRom]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hleTest.ExecutePrintsWithoutRom]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hleTest.ExecutePrintsWithoutRom]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hleTest.ExactModeRunsTheRom]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hleTest.ExactModeRunsTheRom]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hleTest.ExactModeRunsTheRom]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[basicfpTest.PacksKnownConstants]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=basicfpTest.PacksKnownConstants]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[basicfpTest.PacksKnownConstants]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[basicfpTest.UnpackAndPackRoundTrip]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=basicfpTest.UnpackAndPackRoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[basicfpTest.UnpackAndPackRoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[basicfpTest.FaddTrapAddsTheMemoryOperandAndReturns]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=basicfpTest.FaddTrapAddsTheMemoryOperandAndReturns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[basicfpTest.FaddTrapAddsTheMemoryOperandAndReturns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[basicfpTest.FsubtSubtractsFacFromArg]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=basicfpTest.FsubtSubtractsFacFromArg]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[basicfpTest.FsubtSubtractsFacFromArg]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[basicfpTest.CancellationGivesZero]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=basicfpTest.CancellationGivesZero]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[basicfpTest.CancellationGivesZero]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[basicfpTest.OneThirdRoundsUpWhenPacked]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=basicfpTest.OneThirdRoundsUpWhenPacked]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[basicfpTest.OneThirdRoundsUpWhenPacked]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[basicfpTest.ArithmeticIsWithinTheRoundingByte]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=basicfpTest.ArithmeticIsWithinTheRoundingByte]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[basicfpTest.ArithmeticIsWithinTheRoundingByte]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[basicfpTest.ErrorsAreLeftToTheRom]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=basicfpTest.ErrorsAreLeftToTheRom]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[basicfpTest.ErrorsAreLeftToTheRom]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[basicfpTest.SqrAndSin]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=basicfpTest.SqrAndSin]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[basicfpTest.SqrAndSin]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[basicfpTest.VerificationArmsNothingAgainstADifferentRom]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=basicfpTest.VerificationArmsNothingAgainstADifferentRom]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[basicfpTest.VerificationArmsNothingAgainstADifferentRom]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[basicfpTest.ExecuteMultipliesWithoutRom]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=basicfpTest.ExecuteMultipliesWithoutRom]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[basicfpTest.ExecuteMultipliesWithoutRom]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hostcallTest.WriteSendsBytesToChannel]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hostcallTest.WriteSendsBytesToChannel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hostcallTest.WriteSendsBytesToChannel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hostcallTest.ImmediateDispatchReadsTheServiceByte]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hostcallTest.ImmediateDispatchReadsTheServiceByte]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hostcallTest.ImmediateDispatchReadsTheServiceByte]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hostcallTest.ImplementedOpcodesAreRefused]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hostcallTest.ImplementedOpcodesAreRefused]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hostcallTest.ImplementedOpcodesAreRefused]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hostcallTest.ErrorsSetCarry]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hostcallTest.ErrorsSetCarry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hostcallTest.ErrorsSetCarry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hostcallTest.WrittenFileReadsBack]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hostcallTest.WrittenFileReadsBack]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hostcallTest.WrittenFileReadsBack]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hostcallTest.NamesLeavingTheDirectoryAreRefused]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hostcallTest.NamesLeavingTheDirectoryAreRefused]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hostcallTest.NamesLeavingTheDirectoryAreRefused]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hostcallTest.TimeIsTheHostClock]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hostcallTest.TimeIsTheHostClock]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hostcallTest.TimeIsTheHostClock]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hostcallTest.ExitRecordsStatusAndHalts]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hostcallTest.ExitRecordsStatusAndHalts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hostcallTest.ExitRecordsStatusAndHalts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hostcallTest.ExecuteReportsAndExits]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hostcallTest.ExecuteReportsAndExits]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hostcallTest.ExecuteReportsAndExits]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hostcallTest.ProfiledCpuServesHostCalls]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=hostcallTest.ProfiledCpuServesHostCalls]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hostcallTest.ProfiledCpuServesHostCalls]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[runTest.StopsBeforeBrk]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=runTest.StopsBeforeBrk]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[runTest.StopsBeforeBrk]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[runTest.StopsAtAddressAndContinuesPastIt]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=runTest.StopsAtAddressAndContinuesPastIt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[runTest.StopsAtAddressAndContinuesPastIt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[runTest.BranchToItselfIsASelfLoop]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=runTest.BranchToItselfIsASelfLoop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[runTest.BranchToItselfIsASelfLoop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[runTest.NativeLoopRunsAreNotSelfLoops]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=runTest.NativeLoopRunsAreNotSelfLoops]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[runTest.NativeLoopRunsAreNotSelfLoops]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[runTest.LimitsStopTheRun]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=runTest.LimitsStopTheRun]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[runTest.LimitsStopTheRun]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[runTest.UnimplementedOpcodesStop]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=runTest.UnimplementedOpcodesStop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[runTest.UnimplementedOpcodesStop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[runTest.BrkRunsWhenNotAStop]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=runTest.BrkRunsWhenNotAStop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[runTest.BrkRunsWhenNotAStop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[runTest.SentinelWriteStopsAfterTheStore]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=runTest.SentinelWriteStopsAfterTheStore]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[runTest.SentinelWriteStopsAfterTheStore]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[runTest.HostExitStopsWithItsStatus]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=runTest.HostExitStopsWithItsStatus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[runTest.HostExitStopsWithItsStatus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[batchTest.ParsesAJobLine]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=batchTest.ParsesAJobLine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[batchTest.ParsesAJobLine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[batchTest.SkipsCommentsAndRejectsBadFields]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=batchTest.SkipsCommentsAndRejectsBadFields]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[batchTest.SkipsCommentsAndRejectsBadFields]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[batchTest.RunsJobsAcrossThreads]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=batchTest.RunsJobsAcrossThreads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[batchTest.RunsJobsAcrossThreads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[batchTest.MissingManifestFails]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=batchTest.MissingManifestFails]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[batchTest.MissingManifestFails]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[jobserverTest.PipelinedJobsAnswerByTag]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=jobserverTest.PipelinedJobsAnswerByTag]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[jobserverTest.PipelinedJobsAnswerByTag]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[jobserverTest.BadRequestsGetAnErrorStatus]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=jobserverTest.BadRequestsGetAnErrorStatus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[jobserverTest.BadRequestsGetAnErrorStatus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[jobserverTest.StopWaitsForClients]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=jobserverTest.StopWaitsForClients]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[jobserverTest.StopWaitsForClients]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[resultcacheTest.KeysDependOnEveryByte]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=resultcacheTest.KeysDependOnEveryByte]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[resultcacheTest.KeysDependOnEveryByte]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[resultcacheTest.ResultsPersistAcrossOpens]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=resultcacheTest.ResultsPersistAcrossOpens]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[resultcacheTest.ResultsPersistAcrossOpens]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[resultcacheTest.FullSetEvictsLeastRecentlyUsed]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=resultcacheTest.FullSetEvictsLeastRecentlyUsed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[resultcacheTest.FullSetEvictsLeastRecentlyUsed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[resultcacheTest.LongPayloadsAreNotCached]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=resultcacheTest.LongPayloadsAreNotCached]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[resultcacheTest.LongPayloadsAreNotCached]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[resultcacheTest.RepeatedBatchJobsComeFromTheCache]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=resultcacheTest.RepeatedBatchJobsComeFromTheCache]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[resultcacheTest.RepeatedBatchJobsComeFromTheCache]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[libace64Test.RunsLoadedCodeAndDumpsMemory]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=libace64Test.RunsLoadedCodeAndDumpsMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[libace64Test.RunsLoadedCodeAndDumpsMemory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[libace64Test.MemoryIsSharedNotCopied]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=libace64Test.MemoryIsSharedNotCopied]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[libace64Test.MemoryIsSharedNotCopied]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[libace64Test.RejectsRangesPastTheEndOfMemory]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=libace64Test.RejectsRangesPastTheEndOfMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[libace64Test.RejectsRangesPastTheEndOfMemory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[libace64Test.StopsAndCycleLimits]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=libace64Test.StopsAndCycleLimits]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[libace64Test.StopsAndCycleLimits]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[libace64Test.BatchesRunEveryMachine]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=libace64Test.BatchesRunEveryMachine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[libace64Test.BatchesRunEveryMachine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[machineTest.MovesWithoutCopying]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=machineTest.MovesWithoutCopying]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[machineTest.MovesWithoutCopying]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[machineTest.LoadsAndStoresRanges]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=machineTest.LoadsAndStoresRanges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[machineTest.LoadsAndStoresRanges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[machineTest.RegisterStatesCompare]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=machineTest.RegisterStatesCompare]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[machineTest.RegisterStatesCompare]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[machineTest.DiffReportsChangedRanges]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=machineTest.DiffReportsChangedRanges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[machineTest.DiffReportsChangedRanges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ADC_binary  # GetParam() = ADC binary]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ADC_binary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ADC_binary  # GetParam() = ADC binary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/SBC_binary  # GetParam() = SBC binary]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=AllHelpers/AluExhaustiveTest.MatchesReferenceModel/SBC_binary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/SBC_binary  # GetParam() = SBC binary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ADC_decimal  # GetParam() = ADC decimal]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ADC_decimal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ADC_decimal  # GetParam() = ADC decimal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/SBC_decimal  # GetParam() = SBC decimal]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=AllHelpers/AluExhaustiveTest.MatchesReferenceModel/SBC_decimal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/SBC_decimal  # GetParam() = SBC decimal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/CMP  # GetParam() = CMP]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=AllHelpers/AluExhaustiveTest.MatchesReferenceModel/CMP]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/CMP  # GetParam() = CMP]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/BIT  # GetParam() = BIT]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=AllHelpers/AluExhaustiveTest.MatchesReferenceModel/BIT]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/BIT  # GetParam() = BIT]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/EOR  # GetParam() = EOR]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=AllHelpers/AluExhaustiveTest.MatchesReferenceModel/EOR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/EOR  # GetParam() = EOR]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ORA  # GetParam() = ORA]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ORA]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ORA  # GetParam() = ORA]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ASL  # GetParam() = ASL]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ASL]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ASL  # GetParam() = ASL]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/LSR  # GetParam() = LSR]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=AllHelpers/AluExhaustiveTest.MatchesReferenceModel/LSR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/LSR  # GetParam() = LSR]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ROL  # GetParam() = ROL]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ROL]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ROL  # GetParam() = ROL]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ROR  # GetParam() = ROR]=]  /root/repo/_all_build/ace64_test [==[--gtest_filter=AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ROR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ROR  # GetParam() = ROR]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_all_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  ace64_test_TESTS ace64Test.StackPointerCheckOverflow ace64Test.StackPointerCheckUnderflow ace64Test.LDAImmediate ace64Test.LDAZeroPage ace64Test.LDAZeroPageX ace64Test.LDAZeroPageXBoundaryCheck ace64Test.LDAImmediateZeroValue ace64Test.LDAAbsolute ace64Test.LDAAbsoluteX ace64Test.LDAAbsoluteXBoundary ace64Test.LDAAbsoluteY ace64Test.LDAAbsoluteYBoundary ace64Test.LDAIndirectX ace64Test.LDAIndirectY ace64Test.LDAAIndirectYBoundary ace64Test.LDXImmediate ace64Test.LDXZeroPage ace64Test.LDXZeroPageY ace64Test.LDXZeroPageYBoundaryCheck ace64Test.LDXAbsolute ace64Test.LDXAbsoluteY ace64Test.LDXAbsoluteYBoundary ace64Test.LDYImmediate ace64Test.LDYZeroPage ace64Test.LDYZeroPageX ace64Test.LDYZeroPageXBoundaryCheck ace64Test.LDYAbsolute ace64Test.LDYAbsoluteX ace64Test.LDYAbsoluteXBoundary ace64Test.STAZPWritesARegisterToMemory ace64Test.STAZPXWritesARegisterToMemory ace64Test.STAAbsolute ace64Test.STAAbsoluteX ace64Test.STAAbsoluteXBoundary ace64Test.STAAbsoluteY ace64Test.STAAbsoluteYBoundary ace64Test.STAIndirectX ace64Test.STAIndirectY ace64Test.STAAIndirectYBoundary ace64Test.STX_ZeroPoint_Writes_X_Register_To_Memory ace64Test.STXAbsolute ace64Test.STX_ZeroPoint_Indexed_Address_Contains_Value ace64Test.STY_ZerPoint_Address_Contains_Value ace64Test.DEC_ZeroPage_Decreases_Value ace64Test.DEC_ZeroPage_Indexed_Decreases_Value ace64Test.DEC_ZeroPage_ZeroValue ace64Test.INC_ZeroPage_Increases_Value ace64Test.INC_ZeroPage_FFValue ace64Test.INC_ZeroPage_Indexed_Increased_Value ace64Test.DEC_Absolute_Decreases_Value ace64Test.INC_Absolute_Decreases_Value ace64Test.DEC_Absolute_Indexed_Decreases_Value ace64Test.INC_Absolute_Indexed_Increases_Value ace64Test.JMPAbsolutePCContainsAddress ace64Test.JSRTestPushAndJump ace64Test.TAXTestValues ace64Test.TAXTestZeroValue ace64Test.TAYTestValues ace64Test.TAYTestZeroValue ace64Test.TXATestValues ace64Test.TXATestZeroValue ace64Test.TYATestValues ace64Test.TYATestZeroValue ace64Test.TSXTestValues ace64Test.TSXTestZeroValue ace64Test.TXSTestValues ace64Test.PHATestStackPush ace64Test.PHPTestStackPush ace64Test.PLATestAccumulatorLoad ace64Test.PLPTestStatusLoad ace64Test.ASLAccumulatorMode ace64Test.ASLZeroPageMode ace64Test.ASLZeroPageXMode ace64Test.ASLZeroPageXWrappingTest ace64Test.ASLAbsoluteTest ace64Test.ASLAbsoluteXIndexedTest ace64Test.LSRAccumulatorTest ace64Test.LSRZeroPageTest ace64Test.LSRZeroPageXTest ace64Test.LSRAbsoluteTest ace64Test.LSRAbsoluteXTest ace64Test.EORImmediate ace64Test.EORZeroPage ace64Test.EORZeroPageX ace64Test.EORAbsolute ace64Test.EORAbsoluteXPagePenalty ace64Test.EORIndirectX ace64Test.EORIndirectY ace64Test.ORAImmediate ace64Test.ORAZeroPage ace64Test.ORAZeroPageX ace64Test.ORAAbsolute ace64Test.ORAAbsoluteYPagePenalty ace64Test.ORAAbsoluteXPagePenalty ace64Test.ORAIndirectX ace64Test.ORAIndirectY ace64Test.ROLAccumulatorTest ace64Test.RORAccumulatorTest ace64Test.ROLZeroPageTest ace64Test.RORAbsoluteXTest ace64Test.ROLMultiValueTest ace64Test.RORMultiValueTest ace64Test.BITAbsoluteTest ace64Test.CMPImmediateGreater ace64Test.CMPZeroPageEqual ace64Test.CMPZeroPageXLess ace64Test.CMPAbsolute ace64Test.CMPAbsoluteXPagePenalty ace64Test.CMPIndirectX ace64Test.CMPIndirectY ace64Test.CPXImmediateGreater ace64Test.CPXZeroPageEqual ace64Test.CPXAbsolute ace64Test.CPYImmediateGreater ace64Test.CPYZeroPageEqual ace64Test.CPYAbsolute ace64Test.JMPIndirectPageBoundaryBug ace64Test.JSR_RTS_RoundTrip ace64Test.RTIReturnTest ace64Test.ADC_Simple ace64Test.ADC_Carry ace64Test.ADC_OverflowPositive ace64Test.ADC_OverflowNegative ace64Test.ADC_WithCarryIn ace64Test.ADCDecimalBasic ace64Test.SBCDecimalBasic ace64Test.ADCDecimalFlagQuirk ace64Test.BRKAndRTIRoundTrip ace64Test.RegisterIncDecTests ace64Test.AllBranchOpcodesLogic ace64Test.LAXAllAddressingModes profileTest.AttachSwapsDispatchTableAndDetachRestoresIt profileTest.CountsExecutionsCyclesAndHistogram profileTest.InstrumentedTableMatchesPlainTable profileTest.CountsTakenBranchesAndBranchPageCrossings profileTest.MergeAddsCounters profileTest.CsvHasOneRowPerExecutedOpcode heatmapTest.CountersSaturateInsteadOfWrapping heatmapTest.PageTotalSumsOnePage heatmapTest.BinaryDumpRoundTrips heatmapTest.PgmIs256By256WithAddressLayout heatmapTest.AccessorsCountReadsWritesAndExecutes heatmapTest.DetachedCpuDoesNotCount traceTest.RecordIsSixteenBytes traceTest.CapacityRoundsUpToPowerOfTwo traceTest.RecordsStateBeforeEachInstruction traceTest.DisarmedCpuRecordsNothing traceTest.RingKeepsNewestRecordsInOrder traceTest.DumpRoundTrips traceTest.SnapshotsWhileRunningAreNeverTorn traceTest.DisassemblesEveryAddressingMode breakpointsTest.ConditionOperators breakpointsTest.RemovingBreakpointsClearsBitmaps breakpointsTest.ExecuteBreakpointStopsBeforeInstruction breakpointsTest.ResumeRunsTheInstructionUnderTheBreakpoint breakpointsTest.ConditionalBreakpointOnlyStopsWhenConditionHolds breakpointsTest.RangeWriteWatchpointReportsAccess breakpointsTest.ReadWatchpointWithValueCondition breakpointsTest.AccessorsAreUnhookedOutsideRun gdbstubTest.ReadsAndWritesRegisters gdbstubTest.KillEndsTheSession gdbstubTest.ReadsAndWritesMemory gdbstubTest.StepExecutesOneInstruction gdbstubTest.ContinueStopsAtInsertedBreakpoint gdbstubTest.MonitorConditionIsEvaluatedInTheEmulator gdbstubTest.InterruptStopsContinue gdbstubTest.WriteWatchpointReportsAddress gdbstubTest.MonitorReportsLastWriter writersTest.UnwrittenAddressHasNoWriter writersTest.StampRoundTripsPcAndCycle writersTest.RecordsLastWritingInstruction writersTest.DetachedCpuDoesNotRecord codemapTest.ClassifiesByAttributes codemapTest.WritingBeforeExecutingIsNotSelfModifying codemapTest.HotspotsAreSortedByCount codemapTest.MapListsRunsOfOneClass codemapTest.DetectsPatchedImmediate statehashTest.HashFollowsMemoryAndRegisters statehashTest.PokeKeepsValueCurrent statehashTest.StateSetRejectsDuplicatesAndGrows statehashTest.RevisitedStateDetectsInfiniteLoop statehashTest.IncrementalHashMatchesRecomputation exploreTest.BreadthFirstPrunesDuplicateStates exploreTest.ChildrenShareUnchangedChunks exploreTest.DepthFirstExpandsBestChildFirst exploreTest.DepthFirstVisitsEveryStateOnce exploreTest.BeamKeepsBestStatesOfEachLevel exploreTest.NegativeScorePrunes exploreTest.UnimplementedOpcodeHaltsChild exploreTest.RejectsEmptyAlphabet memoTest.RecordsReadsBeforeWritesOnly memoTest.TooManyReadsMakeTheCallUncacheable memoTest.ReplaysRepeatedCallExactly memoTest.PatchedRoutineIsRecordedAgain memoTest.LongCallIsNotCached loopsTest.FillsScreenInOneRun loopsTest.CopiesThroughPointersAcrossPages loopsTest.OverlappingCopyPropagatesInLoopOrder loopsTest.CompareStopsAtFirstMismatch loopsTest.CompareRunsToTheLimitWhenEqual loopsTest.MatchesInterpreterForEveryStartIndex loopsTest.DecrementFromZeroStopsAtTheWrap loopsTest.StoresIntoOwnCodeAreInterpreted loopsTest.IOPagesAreInterpreted loopsTest.PointerStoresAreInterpreted loopsTest.ExecuteRunsLoopsWhileAttached loopsTest.TracedCpuIsInterpreted hleTest.ChroutOutputsAndReturns hleTest.GetinReturnsQueuedKeysThenZero hleTest.LoadUsesTheFileAddressForSecondaryAddressOne hleTest.LoadRelocatesForSecondaryAddressZero hleTest.VerifyFlagsMismatchInStatus hleTest.MissingFileSetsCarry hleTest.SaveWritesLoadAddressAndRange hleTest.DecliningHandlerLeavesTheRoutineToRom hleTest.ExactModeAndUntrapStopTraps hleTest.ExecutePrintsWithoutRom hleTest.ExactModeRunsTheRom basicfpTest.PacksKnownConstants basicfpTest.UnpackAndPackRoundTrip basicfpTest.FaddTrapAddsTheMemoryOperandAndReturns basicfpTest.FsubtSubtractsFacFromArg basicfpTest.CancellationGivesZero basicfpTest.OneThirdRoundsUpWhenPacked basicfpTest.ArithmeticIsWithinTheRoundingByte basicfpTest.ErrorsAreLeftToTheRom basicfpTest.SqrAndSin basicfpTest.VerificationArmsNothingAgainstADifferentRom basicfpTest.ExecuteMultipliesWithoutRom hostcallTest.WriteSendsBytesToChannel hostcallTest.ImmediateDispatchReadsTheServiceByte hostcallTest.ImplementedOpcodesAreRefused hostcallTest.ErrorsSetCarry hostcallTest.WrittenFileReadsBack hostcallTest.NamesLeavingTheDirectoryAreRefused hostcallTest.TimeIsTheHostClock hostcallTest.ExitRecordsStatusAndHalts hostcallTest.ExecuteReportsAndExits hostcallTest.ProfiledCpuServesHostCalls runTest.StopsBeforeBrk runTest.StopsAtAddressAndContinuesPastIt runTest.BranchToItselfIsASelfLoop runTest.NativeLoopRunsAreNotSelfLoops runTest.LimitsStopTheRun runTest.UnimplementedOpcodesStop runTest.BrkRunsWhenNotAStop runTest.SentinelWriteStopsAfterTheStore runTest.HostExitStopsWithItsStatus batchTest.ParsesAJobLine batchTest.SkipsCommentsAndRejectsBadFields batchTest.RunsJobsAcrossThreads batchTest.MissingManifestFails jobserverTest.PipelinedJobsAnswerByTag jobserverTest.BadRequestsGetAnErrorStatus jobserverTest.StopWaitsForClients resultcacheTest.KeysDependOnEveryByte resultcacheTest.ResultsPersistAcrossOpens resultcacheTest.FullSetEvictsLeastRecentlyUsed resultcacheTest.LongPayloadsAreNotCached resultcacheTest.RepeatedBatchJobsComeFromTheCache libace64Test.RunsLoadedCodeAndDumpsMemory libace64Test.MemoryIsSharedNotCopied libace64Test.RejectsRangesPastTheEndOfMemory libace64Test.StopsAndCycleLimits libace64Test.BatchesRunEveryMachine machineTest.MovesWithoutCopying machineTest.LoadsAndStoresRanges machineTest.RegisterStatesCompare machineTest.DiffReportsChangedRanges [==[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ADC_binary  # GetParam() = ADC binary]==] [==[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/SBC_binary  # GetParam() = SBC binary]==] [==[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ADC_decimal  # GetParam() = ADC decimal]==] [==[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/SBC_decimal  # GetParam() = SBC decimal]==] [==[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/CMP  # GetParam() = CMP]==] [==[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/BIT  # GetParam() = BIT]==] [==[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/EOR  # GetParam() = EOR]==] [==[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ORA  # GetParam() = ORA]==] [==[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ASL  # GetParam() = ASL]==] [==[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/LSR  # GetParam() = LSR]==] [==[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ROL  # GetParam() = ROL]==] [==[AllHelpers/AluExhaustiveTest.MatchesReferenceModel/ROR  # GetParam() = ROR]==])
@@ -0,0 +1,513 @@
+#include "../code/cpu.h"
+#include "../code/opinfo.h"
+#include "../code/support.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ace64_bench.c
+ * Per-opcode microbenchmarks.  Every implemented opcode is timed in its
+ * addressing mode, plus a page-cross variant for indexed reads/writes and
+ * taken, not-taken and page-cross variants for branches.  Results are
+ * written as JSON and can be compared against a saved baseline to flag
+ * regressions.
+ */
+
+#define CODE_ADDRESS 0x0200
+// A branch here with operand $10 lands on $0302, the page after its own.
+#define PAGE_END_ADDRESS 0x02F0
+#define DATA_ADDRESS 0x3000
+#define ZP_OPERAND 0x10
+#define ZP_INDIRECT_X 0x20
+#define ZP_INDIRECT_Y 0x40
+#define INDEX_VALUE 0x05
+
+#define MAX_CASES 512
+#define BATCH_SIZE 4096
+
+typedef enum
+{
+  VARIANT_BASE,
+  VARIANT_PAGE_CROSS,
+  VARIANT_TAKEN,
+  VARIANT_NOT_TAKEN
+} Variant;
+
+typedef struct
+{
+  char name[32];
+  Byte opcode;
+  Variant variant;
+  Sint32 cycles;
+  unsigned long long iterations;
+  double nsPerInstruction;
+} BenchResult;
+
+typedef struct
+{
+  const char *outputPath;
+  const char *baselinePath;
+  const char *currentPath;
+  const char *filter;
+  double thresholdPercent;
+  double minSeconds;
+  int repetitions;
+} BenchOptions;
+
+typedef struct
+{
+  Word PC;
+  Byte SP, P, A, X, Y;
+} Registers;
+
+static const char *
+variant_name (Variant variant)
+{
+  static const char *names[]
+      = { "base", "page_cross", "taken", "not_taken" };
+  return names[variant];
+}
+
+static void
+save_registers (const CPU *cpu, Registers *registers)
+{
+  registers->PC = cpu->PC;
+  registers->SP = cpu->SP;
+  registers->P = cpu->P;
+  registers->A = cpu->A;
+  registers->X = cpu->X;
+  registers->Y = cpu->Y;
+}
+
+static void
+restore_registers (CPU *cpu, const Registers *registers)
+{
+  cpu->PC = registers->PC;
+  cpu->SP = registers->SP;
+  cpu->P = registers->P;
+  cpu->A = registers->A;
+  cpu->X = registers->X;
+  cpu->Y = registers->Y;
+}
+
+// Branch opcodes encode the tested flag in bits 7-6 and the value that takes
+// the branch in bit 5.
+static Byte
+branch_flag (Byte opcode)
+{
+  static const Byte flags[]
+      = { FLAG_NEGATIVE, FLAG_OVERFLOW, FLAG_CARRY, FLAG_ZERO };
+  return flags[opcode >> 6];
+}
+
+static void
+setup_case (CPU *cpu, Byte opcode, Variant variant)
+{
+  reset (cpu);
+
+  AddressingMode mode = opcode_info[opcode].mode;
+  Word base = (variant == VARIANT_PAGE_CROSS) ? DATA_ADDRESS + 0xFE
+                                              : DATA_ADDRESS;
+
+  Word code = (mode == MODE_REL && variant == VARIANT_PAGE_CROSS)
+                  ? PAGE_END_ADDRESS
+                  : CODE_ADDRESS;
+
+  cpu->PC = code;
+  cpu->SP = 0xF0;
+  cpu->A = 0x42;
+  cpu->X = INDEX_VALUE;
+  cpu->Y = INDEX_VALUE;
+
+  for (Word i = 0; i < 0x200; i++)
+    {
+      cpu->Memory[DATA_ADDRESS + i] = (Byte)(0x31 + i);
+    }
+
+  // Vectors and stack contents for BRK/RTI/RTS/JMP land back in the code page.
+  cpu->Memory[0xFFFE] = CODE_ADDRESS & 0xFF;
+  cpu->Memory[0xFFFF] = CODE_ADDRESS >> 8;
+  cpu->Memory[0x01F1] = 0x24;
+  cpu->Memory[0x01F2] = CODE_ADDRESS & 0xFF;
+  cpu->Memory[0x01F3] = CODE_ADDRESS >> 8;
+
+  cpu->Memory[ZP_OPERAND] = 0x55;
+  cpu->Memory[ZP_OPERAND + INDEX_VALUE] = 0x66;
+  cpu->Memory[(ZP_INDIRECT_X + INDEX_VALUE) & 0xFF] = base & 0xFF;
+  cpu->Memory[(ZP_INDIRECT_X + INDEX_VALUE + 1) & 0xFF] = base >> 8;
+  cpu->Memory[ZP_INDIRECT_Y] = base & 0xFF;
+  cpu->Memory[ZP_INDIRECT_Y + 1] = base >> 8;
+
+  cpu->Memory[code] = opcode;
+  switch (mode)
+    {
+    case MODE_IMM:
+      cpu->Memory[code + 1] = 0x37;
+      break;
+    case MODE_ZP:
+    case MODE_ZPX:
+    case MODE_ZPY:
+      cpu->Memory[code + 1] = ZP_OPERAND;
+      break;
+    case MODE_IDX:
+      cpu->Memory[code + 1] = ZP_INDIRECT_X;
+      break;
+    case MODE_IDY:
+      cpu->Memory[code + 1] = ZP_INDIRECT_Y;
+      break;
+    case MODE_ABS:
+    case MODE_ABX:
+    case MODE_ABY:
+    case MODE_IND:
+      cpu->Memory[code + 1] = base & 0xFF;
+      cpu->Memory[code + 2] = base >> 8;
+      break;
+    case MODE_REL:
+      cpu->Memory[code + 1] = 0x10;
+      {
+        bool takenWhenSet = (opcode & 0x20) != 0;
+        bool wantTaken = (variant != VARIANT_NOT_TAKEN);
+        if (takenWhenSet == wantTaken)
+          {
+            cpu->P |= branch_flag (opcode);
+          }
+        else
+          {
+            cpu->P &= ~branch_flag (opcode);
+          }
+      }
+      break;
+    default:
+      break;
+    }
+}
+
+static double
+time_batches (CPU *cpu, const Registers *start, unsigned long long batches)
+{
+  double begin = support_now_seconds ();
+  for (unsigned long long b = 0; b < batches; b++)
+    {
+      for (int i = 0; i < BATCH_SIZE; i++)
+        {
+          restore_registers (cpu, start);
+          execute (cpu);
+        }
+    }
+  return support_now_seconds () - begin;
+}
+
+static void
+format_case_name (Byte opcode, Variant variant, char *name, size_t size)
+{
+  const OpcodeInfo *info = &opcode_info[opcode];
+  snprintf (name, size, "%s_%s_%02X/%s", info->mnemonic,
+            addressing_mode_name (info->mode), opcode,
+            variant_name (variant));
+}
+
+static void
+run_case (CPU *cpu, Byte opcode, Variant variant, const BenchOptions *options,
+          BenchResult *result)
+{
+  Registers start;
+
+  setup_case (cpu, opcode, variant);
+  save_registers (cpu, &start);
+
+  format_case_name (opcode, variant, result->name, sizeof (result->name));
+  result->opcode = opcode;
+  result->variant = variant;
+  result->cycles = execute (cpu);
+
+  // Calibrate the batch count so one repetition takes at least minSeconds.
+  unsigned long long batches = 1;
+  while (time_batches (cpu, &start, batches) < options->minSeconds
+         && batches < (1ULL << 20))
+    {
+      batches *= 2;
+    }
+
+  double best = -1.0;
+  for (int r = 0; r < options->repetitions; r++)
+    {
+      double seconds = time_batches (cpu, &start, batches);
+      if (best < 0.0 || seconds < best)
+        {
+          best = seconds;
+        }
+    }
+
+  result->iterations = batches * BATCH_SIZE;
+  result->nsPerInstruction = best * 1e9 / (double)result->iterations;
+}
+
+static int
+run_suite (const BenchOptions *options, BenchResult *results, FILE *report)
+{
+  CPU *cpu = (CPU *)malloc (sizeof (CPU));
+  int count = 0;
+  char name[32];
+
+  for (int opcode = 0; opcode < 256; opcode++)
+    {
+      if (!is_opcode_implemented ((Byte)opcode))
+        {
+          continue;
+        }
+
+      Variant variants[3];
+      int variantCount = 0;
+      switch (opcode_info[opcode].mode)
+        {
+        case MODE_ABX:
+        case MODE_ABY:
+        case MODE_IDY:
+          variants[variantCount++] = VARIANT_BASE;
+          variants[variantCount++] = VARIANT_PAGE_CROSS;
+          break;
+        case MODE_REL:
+          variants[variantCount++] = VARIANT_TAKEN;
+          variants[variantCount++] = VARIANT_NOT_TAKEN;
+          variants[variantCount++] = VARIANT_PAGE_CROSS;
+          break;
+        default:
+          variants[variantCount++] = VARIANT_BASE;
+          break;
+        }
+
+      for (int v = 0; v < variantCount; v++)
+        {
+          format_case_name ((Byte)opcode, variants[v], name, sizeof (name));
+          if (options->filter != NULL
+              && strstr (name, options->filter) == NULL)
+            {
+              continue;
+            }
+
+          BenchResult *result = &results[count];
+          run_case (cpu, (Byte)opcode, variants[v], options, result);
+          fprintf (report, "%-24s %3d cycles %10.2f ns/instruction\n",
+                   result->name, result->cycles, result->nsPerInstruction);
+          count++;
+        }
+    }
+
+  free (cpu);
+  return count;
+}
+
+static bool
+write_json (const char *path, const BenchResult *results, int count)
+{
+  FILE *file = strcmp (path, "-") == 0 ? stdout : fopen (path, "w");
+  if (file == NULL)
+    {
+      perror (path);
+      return false;
+    }
+
+  fprintf (file, "{\n  \"benchmarks\": [\n");
+  for (int i = 0; i < count; i++)
+    {
+      const BenchResult *r = &results[i];
+      fprintf (file,
+               "    {\"name\": \"%s\", \"opcode\": %d, \"mnemonic\": \"%s\", "
+               "\"mode\": \"%s\", \"variant\": \"%s\", \"cycles\": %d, "
+               "\"iterations\": %llu, \"ns_per_instruction\": %.4f}%s\n",
+               r->name, r->opcode, opcode_info[r->opcode].mnemonic,
+               addressing_mode_name (opcode_info[r->opcode].mode),
+               variant_name (r->variant), r->cycles, r->iterations,
+               r->nsPerInstruction, i + 1 < count ? "," : "");
+    }
+  fprintf (file, "  ]\n}\n");
+
+  if (file != stdout)
+    {
+      fclose (file);
+    }
+  return true;
+}
+
+// Reads back the "name"/"ns_per_instruction" pairs written by write_json.
+// This is not a general JSON parser; it only understands our own output.
+static int
+read_json (const char *path, BenchResult *results, int capacity)
+{
+  FILE *file = fopen (path, "r");
+  if (file == NULL)
+    {
+      perror (path);
+      return -1;
+    }
+
+  char line[512];
+  int count = 0;
+  while (fgets (line, sizeof (line), file) != NULL && count < capacity)
+    {
+      char *name = strstr (line, "\"name\": \"");
+      char *ns = strstr (line, "\"ns_per_instruction\": ");
+      if (name == NULL || ns == NULL)
+        {
+          continue;
+        }
+
+      BenchResult *r = &results[count];
+      memset (r, 0, sizeof (*r));
+      name += strlen ("\"name\": \"");
+      size_t length = strcspn (name, "\"");
+      if (length >= sizeof (r->name))
+        {
+          length = sizeof (r->name) - 1;
+        }
+      memcpy (r->name, name, length);
+      r->nsPerInstruction = strtod (ns + strlen ("\"ns_per_instruction\": "),
+                                    NULL);
+      count++;
+    }
+
+  fclose (file);
+  return count;
+}
+
+static int
+compare_results (const BenchResult *baseline, int baselineCount,
+                 const BenchResult *current, int currentCount,
+                 double thresholdPercent)
+{
+  int regressions = 0;
+
+  printf ("\n%-24s %12s %12s %9s\n", "benchmark", "baseline ns", "current ns",
+          "change");
+  for (int i = 0; i < currentCount; i++)
+    {
+      const BenchResult *old = NULL;
+      for (int j = 0; j < baselineCount; j++)
+        {
+          if (strcmp (baseline[j].name, current[i].name) == 0)
+            {
+              old = &baseline[j];
+              break;
+            }
+        }
+      if (old == NULL || old->nsPerInstruction <= 0.0)
+        {
+          continue;
+        }
+
+      double change = (current[i].nsPerInstruction - old->nsPerInstruction)
+                      / old->nsPerInstruction * 100.0;
+      bool regressed = change > thresholdPercent;
+      regressions += regressed;
+      printf ("%-24s %12.2f %12.2f %+8.1f%%%s\n", current[i].name,
+              old->nsPerInstruction, current[i].nsPerInstruction, change,
+              regressed ? "  REGRESSION" : "");
+    }
+
+  printf ("\n%d regression(s) above %.1f%%\n", regressions, thresholdPercent);
+  return regressions;
+}
+
+static void
+print_usage (const char *program)
+{
+  fprintf (stderr,
+           "Usage: %s [options]\n"
+           "  -o <file>     write JSON results to file ('-' for stdout)\n"
+           "  -b <file>     compare against a saved baseline\n"
+           "  -c <file>     compare a saved result file instead of running\n"
+           "  -t <percent>  regression threshold (default 10)\n"
+           "  -f <text>     only run benchmarks whose name contains text\n"
+           "  -m <ms>       minimum time per repetition (default 10)\n"
+           "  -r <count>    repetitions, best is kept (default 5)\n",
+           program);
+}
+
+int
+main (int argc, char *argv[])
+{
+  BenchOptions options = { NULL, NULL, NULL, NULL, 10.0, 0.010, 5 };
+  int option;
+
+  while ((option = getopt (argc, argv, "o:b:c:t:f:m:r:")) != -1)
+    {
+      switch (option)
+        {
+        case 'o':
+          options.outputPath = optarg;
+          break;
+        case 'b':
+          options.baselinePath = optarg;
+          break;
+        case 'c':
+          options.currentPath = optarg;
+          break;
+        case 't':
+          options.thresholdPercent = strtod (optarg, NULL);
+          break;
+        case 'f':
+          options.filter = optarg;
+          break;
+        case 'm':
+          options.minSeconds = strtod (optarg, NULL) / 1000.0;
+          break;
+        case 'r':
+          options.repetitions = atoi (optarg);
+          break;
+        default:
+          print_usage (argv[0]);
+          return 2;
+        }
+    }
+
+  if (options.repetitions < 1)
+    {
+      options.repetitions = 1;
+    }
+
+  static BenchResult current[MAX_CASES];
+  static BenchResult baseline[MAX_CASES];
+  int currentCount;
+
+  if (options.currentPath != NULL)
+    {
+      currentCount = read_json (options.currentPath, current, MAX_CASES);
+      if (currentCount < 0)
+        {
+          return 2;
+        }
+    }
+  else
+    {
+      // Keep the human-readable table off stdout when JSON is going there.
+      bool jsonToStdout = options.outputPath != NULL
+                          && strcmp (options.outputPath, "-") == 0;
+      currentCount = run_suite (&options, current,
+                                jsonToStdout ? stderr : stdout);
+    }
+
+  if (options.outputPath != NULL
+      && !write_json (options.outputPath, current, currentCount))
+    {
+      return 2;
+    }
+
+  if (options.baselinePath != NULL)
+    {
+      int baselineCount
+          = read_json (options.baselinePath, baseline, MAX_CASES);
+      if (baselineCount < 0)
+        {
+          return 2;
+        }
+      if (compare_results (baseline, baselineCount, current, currentCount,
+                           options.thresholdPercent)
+          > 0)
+        {
+          return 1;
+        }
+    }
+
+  return 0;
+}
@@ -0,0 +1,628 @@
+#include "../code/codemap.h"
+#include "../code/cpu.h"
+#include "../code/heatmap.h"
+#include "../code/loops.h"
+#include "../code/memo.h"
+#include "../code/profile.h"
+#include "../code/support.h"
+#include "workloads.h"
+#include <getopt.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ace64_workloads.c
+ * Runs the macro benchmark corpus through the core many times and reports
+ * instructions and cycles per second with run-to-run variance.  Every run is
+ * checked against the workload's expected final state.
+ *
+ * With -p the corpus is run once more with the instrumented dispatch table on
+ * a pool of worker threads, and the merged per-opcode profile is written out.
+ * With -H (heatmap builds only) each workload's memory heatmap is dumped.
+ * With -C (code map builds only) each workload's code/data map and
+ * self-modifying code report are written.  With -M (JSR cache builds only)
+ * the corpus is rerun with a JSR result cache and must reach the same state
+ * in the same number of cycles.  With -L (loop acceleration builds only) it
+ * is rerun with native fill/copy/compare loops, under the same check.
+ */
+
+#define DEFAULT_RUNS 20
+#define INSTRUCTION_LIMIT 100000000ULL
+#define DEFAULT_PROFILE_THREADS 4
+
+typedef struct
+{
+  unsigned long long instructions;
+  unsigned long long cycles;
+  double seconds;
+  bool verified;
+} RunResult;
+
+typedef struct
+{
+  const char *name;
+  unsigned long long instructions;
+  unsigned long long cycles;
+  double meanIps;
+  double stddevIps;
+  double meanCps;
+  double minSeconds;
+  double maxSeconds;
+  int runs;
+  bool verified;
+} WorkloadSummary;
+
+typedef struct
+{
+  const Workload **queue;
+  int queueLength;
+  int next;
+  pthread_mutex_t lock;
+  OpcodeProfile total;
+  bool verified;
+} ProfilePool;
+
+static RunResult
+run_workload (CPU *cpu, const Workload *workload)
+{
+  RunResult result = { 0 };
+
+  workload_load (cpu, workload);
+
+  double start = support_now_seconds ();
+  while (cpu->PC != workload->trapAddress
+         && result.instructions < INSTRUCTION_LIMIT)
+    {
+      result.cycles += execute (cpu);
+      result.instructions++;
+    }
+  result.seconds = support_now_seconds () - start;
+
+  result.verified = workload_verify (cpu, workload)
+                    && (workload->expectedCycles == 0
+                        || result.cycles == workload->expectedCycles);
+  return result;
+}
+
+// Worker thread: takes workloads off the shared queue and runs them with a
+// private CPU and profile, folding the profile into the pool total at the end.
+static void *
+profile_worker (void *argument)
+{
+  ProfilePool *pool = (ProfilePool *)argument;
+  CPU *cpu = (CPU *)malloc (sizeof (CPU));
+  OpcodeProfile *profile = (OpcodeProfile *)calloc (1, sizeof (OpcodeProfile));
+  bool verified = true;
+
+  for (;;)
+    {
+      pthread_mutex_lock (&pool->lock);
+      int index = pool->next++;
+      pthread_mutex_unlock (&pool->lock);
+      if (index >= pool->queueLength)
+        {
+          break;
+        }
+
+      const Workload *workload = pool->queue[index];
+      workload_load (cpu, workload);
+      profile_attach (cpu, profile);
+
+      unsigned long long instructions = 0;
+      while (cpu->PC != workload->trapAddress
+             && instructions < INSTRUCTION_LIMIT)
+        {
+          execute (cpu);
+          instructions++;
+        }
+      verified = verified && workload_verify (cpu, workload);
+    }
+
+  pthread_mutex_lock (&pool->lock);
+  profile_merge (&pool->total, profile);
+  pool->verified = pool->verified && verified;
+  pthread_mutex_unlock (&pool->lock);
+
+  free (profile);
+  free (cpu);
+  return NULL;
+}
+
+static bool
+write_profile (const char *path, const Workload **queue, int queueLength,
+               int threadCount)
+{
+  ProfilePool *pool = (ProfilePool *)calloc (1, sizeof (ProfilePool));
+  pthread_t *threads = (pthread_t *)calloc (threadCount, sizeof (pthread_t));
+
+  pool->queue = queue;
+  pool->queueLength = queueLength;
+  pool->verified = true;
+  pthread_mutex_init (&pool->lock, NULL);
+
+  for (int t = 0; t < threadCount; t++)
+    {
+      pthread_create (&threads[t], NULL, profile_worker, pool);
+    }
+  for (int t = 0; t < threadCount; t++)
+    {
+      pthread_join (threads[t], NULL);
+    }
+  pthread_mutex_destroy (&pool->lock);
+
+  bool ok = pool->verified;
+  const char *extension = strrchr (path, '.');
+  FILE *file = strcmp (path, "-") == 0 ? stdout : fopen (path, "w");
+  if (file == NULL)
+    {
+      perror (path);
+      ok = false;
+    }
+  else
+    {
+      if (extension != NULL && strcmp (extension, ".csv") == 0)
+        {
+          ok = profile_write_csv (&pool->total, file) && ok;
+        }
+      else
+        {
+          ok = profile_write_json (&pool->total, file) && ok;
+        }
+      if (file != stdout)
+        {
+          fclose (file);
+        }
+    }
+
+  free (threads);
+  free (pool);
+  return ok;
+}
+
+#ifdef ACE64_HEATMAP
+static bool
+write_heatmap_file (const Heatmap *heatmap, const char *prefix,
+                    const char *name, const char *extension)
+{
+  char path[1024];
+  snprintf (path, sizeof (path), "%s-%s.%s", prefix, name, extension);
+
+  FILE *file = fopen (path, "wb");
+  if (file == NULL)
+    {
+      perror (path);
+      return false;
+    }
+  bool ok = strcmp (extension, "pgm") == 0
+                ? heatmap_write_pgm (heatmap, HEATMAP_ALL, file)
+                : heatmap_write_binary (heatmap, file);
+  return fclose (file) == 0 && ok;
+}
+
+// Reruns each workload once with a heatmap attached and writes
+// <prefix>-<name>.bin and <prefix>-<name>.pgm.
+static bool
+write_heatmaps (const char *prefix, const Workload **queue, int queueLength)
+{
+  CPU *cpu = (CPU *)malloc (sizeof (CPU));
+  Heatmap *heatmap = (Heatmap *)malloc (sizeof (Heatmap));
+  bool ok = true;
+
+  for (int i = 0; i < queueLength; i++)
+    {
+      const Workload *workload = queue[i];
+      heatmap_clear (heatmap);
+      workload_load (cpu, workload);
+      heatmap_attach (cpu, heatmap);
+
+      unsigned long long instructions = 0;
+      while (cpu->PC != workload->trapAddress
+             && instructions < INSTRUCTION_LIMIT)
+        {
+          execute (cpu);
+          instructions++;
+        }
+
+      ok = ok && workload_verify (cpu, workload)
+           && write_heatmap_file (heatmap, prefix, workload->name, "bin")
+           && write_heatmap_file (heatmap, prefix, workload->name, "pgm");
+    }
+
+  free (heatmap);
+  free (cpu);
+  return ok;
+}
+#endif
+
+#ifdef ACE64_CODEMAP
+// Reruns each workload once with a code map attached and writes
+// <prefix>-<name>.map and <prefix>-<name>.smc.
+static bool
+write_codemaps (const char *prefix, const Workload **queue, int queueLength)
+{
+  CPU *cpu = (CPU *)malloc (sizeof (CPU));
+  CodeMap *map = (CodeMap *)malloc (sizeof (CodeMap));
+  bool ok = true;
+
+  for (int i = 0; i < queueLength && ok; i++)
+    {
+      const Workload *workload = queue[i];
+      codemap_clear (map);
+      workload_load (cpu, workload);
+      codemap_attach (cpu, map);
+
+      unsigned long long instructions = 0;
+      while (cpu->PC != workload->trapAddress
+             && instructions < INSTRUCTION_LIMIT)
+        {
+          execute (cpu);
+          instructions++;
+        }
+      ok = workload_verify (cpu, workload);
+
+      char path[1024];
+      for (int report = 0; report < 2 && ok; report++)
+        {
+          snprintf (path, sizeof (path), "%s-%s.%s", prefix, workload->name,
+                    report == 0 ? "map" : "smc");
+          FILE *file = fopen (path, "w");
+          if (file == NULL)
+            {
+              perror (path);
+              ok = false;
+              break;
+            }
+          ok = report == 0 ? codemap_write_map (map, file)
+                           : codemap_write_report (map, 20, file);
+          ok = fclose (file) == 0 && ok;
+        }
+    }
+
+  free (map);
+  free (cpu);
+  return ok;
+}
+#endif
+
+#ifdef ACE64_MEMO
+// Reruns each workload once with a JSR result cache attached and reports
+// how much of it was replayed.  The cycle count must match the plain run.
+static bool
+report_memo (FILE *report, const Workload **queue,
+             const WorkloadSummary *summaries, int queueLength)
+{
+  CPU *cpu = (CPU *)malloc (sizeof (CPU));
+  Memo *memo = (Memo *)malloc (sizeof (Memo));
+  bool allVerified = true;
+
+  fprintf (report, "\n%-8s %10s %9s %9s %9s %9s %s\n", "workload", "steps",
+           "recorded", "hits", "stale", "replay%", "state");
+  for (int i = 0; i < queueLength; i++)
+    {
+      const Workload *workload = queue[i];
+      memo_clear (memo);
+      workload_load (cpu, workload);
+      memo_attach (cpu, memo);
+
+      unsigned long long steps = 0, cycles = 0;
+      while (cpu->PC != workload->trapAddress && steps < INSTRUCTION_LIMIT)
+        {
+          cycles += execute (cpu);
+          steps++;
+        }
+      bool verified = workload_verify (cpu, workload)
+                      && cycles == summaries[i].cycles;
+      allVerified = allVerified && verified;
+
+      fprintf (report, "%-8s %10llu %9llu %9llu %9llu %9.2f %s\n",
+               workload->name, steps, (unsigned long long)memo->recorded,
+               (unsigned long long)memo->hits,
+               (unsigned long long)memo->invalidated,
+               cycles != 0 ? memo->cyclesReplayed * 100.0 / cycles : 0.0,
+               verified ? "ok" : "MISMATCH");
+    }
+
+  free (memo);
+  free (cpu);
+  return allVerified;
+}
+#endif
+
+#ifdef ACE64_LOOPS
+// Reruns each workload once with native loops and reports how much of it
+// they covered.  The cycle count must match the plain run.
+static bool
+report_loops (FILE *report, const Workload **queue,
+              const WorkloadSummary *summaries, int queueLength)
+{
+  CPU *cpu = (CPU *)malloc (sizeof (CPU));
+  Loops loops;
+  bool allVerified = true;
+
+  fprintf (report, "\n%-8s %10s %7s %7s %7s %10s %9s %s\n", "workload",
+           "steps", "fills", "copies", "cmps", "iterations", "native%",
+           "state");
+  for (int i = 0; i < queueLength; i++)
+    {
+      const Workload *workload = queue[i];
+      loops_clear (&loops);
+      workload_load (cpu, workload);
+      loops_attach (cpu, &loops);
+
+      unsigned long long steps = 0, cycles = 0;
+      while (cpu->PC != workload->trapAddress && steps < INSTRUCTION_LIMIT)
+        {
+          cycles += execute (cpu);
+          steps++;
+        }
+      bool verified = workload_verify (cpu, workload)
+                      && cycles == summaries[i].cycles;
+      allVerified = allVerified && verified;
+
+      fprintf (report, "%-8s %10llu %7llu %7llu %7llu %10llu %9.2f %s\n",
+               workload->name, steps,
+               (unsigned long long)loops.runs[LOOP_FILL],
+               (unsigned long long)loops.runs[LOOP_COPY],
+               (unsigned long long)loops.runs[LOOP_COMPARE],
+               (unsigned long long)loops.iterations,
+               cycles != 0 ? loops.cycles * 100.0 / cycles : 0.0,
+               verified ? "ok" : "MISMATCH");
+    }
+
+  free (cpu);
+  return allVerified;
+}
+#endif
+
+static WorkloadSummary
+summarize (const Workload *workload, const RunResult *runs, int count)
+{
+  WorkloadSummary summary = { 0 };
+  double sumIps = 0.0, sumSquares = 0.0, sumCps = 0.0;
+
+  summary.name = workload->name;
+  summary.instructions = runs[0].instructions;
+  summary.cycles = runs[0].cycles;
+  summary.minSeconds = runs[0].seconds;
+  summary.maxSeconds = runs[0].seconds;
+  summary.runs = count;
+  summary.verified = true;
+
+  for (int i = 0; i < count; i++)
+    {
+      double ips = (double)runs[i].instructions / runs[i].seconds;
+      sumIps += ips;
+      sumSquares += ips * ips;
+      sumCps += (double)runs[i].cycles / runs[i].seconds;
+      summary.minSeconds = fmin (summary.minSeconds, runs[i].seconds);
+      summary.maxSeconds = fmax (summary.maxSeconds, runs[i].seconds);
+      summary.verified = summary.verified && runs[i].verified;
+    }
+
+  summary.meanIps = sumIps / count;
+  summary.meanCps = sumCps / count;
+  double variance = sumSquares / count - summary.meanIps * summary.meanIps;
+  summary.stddevIps = variance > 0.0 ? sqrt (variance) : 0.0;
+  return summary;
+}
+
+static bool
+write_json (const char *path, const WorkloadSummary *summaries, int count)
+{
+  FILE *file = strcmp (path, "-") == 0 ? stdout : fopen (path, "w");
+  if (file == NULL)
+    {
+      perror (path);
+      return false;
+    }
+
+  fprintf (file, "{\n  \"workloads\": [\n");
+  for (int i = 0; i < count; i++)
+    {
+      const WorkloadSummary *s = &summaries[i];
+      fprintf (file,
+               "    {\"name\": \"%s\", \"runs\": %d, \"instructions\": %llu, "
+               "\"cycles\": %llu, \"instructions_per_second\": %.0f, "
+               "\"cycles_per_second\": %.0f, \"ips_stddev\": %.0f, "
+               "\"min_seconds\": %.6f, \"max_seconds\": %.6f, "
+               "\"verified\": %s}%s\n",
+               s->name, s->runs, s->instructions, s->cycles, s->meanIps,
+               s->meanCps, s->stddevIps, s->minSeconds, s->maxSeconds,
+               s->verified ? "true" : "false", i + 1 < count ? "," : "");
+    }
+  fprintf (file, "  ]\n}\n");
+
+  if (file != stdout)
+    {
+      fclose (file);
+    }
+  return true;
+}
+
+static void
+print_usage (const char *program)
+{
+  fprintf (stderr,
+           "Usage: %s [options]\n"
+           "  -n <runs>     runs per workload (default %d)\n"
+           "  -w <name>     only run the named workload\n"
+           "  -o <file>     write JSON results to file ('-' for stdout)\n"
+           "  -p <file>     write a per-opcode profile (.csv or JSON)\n"
+           "  -j <threads>  worker threads for the profiling pass (default "
+           "%d)\n"
+#ifdef ACE64_HEATMAP
+           "  -H <prefix>   write <prefix>-<workload>.bin/.pgm heatmaps\n"
+#endif
+#ifdef ACE64_CODEMAP
+           "  -C <prefix>   write <prefix>-<workload>.map/.smc code maps\n"
+#endif
+#ifdef ACE64_MEMO
+           "  -M            rerun with a JSR result cache and report hits\n"
+#endif
+#ifdef ACE64_LOOPS
+           "  -L            rerun with native loops and report coverage\n"
+#endif
+           ,
+           program, DEFAULT_RUNS, DEFAULT_PROFILE_THREADS);
+}
+
+int
+main (int argc, char *argv[])
+{
+  const char *outputPath = NULL;
+  const char *profilePath = NULL;
+#ifdef ACE64_HEATMAP
+  const char *heatmapPrefix = NULL;
+#endif
+#ifdef ACE64_CODEMAP
+  const char *codemapPrefix = NULL;
+#endif
+#ifdef ACE64_MEMO
+  bool memoize = false;
+#endif
+#ifdef ACE64_LOOPS
+  bool nativeLoops = false;
+#endif
+  const char *only = NULL;
+  int runCount = DEFAULT_RUNS;
+  int threadCount = DEFAULT_PROFILE_THREADS;
+  int option;
+
+  while ((option = getopt (argc, argv, "n:w:o:p:j:H:C:ML")) != -1)
+    {
+      switch (option)
+        {
+        case 'n':
+          runCount = atoi (optarg);
+          break;
+        case 'w':
+          only = optarg;
+          break;
+        case 'o':
+          outputPath = optarg;
+          break;
+        case 'p':
+          profilePath = optarg;
+          break;
+        case 'j':
+          threadCount = atoi (optarg);
+          break;
+#ifdef ACE64_HEATMAP
+        case 'H':
+          heatmapPrefix = optarg;
+          break;
+#endif
+#ifdef ACE64_CODEMAP
+        case 'C':
+          codemapPrefix = optarg;
+          break;
+#endif
+#ifdef ACE64_MEMO
+        case 'M':
+          memoize = true;
+          break;
+#endif
+#ifdef ACE64_LOOPS
+        case 'L':
+          nativeLoops = true;
+          break;
+#endif
+        default:
+          print_usage (argv[0]);
+          return 2;
+        }
+    }
+  if (runCount < 1)
+    {
+      runCount = 1;
+    }
+  if (threadCount < 1)
+    {
+      threadCount = 1;
+    }
+
+  bool dataToStdout
+      = (outputPath != NULL && strcmp (outputPath, "-") == 0)
+        || (profilePath != NULL && strcmp (profilePath, "-") == 0);
+  FILE *report = dataToStdout ? stderr : stdout;
+
+  CPU *cpu = (CPU *)malloc (sizeof (CPU));
+  RunResult *runs = (RunResult *)calloc (runCount, sizeof (RunResult));
+  WorkloadSummary summaries[16];
+  const Workload *selected[16];
+  int summaryCount = 0;
+  bool allVerified = true;
+
+  fprintf (report, "%-8s %10s %11s %10s %10s %7s %s\n", "workload", "instr",
+           "cycles", "MIPS", "MHz", "cv%", "state");
+  for (int w = 0; w < workload_count; w++)
+    {
+      const Workload *workload = &workloads[w];
+      if (only != NULL && strcmp (only, workload->name) != 0)
+        {
+          continue;
+        }
+
+      for (int r = 0; r < runCount; r++)
+        {
+          runs[r] = run_workload (cpu, workload);
+        }
+
+      WorkloadSummary summary = summarize (workload, runs, runCount);
+      selected[summaryCount] = workload;
+      summaries[summaryCount++] = summary;
+      allVerified = allVerified && summary.verified;
+
+      fprintf (report, "%-8s %10llu %11llu %10.2f %10.2f %7.2f %s\n",
+               summary.name, summary.instructions, summary.cycles,
+               summary.meanIps / 1e6, summary.meanCps / 1e6,
+               summary.stddevIps / summary.meanIps * 100.0,
+               summary.verified ? "ok" : "MISMATCH");
+    }
+
+  if (outputPath != NULL)
+    {
+      write_json (outputPath, summaries, summaryCount);
+    }
+  if (profilePath != NULL)
+    {
+      allVerified = write_profile (profilePath, selected, summaryCount,
+                                   threadCount)
+                    && allVerified;
+    }
+#ifdef ACE64_HEATMAP
+  if (heatmapPrefix != NULL)
+    {
+      allVerified = write_heatmaps (heatmapPrefix, selected, summaryCount)
+                    && allVerified;
+    }
+#endif
+#ifdef ACE64_CODEMAP
+  if (codemapPrefix != NULL)
+    {
+      allVerified = write_codemaps (codemapPrefix, selected, summaryCount)
+                    && allVerified;
+    }
+#endif
+#ifdef ACE64_MEMO
+  if (memoize)
+    {
+      allVerified = report_memo (report, selected, summaries, summaryCount)
+                    && allVerified;
+    }
+#endif
+#ifdef ACE64_LOOPS
+  if (nativeLoops)
+    {
+      allVerified
+          = report_loops (report, selected, summaries, summaryCount)
+            && allVerified;
+    }
+#endif
+
+  free (runs);
+  free (cpu);
+  return allVerified ? 0 : 1;
+}
@@ -0,0 +1,433 @@
+#include "workloads.h"
+#include <string.h>
+
+/* workloads.c
+ * Hand-assembled images for the macro benchmark corpus.  Each line carries
+ * the address and source of the instruction it encodes.
+ */
+
+/* Sieve of Eratosthenes over 8192 flags at $2000-$3FFF; counts the
+ * 1028 primes below 8192 into $12/$13. */
+static const Byte sieve_image[] = {
+  0xA9, 0x00,          // $0200  start: LDA #0
+  0xA8,                // $0202  TAY
+  0xA2, 0x20,          // $0203  LDX #$20
+  0x85, 0x10,          // $0205  STA PTR
+  0xA9, 0x20,          // $0207  LDA #$20
+  0x85, 0x11,          // $0209  STA PTR+1
+  0xA9, 0x00,          // $020B  LDA #0
+  0x91, 0x10,          // $020D  clear: STA (PTR),Y
+  0xC8,                // $020F  INY
+  0xD0, 0xFB,          // $0210  BNE clear
+  0xE6, 0x11,          // $0212  INC PTR+1
+  0xCA,                // $0214  DEX
+  0xD0, 0xF6,          // $0215  BNE clear
+  0x85, 0x12,          // $0217  STA CNT
+  0x85, 0x13,          // $0219  STA CNT+1
+  0x85, 0x15,          // $021B  STA I+1
+  0xA9, 0x02,          // $021D  LDA #2
+  0x85, 0x14,          // $021F  STA I
+  0xA5, 0x14,          // $0221  loop: LDA I
+  0x85, 0x10,          // $0223  STA PTR
+  0xA5, 0x15,          // $0225  LDA I+1
+  0x18,                // $0227  CLC
+  0x69, 0x20,          // $0228  ADC #$20
+  0x85, 0x11,          // $022A  STA PTR+1
+  0xC9, 0x40,          // $022C  CMP #$40
+  0xB0, 0x38,          // $022E  BCS done
+  0xB1, 0x10,          // $0230  LDA (PTR),Y
+  0xD0, 0x2B,          // $0232  BNE next
+  0xE6, 0x12,          // $0234  INC CNT
+  0xD0, 0x02,          // $0236  BNE mult
+  0xE6, 0x13,          // $0238  INC CNT+1
+  0x18,                // $023A  mult: CLC
+  0xA5, 0x10,          // $023B  LDA PTR
+  0x65, 0x14,          // $023D  ADC I
+  0x85, 0x18,          // $023F  STA Q
+  0xA5, 0x11,          // $0241  LDA PTR+1
+  0x65, 0x15,          // $0243  ADC I+1
+  0x85, 0x19,          // $0245  STA Q+1
+  0xC9, 0x40,          // $0247  mark: CMP #$40
+  0xB0, 0x14,          // $0249  BCS next
+  0xA9, 0x01,          // $024B  LDA #1
+  0x91, 0x18,          // $024D  STA (Q),Y
+  0x18,                // $024F  CLC
+  0xA5, 0x18,          // $0250  LDA Q
+  0x65, 0x14,          // $0252  ADC I
+  0x85, 0x18,          // $0254  STA Q
+  0xA5, 0x19,          // $0256  LDA Q+1
+  0x65, 0x15,          // $0258  ADC I+1
+  0x85, 0x19,          // $025A  STA Q+1
+  0x4C, 0x47, 0x02,    // $025C  JMP mark
+  0xE6, 0x14,          // $025F  next: INC I
+  0xD0, 0xBE,          // $0261  BNE loop
+  0xE6, 0x15,          // $0263  INC I+1
+  0x4C, 0x21, 0x02,    // $0265  JMP loop
+  0x4C, 0x68, 0x02,    // $0268  done: JMP done
+};
+
+static const Byte sieve_expected[] = { 0x04, 0x04 };
+
+/* Token-threaded interpreter running the BASIC-like loop
+ *   10 S=0: I=2000  20 S=S+I  30 I=I-1  40 IF I<>0 GOTO 20
+ * through a JMP (ind) dispatch table; S and I are left at $40-$43. */
+static const Byte basic_image[] = {
+  0xA9, 0xCF,          // $0200  start: LDA #<prog
+  0x85, 0x10,          // $0202  STA IP
+  0xA9, 0x02,          // $0204  LDA #>prog
+  0x85, 0x11,          // $0206  STA IP+1
+  0xA2, 0x00,          // $0208  LDX #0
+  0xA0, 0x00,          // $020A  next: LDY #0
+  0xB1, 0x10,          // $020C  LDA (IP),Y
+  0xE6, 0x10,          // $020E  INC IP
+  0xD0, 0x02,          // $0210  BNE dispatch
+  0xE6, 0x11,          // $0212  INC IP+1
+  0x0A,                // $0214  dispatch: ASL A
+  0xA8,                // $0215  TAY
+  0xB9, 0xBF, 0x02,    // $0216  LDA table,Y
+  0x85, 0x12,          // $0219  STA JV
+  0xB9, 0xC0, 0x02,    // $021B  LDA table+1,Y
+  0x85, 0x13,          // $021E  STA JV+1
+  0x6C, 0x12, 0x00,    // $0220  JMP (JV)
+  0xA0, 0x00,          // $0223  fetch: LDY #0
+  0xB1, 0x10,          // $0225  LDA (IP),Y
+  0xE6, 0x10,          // $0227  INC IP
+  0xD0, 0x02,          // $0229  BNE fetched
+  0xE6, 0x11,          // $022B  INC IP+1
+  0x60,                // $022D  fetched: RTS
+  0x4C, 0x2E, 0x02,    // $022E  op_end: JMP op_end
+  0x20, 0x23, 0x02,    // $0231  op_push: JSR fetch
+  0x9D, 0x00, 0x03,    // $0234  STA STKLO,X
+  0x20, 0x23, 0x02,    // $0237  JSR fetch
+  0x9D, 0x80, 0x03,    // $023A  STA STKHI,X
+  0xE8,                // $023D  INX
+  0x4C, 0x0A, 0x02,    // $023E  JMP next
+  0x20, 0x23, 0x02,    // $0241  op_load: JSR fetch
+  0x0A,                // $0244  ASL A
+  0xA8,                // $0245  TAY
+  0xB9, 0x40, 0x00,    // $0246  LDA VARS,Y
+  0x9D, 0x00, 0x03,    // $0249  STA STKLO,X
+  0xB9, 0x41, 0x00,    // $024C  LDA VARS+1,Y
+  0x9D, 0x80, 0x03,    // $024F  STA STKHI,X
+  0xE8,                // $0252  INX
+  0x4C, 0x0A, 0x02,    // $0253  JMP next
+  0x20, 0x23, 0x02,    // $0256  op_store: JSR fetch
+  0x0A,                // $0259  ASL A
+  0xA8,                // $025A  TAY
+  0xCA,                // $025B  DEX
+  0xBD, 0x00, 0x03,    // $025C  LDA STKLO,X
+  0x99, 0x40, 0x00,    // $025F  STA VARS,Y
+  0xBD, 0x80, 0x03,    // $0262  LDA STKHI,X
+  0x99, 0x41, 0x00,    // $0265  STA VARS+1,Y
+  0x4C, 0x0A, 0x02,    // $0268  JMP next
+  0xCA,                // $026B  op_add: DEX
+  0x18,                // $026C  CLC
+  0xBD, 0xFF, 0x02,    // $026D  LDA STKLO-1,X
+  0x7D, 0x00, 0x03,    // $0270  ADC STKLO,X
+  0x9D, 0xFF, 0x02,    // $0273  STA STKLO-1,X
+  0xBD, 0x7F, 0x03,    // $0276  LDA STKHI-1,X
+  0x7D, 0x80, 0x03,    // $0279  ADC STKHI,X
+  0x9D, 0x7F, 0x03,    // $027C  STA STKHI-1,X
+  0x4C, 0x0A, 0x02,    // $027F  JMP next
+  0xCA,                // $0282  op_sub: DEX
+  0x38,                // $0283  SEC
+  0xBD, 0xFF, 0x02,    // $0284  LDA STKLO-1,X
+  0xFD, 0x00, 0x03,    // $0287  SBC STKLO,X
+  0x9D, 0xFF, 0x02,    // $028A  STA STKLO-1,X
+  0xBD, 0x7F, 0x03,    // $028D  LDA STKHI-1,X
+  0xFD, 0x80, 0x03,    // $0290  SBC STKHI,X
+  0x9D, 0x7F, 0x03,    // $0293  STA STKHI-1,X
+  0x4C, 0x0A, 0x02,    // $0296  JMP next
+  0xCA,                // $0299  op_jnz: DEX
+  0xBD, 0x00, 0x03,    // $029A  LDA STKLO,X
+  0x1D, 0x80, 0x03,    // $029D  ORA STKHI,X
+  0xF0, 0x0F,          // $02A0  BEQ skip
+  0x20, 0x23, 0x02,    // $02A2  op_jmp: JSR fetch
+  0x48,                // $02A5  PHA
+  0x20, 0x23, 0x02,    // $02A6  JSR fetch
+  0x85, 0x11,          // $02A9  STA IP+1
+  0x68,                // $02AB  PLA
+  0x85, 0x10,          // $02AC  STA IP
+  0x4C, 0x0A, 0x02,    // $02AE  JMP next
+  0x18,                // $02B1  skip: CLC
+  0xA5, 0x10,          // $02B2  LDA IP
+  0x69, 0x02,          // $02B4  ADC #2
+  0x85, 0x10,          // $02B6  STA IP
+  0x90, 0x02,          // $02B8  BCC skipped
+  0xE6, 0x11,          // $02BA  INC IP+1
+  0x4C, 0x0A, 0x02,    // $02BC  skipped: JMP next
+  // $02BF  table:
+  0x2E, 0x02, 0x31, 0x02, 0x41, 0x02, 0x56, 0x02, // tokens 0-7
+  0x6B, 0x02, 0x82, 0x02, 0x99, 0x02, 0xA2, 0x02,
+  // $02CF  prog:
+  0x01, 0x00, 0x00, 0x03, 0x00,            // 10 S=0
+  0x01, 0xD0, 0x07, 0x03, 0x01,            // I=2000
+  // $02D9  line20:
+  0x02, 0x00, 0x02, 0x01, 0x04, 0x03, 0x00, // 20 S=S+I
+  0x02, 0x01, 0x01, 0x01, 0x00, 0x05, 0x03, 0x01, // 30 I=I-1
+  0x02, 0x01, 0x06, 0xD9, 0x02,            // 40 IF I<>0 GOTO 20
+  0x00,                                    // 50 END
+};
+
+static const Byte basic_expected[] = { 0x68, 0x88, 0x00, 0x00 };
+
+/* Fills $0400-$04FF with a full-period 8-bit LCG sequence and insertion
+ * sorts it, leaving 0..255 in order. */
+static const Byte sort_image[] = {
+  0xA9, 0x2A,          // $0200  start: LDA #$2A
+  0xA2, 0x00,          // $0202  LDX #0
+  0x9D, 0x00, 0x04,    // $0204  gen: STA DATA,X
+  0x85, 0x10,          // $0207  STA SEED
+  0x0A,                // $0209  ASL A
+  0x0A,                // $020A  ASL A
+  0x18,                // $020B  CLC
+  0x65, 0x10,          // $020C  ADC SEED
+  0x18,                // $020E  CLC
+  0x69, 0x11,          // $020F  ADC #17
+  0xE8,                // $0211  INX
+  0xD0, 0xF0,          // $0212  BNE gen
+  0xA2, 0x01,          // $0214  LDX #1
+  0xBD, 0x00, 0x04,    // $0216  outer: LDA DATA,X
+  0x85, 0x11,          // $0219  STA KEY
+  0x8A,                // $021B  TXA
+  0xA8,                // $021C  TAY
+  0xB9, 0xFF, 0x03,    // $021D  inner: LDA DATA-1,Y
+  0xC5, 0x11,          // $0220  CMP KEY
+  0x90, 0x06,          // $0222  BCC place
+  0x99, 0x00, 0x04,    // $0224  STA DATA,Y
+  0x88,                // $0227  DEY
+  0xD0, 0xF3,          // $0228  BNE inner
+  0xA5, 0x11,          // $022A  place: LDA KEY
+  0x99, 0x00, 0x04,    // $022C  STA DATA,Y
+  0xE8,                // $022F  INX
+  0xD0, 0xE4,          // $0230  BNE outer
+  0x4C, 0x32, 0x02,    // $0232  done: JMP done
+};
+
+static const Byte sort_expected[] = { 0x00, 0x01, 0x02, 0x03 };
+
+/* Decompresses a 1 KiB LZ77 stream (literal runs and 8-bit-offset
+ * matches) to $4000-$43FF, 32 times over. */
+static const Byte lz_image[] = {
+  0xA9, 0x20,          // $0200  start: LDA #32
+  0x85, 0x17,          // $0202  STA PASS
+  0xA9, 0x72,          // $0204  again: LDA #<packed
+  0x85, 0x10,          // $0206  STA SRC
+  0xA9, 0x02,          // $0208  LDA #>packed
+  0x85, 0x11,          // $020A  STA SRC+1
+  0xA9, 0x00,          // $020C  LDA #$00
+  0x85, 0x12,          // $020E  STA DST
+  0xA9, 0x40,          // $0210  LDA #$40
+  0x85, 0x13,          // $0212  STA DST+1
+  0xA0, 0x00,          // $0214  LDY #0
+  0xB1, 0x10,          // $0216  token: LDA (SRC),Y
+  0xF0, 0x43,          // $0218  BEQ finish
+  0x20, 0x64, 0x02,    // $021A  JSR advsrc
+  0xAA,                // $021D  TAX
+  0x30, 0x10,          // $021E  BMI match
+  0xB1, 0x10,          // $0220  literal: LDA (SRC),Y
+  0x91, 0x12,          // $0222  STA (DST),Y
+  0x20, 0x64, 0x02,    // $0224  JSR advsrc
+  0x20, 0x6B, 0x02,    // $0227  JSR advdst
+  0xCA,                // $022A  DEX
+  0xD0, 0xF3,          // $022B  BNE literal
+  0x4C, 0x16, 0x02,    // $022D  JMP token
+  0x29, 0x7F,          // $0230  match: AND #$7F
+  0x18,                // $0232  CLC
+  0x69, 0x02,          // $0233  ADC #2
+  0xAA,                // $0235  TAX
+  0xB1, 0x10,          // $0236  LDA (SRC),Y
+  0x85, 0x16,          // $0238  STA OFS
+  0x20, 0x64, 0x02,    // $023A  JSR advsrc
+  0xA5, 0x12,          // $023D  LDA DST
+  0x18,                // $023F  CLC
+  0xE5, 0x16,          // $0240  SBC OFS
+  0x85, 0x14,          // $0242  STA REF
+  0xA5, 0x13,          // $0244  LDA DST+1
+  0xE9, 0x00,          // $0246  SBC #0
+  0x85, 0x15,          // $0248  STA REF+1
+  0xB1, 0x14,          // $024A  copy: LDA (REF),Y
+  0x91, 0x12,          // $024C  STA (DST),Y
+  0xE6, 0x14,          // $024E  INC REF
+  0xD0, 0x02,          // $0250  BNE copied
+  0xE6, 0x15,          // $0252  INC REF+1
+  0x20, 0x6B, 0x02,    // $0254  copied: JSR advdst
+  0xCA,                // $0257  DEX
+  0xD0, 0xF0,          // $0258  BNE copy
+  0x4C, 0x16, 0x02,    // $025A  JMP token
+  0xC6, 0x17,          // $025D  finish: DEC PASS
+  0xD0, 0xA3,          // $025F  BNE again
+  0x4C, 0x61, 0x02,    // $0261  done: JMP done
+  0xE6, 0x10,          // $0264  advsrc: INC SRC
+  0xD0, 0x02,          // $0266  BNE advsrc_done
+  0xE6, 0x11,          // $0268  INC SRC+1
+  0x60,                // $026A  advsrc_done: RTS
+  0xE6, 0x12,          // $026B  advdst: INC DST
+  0xD0, 0x02,          // $026D  BNE advdst_done
+  0xE6, 0x13,          // $026F  INC DST+1
+  0x60,                // $0271  advdst_done: RTS
+  // $0272  packed: LZ stream, 0-terminated
+  0x27, 0x50, 0x52, 0x49, 0x4E, 0x54, 0x20, 0x46,
+  0x4F, 0x58, 0x20, 0x52, 0x45, 0x41, 0x44, 0x20,
+  0x44, 0x41, 0x54, 0x41, 0x20, 0x50, 0x4F, 0x4B,
+  0x45, 0x20, 0x47, 0x4F, 0x53, 0x55, 0x42, 0x20,
+  0x54, 0x48, 0x45, 0x20, 0x4C, 0x41, 0x5A, 0x59,
+  0x83, 0x1D, 0x84, 0x05, 0x88, 0x0F, 0x15, 0x20,
+  0x4A, 0x55, 0x4D, 0x50, 0x53, 0x20, 0x42, 0x52,
+  0x4F, 0x57, 0x4E, 0x20, 0x50, 0x45, 0x45, 0x4B,
+  0x20, 0x53, 0x59, 0x53, 0x84, 0x1E, 0x82, 0x37,
+  0x85, 0x17, 0x82, 0x4C, 0x88, 0x0E, 0x04, 0x4F,
+  0x56, 0x45, 0x52, 0x85, 0x6E, 0x0A, 0x54, 0x55,
+  0x52, 0x4E, 0x20, 0x51, 0x55, 0x49, 0x43, 0x4B,
+  0x86, 0x0C, 0x84, 0x64, 0x03, 0x44, 0x4F, 0x47,
+  0x85, 0x7D, 0x83, 0x4A, 0x84, 0x37, 0x82, 0x41,
+  0x82, 0x5D, 0x83, 0x4E, 0x83, 0x17, 0x02, 0x4C,
+  0x4F, 0x87, 0x81, 0x84, 0x2D, 0x83, 0x81, 0x04,
+  0x4C, 0x49, 0x53, 0x54, 0x81, 0x0F, 0x02, 0x54,
+  0x4F, 0x84, 0x1F, 0x83, 0x0E, 0x84, 0xE3, 0x83,
+  0x14, 0x83, 0x7E, 0x84, 0x73, 0x82, 0x51, 0x82,
+  0x6A, 0x82, 0x55, 0x83, 0x16, 0x83, 0x55, 0x82,
+  0x11, 0x86, 0x93, 0x81, 0x3F, 0x84, 0x91, 0x87,
+  0x19, 0x82, 0x33, 0x83, 0x57, 0x82, 0xC1, 0x84,
+  0x34, 0x82, 0x0D, 0x82, 0x1A, 0x85, 0x2E, 0x83,
+  0xC7, 0x87, 0x0F, 0x82, 0x08, 0x84, 0xA2, 0x04,
+  0x44, 0x41, 0x54, 0x41, 0x85, 0x4D, 0x83, 0xA7,
+  0x82, 0x75, 0x88, 0xA1, 0x83, 0x4A, 0x84, 0x1D,
+  0x84, 0x2E, 0x88, 0x5B, 0x84, 0x8C, 0x84, 0x15,
+  0x84, 0x0B, 0x82, 0x7B, 0x82, 0x03, 0x83, 0xD0,
+  0x84, 0x12, 0x84, 0x3F, 0x02, 0x55, 0x4E, 0x81,
+  0x13, 0x03, 0x53, 0x55, 0x42, 0x8A, 0x67, 0x84,
+  0xFB, 0x84, 0x25, 0x84, 0x0B, 0x84, 0x26, 0x87,
+  0x3A, 0x84, 0x05, 0x85, 0x37, 0x81, 0x1A, 0x84,
+  0x69, 0x87, 0x5F, 0x82, 0x12, 0x84, 0xE3, 0x82,
+  0xC0, 0x83, 0x12, 0x84, 0x21, 0x04, 0x50, 0x4F,
+  0x4B, 0x45, 0x84, 0x04, 0x83, 0xC1, 0x84, 0x14,
+  0x82, 0x2D, 0x83, 0x76, 0x03, 0x54, 0x48, 0x45,
+  0x83, 0x03, 0x83, 0x3A, 0x82, 0x8E, 0x84, 0x3F,
+  0x83, 0xA7, 0x83, 0x34, 0x83, 0x09, 0x83, 0x4E,
+  0x03, 0x44, 0x4F, 0x47, 0x86, 0x99, 0x83, 0xB6,
+  0x10, 0x52, 0x45, 0x54, 0x55, 0x52, 0x4E, 0x20,
+  0x53, 0x59, 0x53, 0x20, 0x42, 0x52, 0x4F, 0x57,
+  0x4E, 0x88, 0x82, 0x84, 0x1F, 0x82, 0x56, 0x83,
+  0x63, 0x83, 0x77, 0x83, 0x5B, 0x82, 0xAD, 0x82,
+  0x03, 0x88, 0x46, 0x84, 0x1C, 0x84, 0x0F, 0x82,
+  0x19, 0x8A, 0xE5, 0x83, 0x75, 0x84, 0x5A, 0x82,
+  0x4B, 0x88, 0xD8, 0x83, 0x09, 0x83, 0x47, 0x82,
+  0x5E, 0x83, 0xA6, 0x83, 0x0D, 0x8C, 0xAF, 0x84,
+  0xE9, 0x83, 0x90, 0x85, 0x81, 0x83, 0xAF, 0x82,
+  0x29, 0x03, 0x4C, 0x41, 0x5A, 0x84, 0x9F, 0x82,
+  0xB2, 0x82, 0xD7, 0x84, 0x2B, 0x83, 0x40, 0x84,
+  0x70, 0x83, 0x21, 0x83, 0x46, 0x83, 0x63, 0x84,
+  0x1F, 0x82, 0x31, 0x84, 0x4F, 0x82, 0x04, 0x89,
+  0x18, 0x84, 0xBF, 0x86, 0x50, 0x83, 0x36, 0x82,
+  0xDC, 0x01, 0x59, 0x84, 0x23, 0x83, 0xAE, 0x03,
+  0x53, 0x59, 0x53, 0x83, 0x1C, 0x85, 0x95, 0x84,
+  0x5E, 0x82, 0xE5, 0x83, 0x0A, 0x82, 0x19, 0x84,
+  0x31, 0x84, 0x14, 0x83, 0xC5, 0x84, 0x55, 0x07,
+  0x51, 0x55, 0x49, 0x43, 0x4B, 0x20, 0x4F, 0x00,
+};
+
+static const Byte lz_expected[] = { 0x00, 0x44 };
+
+/* Decimal-mode score loop: adds BCD point values to an 8-digit score at
+ * $10-$13 16384 times, finishing at 04116480. */
+static const Byte bcd_image[] = {
+  0xF8,                // $0200  start: SED
+  0xA9, 0x00,          // $0201  LDA #0
+  0x85, 0x10,          // $0203  STA SCORE
+  0x85, 0x11,          // $0205  STA SCORE+1
+  0x85, 0x12,          // $0207  STA SCORE+2
+  0x85, 0x13,          // $0209  STA SCORE+3
+  0xA9, 0x40,          // $020B  LDA #64
+  0x85, 0x14,          // $020D  STA OUTER
+  0xA2, 0x00,          // $020F  round: LDX #0
+  0x8A,                // $0211  award: TXA
+  0x29, 0x0E,          // $0212  AND #$0E
+  0xA8,                // $0214  TAY
+  0x18,                // $0215  CLC
+  0xA5, 0x10,          // $0216  LDA SCORE
+  0x79, 0x3B, 0x02,    // $0218  ADC points,Y
+  0x85, 0x10,          // $021B  STA SCORE
+  0xA5, 0x11,          // $021D  LDA SCORE+1
+  0x79, 0x3C, 0x02,    // $021F  ADC points+1,Y
+  0x85, 0x11,          // $0222  STA SCORE+1
+  0xA5, 0x12,          // $0224  LDA SCORE+2
+  0x69, 0x00,          // $0226  ADC #0
+  0x85, 0x12,          // $0228  STA SCORE+2
+  0xA5, 0x13,          // $022A  LDA SCORE+3
+  0x69, 0x00,          // $022C  ADC #0
+  0x85, 0x13,          // $022E  STA SCORE+3
+  0xE8,                // $0230  INX
+  0xD0, 0xDE,          // $0231  BNE award
+  0xC6, 0x14,          // $0233  DEC OUTER
+  0xD0, 0xD8,          // $0235  BNE round
+  0xD8,                // $0237  CLD
+  0x4C, 0x38, 0x02,    // $0238  done: JMP done
+  // $023B  points:
+  0x10, 0x00, 0x25, 0x00, 0x50, 0x00, 0x00, 0x01, // BCD point values
+  0x50, 0x02, 0x00, 0x05, 0x00, 0x10, 0x75, 0x00,
+};
+
+static const Byte bcd_expected[] = { 0x80, 0x64, 0x11, 0x04 };
+
+const Workload workloads[] = {
+  { "sieve", sieve_image, sizeof (sieve_image), 0x0200, 0x0268,
+    0x0012, sieve_expected, sizeof (sieve_expected),
+    0x2000, 0x2000, 0xF8C1B3D5U, 1072541 },
+  { "basic", basic_image, sizeof (basic_image), 0x0200, 0x022E,
+    0x0040, basic_expected, sizeof (basic_expected),
+    0x0000, 0x0000, 0x00000000U, 1846395 },
+  { "sort", sort_image, sizeof (sort_image), 0x0200, 0x0232,
+    0x0400, sort_expected, sizeof (sort_expected),
+    0x0400, 0x0100, 0x90A458C5U, 326381 },
+  { "lz", lz_image, sizeof (lz_image), 0x0200, 0x0261,
+    0x0012, lz_expected, sizeof (lz_expected),
+    0x4000, 0x0400, 0x52A923ADU, 1956996 },
+  { "bcd", bcd_image, sizeof (bcd_image), 0x0200, 0x0238,
+    0x0010, bcd_expected, sizeof (bcd_expected),
+    0x0000, 0x0000, 0x00000000U, 803414 }
+};
+
+const int workload_count = sizeof (workloads) / sizeof (workloads[0]);
+
+Uint32
+workload_checksum (const Byte *data, Uint32 length)
+{
+  Uint32 hash = 0x811C9DC5U;
+  for (Uint32 i = 0; i < length; i++)
+    {
+      hash ^= data[i];
+      hash *= 0x01000193U;
+    }
+  return hash;
+}
+
+void
+workload_load (CPU *cpu, const Workload *workload)
+{
+  reset (cpu);
+  memcpy (&cpu->Memory[workload->loadAddress], workload->image,
+          workload->imageSize);
+  cpu->PC = workload->loadAddress;
+}
+
+bool
+workload_verify (const CPU *cpu, const Workload *workload)
+{
+  if (memcmp (&cpu->Memory[workload->resultAddress], workload->expected,
+              workload->expectedSize)
+      != 0)
+    {
+      return false;
+    }
+
+  if (workload->checksumLength > 0
+      && workload_checksum (&cpu->Memory[workload->checksumAddress],
+                            workload->checksumLength)
+             != workload->checksum)
+    {
+      return false;
+    }
+
+  return cpu->PC == workload->trapAddress;
+}
@@ -0,0 +1,52 @@
+#ifndef WORKLOADS_H_
+#define WORKLOADS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* workloads.h
+ * Macro benchmark corpus: small, realistic 6502 programs with their expected
+ * final state.  Each program starts at its load address and finishes in a
+ * "JMP *" trap at trapAddress.
+ */
+#include "../code/cpu.h"
+
+typedef struct
+{
+  const char *name;
+  const Byte *image;
+  Word imageSize;
+  Word loadAddress;
+  Word trapAddress;
+
+  // Result bytes expected at resultAddress when the program traps.
+  Word resultAddress;
+  const Byte *expected;
+  Word expectedSize;
+
+  // FNV-1a checksum of a larger output region; checksumLength 0 skips it.
+  Word checksumAddress;
+  Word checksumLength;
+  Uint32 checksum;
+
+  // Total cycles from entry to the trap, as counted by execute().
+  Uint32 expectedCycles;
+} Workload;
+
+extern const Workload workloads[];
+extern const int workload_count;
+
+Uint32 workload_checksum (const Byte *data, Uint32 length);
+
+// Loads the workload into a freshly reset CPU and points PC at its entry.
+void workload_load (CPU *cpu, const Workload *workload);
+
+// Returns true if the CPU's memory matches the workload's expected results.
+bool workload_verify (const CPU *cpu, const Workload *workload);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
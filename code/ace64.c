@@ -1,29 +1,240 @@
+#include "batch.h"
 #include "cpu.h"
-#include <malloc.h>
+#include "run.h"
+#include "support.h"
+#include <getopt.h>
 #include <stdio.h>
+#include <stdlib.h>
+
+#ifdef ACE64_HOSTCALL
+#include "hostcall.h"
+#endif
+
+/* ace64.c
+ * ace64: loads a program image and runs it headless until a stop condition
+ * holds (see run.h), then prints the exit reason, the work done and the
+ * registers.  The exit status is the program's own with a host call EXIT,
+ * otherwise 0, or 2 for usage and load errors.
+ *
+ * With -m, it runs a manifest of jobs instead (see batch.h) and streams one
+ * result line per job to stdout or the -o file; the exit status is 1 if any
+ * job failed.
+ */
+
+#define DEFAULT_LOAD_ADDRESS 0x0200
+#define DEFAULT_CACHE_MIB 64
+
+static void
+print_usage (const char *program)
+{
+  fprintf (stderr,
+           "Usage: %s [options] <image>\n"
+           "       %s -m <manifest> [-o <results>] [-j <threads>]\n"
+           "  -l <addr>   load address (default $%04X)\n"
+           "  -p          the image is a PRG: it starts with its load "
+           "address\n"
+           "  -e <addr>   entry PC (default: the load address)\n"
+           "  -s <addr>   stop before the instruction at addr\n"
+           "  -w <addr>   stop after a write to addr (ACE64_WATCHPOINTS)\n"
+           "  -c <count>  cycle limit\n"
+           "  -i <count>  instruction limit\n"
+           "  -b          run through BRK instead of stopping\n"
+           "  -H <dir>    serve host calls, with files in dir "
+           "(ACE64_HOSTCALL)\n"
+           "  -m <file>   run the jobs in a manifest\n"
+           "  -o <file>   write batch results to file (default stdout)\n"
+           "  -j <count>  batch threads (default: one per processor)\n"
+           "  -C <file>   cache batch results in file\n"
+           "  -M <MiB>    result cache size (default %d)\n",
+           program, program, DEFAULT_LOAD_ADDRESS, DEFAULT_CACHE_MIB);
+}
+
+static int
+run_batch (const char *manifest, const char *resultsPath,
+           const BatchOptions *options)
+{
+  FILE *out = stdout;
+  if (resultsPath != NULL && (out = fopen (resultsPath, "w")) == NULL)
+    {
+      perror (resultsPath);
+      return 2;
+    }
+
+  BatchStats stats;
+  bool ok = batch_run (manifest, out, options, &stats);
+  if (out != stdout)
+    {
+      fclose (out);
+    }
+  if (!ok)
+    {
+      fprintf (stderr, "%s: batch failed\n", manifest);
+      return 2;
+    }
+
+  fprintf (stderr, "jobs: %llu, failed: %llu, cached: %llu, "
+           "instructions: %llu, cycles: %llu\n",
+           (unsigned long long)stats.jobs, (unsigned long long)stats.failed,
+           (unsigned long long)stats.cached,
+           (unsigned long long)stats.instructions,
+           (unsigned long long)stats.cycles);
+  return stats.failed != 0 ? 1 : 0;
+}
 
 int
 main (int argc, char *argv[])
 {
+  RunStops *stops = (RunStops *)malloc (sizeof (RunStops));
+  run_stops_init (stops);
+  Word loadAddress = DEFAULT_LOAD_ADDRESS;
+  Word entryPoint = 0;
+  bool entryGiven = false;
+  bool prg = false;
+  const char *hostDirectory = NULL;
+  const char *manifest = NULL;
+  const char *resultsPath = NULL;
+  BatchOptions batchOptions = { 0 };
+  batchOptions.cacheSize = (size_t)DEFAULT_CACHE_MIB << 20;
+  Word address;
+  int option;
+
+  while ((option = getopt (argc, argv, "l:pe:s:w:c:i:bH:m:o:j:C:M:")) != -1)
+    {
+      switch (option)
+        {
+        case 'l':
+        case 'e':
+        case 's':
+        case 'w':
+          if (!support_parse_address (optarg, &address))
+            {
+              fprintf (stderr, "Invalid address: %s\n", optarg);
+              free (stops);
+              return 2;
+            }
+          if (option == 'l')
+            loadAddress = address;
+          else if (option == 'e')
+            {
+              entryPoint = address;
+              entryGiven = true;
+            }
+          else if (option == 's' ? !run_stop_at (stops, address)
+                                 : !run_stop_on_write (stops, address))
+            {
+              fprintf (stderr, "Cannot stop at $%04X%s\n", address,
+                       option == 'w' ? " (needs ACE64_WATCHPOINTS)" : "");
+              free (stops);
+              return 2;
+            }
+          break;
+        case 'p':
+          prg = true;
+          break;
+        case 'c':
+          stops->maxCycles = strtoull (optarg, NULL, 10);
+          break;
+        case 'i':
+          stops->maxInstructions = strtoull (optarg, NULL, 10);
+          break;
+        case 'b':
+          stops->brk = false;
+          break;
+        case 'H':
+          hostDirectory = optarg;
+          break;
+        case 'm':
+          manifest = optarg;
+          break;
+        case 'o':
+          resultsPath = optarg;
+          break;
+        case 'j':
+          batchOptions.threads = atoi (optarg);
+          break;
+        case 'C':
+          batchOptions.cachePath = optarg;
+          break;
+        case 'M':
+          batchOptions.cacheSize = strtoull (optarg, NULL, 10) << 20;
+          break;
+        default:
+          print_usage (argv[0]);
+          free (stops);
+          return 2;
+        }
+    }
+
+  if (manifest != NULL && optind == argc)
+    {
+      free (stops);
+      return run_batch (manifest, resultsPath, &batchOptions);
+    }
+  if (manifest != NULL || optind != argc - 1)
+    {
+      print_usage (argv[0]);
+      free (stops);
+      return 2;
+    }
+
   CPU *cpu = (CPU *)malloc (sizeof (CPU));
   reset (cpu);
+  long loaded = support_load_image (cpu, argv[optind], loadAddress, prg);
+  if (loaded < 0)
+    {
+      free (cpu);
+      free (stops);
+      return 2;
+    }
+  cpu->PC = entryGiven ? entryPoint : (Word)loaded;
 
-  printf (
-      "CPU Initialized\nP = %x, PC = %x, SP = %x, Y = %x, X = %x, A = %x\n",
-      cpu->P, cpu->PC, cpu->SP, cpu->Y, cpu->X, cpu->A);
-  printf ("Data - first 2 bytes: %X, %X\n", cpu->Memory[0x00],
-          cpu->Memory[0x01]);
-  Sint32 Cycles = 0;
+#ifdef ACE64_HOSTCALL
+  HostCalls *calls = NULL;
+  if (hostDirectory != NULL)
+    {
+      calls = hostcall_create (HOSTCALL_DEFAULT_OPCODE, false);
+      if (calls == NULL || !hostcall_install_standard (calls, hostDirectory))
+        {
+          fprintf (stderr, "Cannot set up host calls\n");
+          hostcall_destroy (calls);
+          free (cpu);
+          free (stops);
+          return 2;
+        }
+      hostcall_attach (cpu, calls);
+    }
+#else
+  if (hostDirectory != NULL)
+    {
+      fprintf (stderr, "Host calls need ACE64_HOSTCALL\n");
+      free (cpu);
+      free (stops);
+      return 2;
+    }
+#endif
 
-  cpu->Y = 0x02;
-  cpu->X = 0x37;
-  cpu->Memory[0xFFFC] = 0x96;
-  cpu->Memory[0xFFFD] = 0x04;
-  cpu->Memory[0x0006] = 0x00;
+  RunExit result = run_until (cpu, stops);
 
-  Cycles = execute (cpu);
+  printf ("exit: %s at $%04X", run_exit_name (result.reason), result.pc);
+  if (result.reason == RUN_EXIT_WRITE)
+    {
+      printf (" ($%02X to $%04X)", result.value, result.address);
+    }
+  else if (result.reason == RUN_EXIT_HOST)
+    {
+      printf (" (status %u)", result.value);
+    }
+  printf ("\ninstructions: %llu, cycles: %llu\n",
+          (unsigned long long)result.instructions,
+          (unsigned long long)result.cycles);
+  printf ("A = %02X, X = %02X, Y = %02X, P = %02X, SP = %02X\n", cpu->A,
+          cpu->X, cpu->Y, cpu->P, cpu->SP);
 
-  printf("Cycles used: %d, Value at 0x0006: %d\n", Cycles, cpu->Memory[0x0006]);
+  int status = result.reason == RUN_EXIT_HOST ? result.value : 0;
+#ifdef ACE64_HOSTCALL
+  hostcall_destroy (calls);
+#endif
   free (cpu);
-  return (0);
+  free (stops);
+  return status;
 }
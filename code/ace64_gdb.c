@@ -0,0 +1,122 @@
+#include "cpu.h"
+#include "gdbstub.h"
+#include "support.h"
+#include "writers.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/* ace64_gdb.c
+ * ace64-gdb: loads a raw image and serves it to a GDB remote serial
+ * protocol client.  Sessions are served one after another on the same
+ * machine state until a client kills the target.  Builds with
+ * ACE64_LAST_WRITER record the last writer of every address for the
+ * "monitor writer" command.
+ */
+
+#define DEFAULT_LISTEN_ADDRESS "6502"
+
+static void
+print_usage (const char *program)
+{
+  fprintf (stderr,
+           "Usage: %s [options] <image>\n"
+           "  -l <addr>     load address (default $0000)\n"
+           "  -e <addr>     entry PC (default: the reset vector)\n"
+           "  -a <address>  [host:]port or Unix socket path to listen on "
+           "(default %s)\n",
+           program, DEFAULT_LISTEN_ADDRESS);
+}
+
+int
+main (int argc, char *argv[])
+{
+  const char *listenAddress = DEFAULT_LISTEN_ADDRESS;
+  Word loadAddress = 0;
+  long entryPoint = -1;
+  Word address;
+  int option;
+
+  while ((option = getopt (argc, argv, "l:e:a:")) != -1)
+    {
+      switch (option)
+        {
+        case 'l':
+        case 'e':
+          if (!support_parse_address (optarg, &address))
+            {
+              fprintf (stderr, "Invalid address: %s\n", optarg);
+              return 2;
+            }
+          if (option == 'l')
+            loadAddress = address;
+          else
+            entryPoint = address;
+          break;
+        case 'a':
+          listenAddress = optarg;
+          break;
+        default:
+          print_usage (argv[0]);
+          return 2;
+        }
+    }
+
+  if (optind != argc - 1)
+    {
+      print_usage (argv[0]);
+      return 2;
+    }
+
+  CPU *cpu = (CPU *)malloc (sizeof (CPU));
+  reset (cpu);
+  if (support_load_image (cpu, argv[optind], loadAddress, false) < 0)
+    {
+      free (cpu);
+      return 2;
+    }
+  cpu->PC = entryPoint >= 0
+                ? (Word)entryPoint
+                : get_word_address (cpu->Memory[0xFFFC], cpu->Memory[0xFFFD]);
+
+#ifdef ACE64_LAST_WRITER
+  LastWriters *writers = (LastWriters *)malloc (sizeof (LastWriters));
+  writers_clear (writers);
+  writers_attach (cpu, writers);
+#endif
+
+  int listener = gdbstub_listen (listenAddress);
+  if (listener < 0)
+    {
+      perror (listenAddress);
+#ifdef ACE64_LAST_WRITER
+      free (writers);
+#endif
+      free (cpu);
+      return 2;
+    }
+  printf ("Listening on %s, PC $%04X\n", listenAddress, cpu->PC);
+  fflush (stdout);
+
+  GdbSessionEnd end = GDB_DETACHED;
+  while (end != GDB_KILLED)
+    {
+      int client = accept (listener, NULL, NULL);
+      if (client < 0)
+        {
+          perror ("accept");
+          break;
+        }
+      end = gdbstub_serve (cpu, client);
+      close (client);
+    }
+
+  close (listener);
+#ifdef ACE64_LAST_WRITER
+  free (writers);
+#endif
+  free (cpu);
+  return end == GDB_KILLED ? 0 : 1;
+}
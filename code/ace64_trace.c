@@ -0,0 +1,229 @@
+#include "cpu.h"
+#include "opinfo.h"
+#include "trace.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+/* ace64_trace.c
+ * ace64-trace: decodes, filters and disassembles execution trace dumps
+ * written by trace_write().  Record cycle stamps hold only the low 32 bits;
+ * the decoder extends them across wraparound assuming the first record was
+ * written before the 2^32nd cycle.
+ */
+
+typedef struct
+{
+  long pcLow, pcHigh;
+  unsigned long long cycleLow, cycleHigh;
+  const char *mnemonic;
+  unsigned long last;
+  bool summary;
+} TraceFilter;
+
+static void
+print_usage (const char *program)
+{
+  fprintf (stderr,
+           "Usage: %s [options] <dump>\n"
+           "  -a <lo>[-<hi>]  only instructions at these PCs (hex)\n"
+           "  -c <lo>[-<hi>]  only instructions starting in this cycle range\n"
+           "  -m <mnemonic>   only this instruction, e.g. -m JSR\n"
+           "  -n <count>      only the last count matching records\n"
+           "  -s              print a summary instead of the listing\n",
+           program);
+}
+
+static bool
+parse_range (const char *text, int base, unsigned long long *low,
+             unsigned long long *high)
+{
+  char *end;
+  if (*text == '$')
+    {
+      text++;
+    }
+
+  *low = strtoull (text, &end, base);
+  if (end == text)
+    {
+      return false;
+    }
+  if (*end == '\0')
+    {
+      *high = *low;
+      return true;
+    }
+  if (*end != '-')
+    {
+      return false;
+    }
+
+  text = end + 1;
+  if (*text == '$')
+    {
+      text++;
+    }
+  *high = strtoull (text, &end, base);
+  return end != text && *end == '\0' && *high >= *low;
+}
+
+static bool
+matches (const TraceFilter *filter, const TraceRecord *record,
+         unsigned long long cycle)
+{
+  return record->pc >= filter->pcLow && record->pc <= filter->pcHigh
+         && cycle >= filter->cycleLow && cycle <= filter->cycleHigh
+         && (filter->mnemonic == NULL
+             || strcasecmp (filter->mnemonic,
+                            opcode_info[record->opcode].mnemonic)
+                    == 0);
+}
+
+static void
+print_record (unsigned long long sequence, unsigned long long cycle,
+              const TraceRecord *record)
+{
+  Byte bytes[3] = { record->opcode, record->operands[0],
+                    record->operands[1] };
+  char text[32];
+  char hex[12];
+  Byte length = disassemble (bytes, record->pc, text, sizeof (text));
+
+  if (length == 1)
+    snprintf (hex, sizeof (hex), "%02X", bytes[0]);
+  else if (length == 2)
+    snprintf (hex, sizeof (hex), "%02X %02X", bytes[0], bytes[1]);
+  else
+    snprintf (hex, sizeof (hex), "%02X %02X %02X", bytes[0], bytes[1],
+              bytes[2]);
+
+  printf ("%10llu %12llu  $%04X  %-8s  %-14s A:%02X X:%02X Y:%02X P:%02X "
+          "SP:%02X  %u\n",
+          sequence, cycle, record->pc, hex, text, record->a, record->x,
+          record->y, record->p, record->sp, record->cycles);
+}
+
+int
+main (int argc, char *argv[])
+{
+  TraceFilter filter = { 0, 0xFFFF, 0, ~0ULL, NULL, 0, false };
+  unsigned long long low, high;
+  int option;
+
+  while ((option = getopt (argc, argv, "a:c:m:n:s")) != -1)
+    {
+      switch (option)
+        {
+        case 'a':
+          if (!parse_range (optarg, 16, &low, &high) || high > 0xFFFF)
+            {
+              fprintf (stderr, "Invalid address range: %s\n", optarg);
+              return 2;
+            }
+          filter.pcLow = (long)low;
+          filter.pcHigh = (long)high;
+          break;
+        case 'c':
+          if (!parse_range (optarg, 10, &filter.cycleLow, &filter.cycleHigh))
+            {
+              fprintf (stderr, "Invalid cycle range: %s\n", optarg);
+              return 2;
+            }
+          break;
+        case 'm':
+          filter.mnemonic = optarg;
+          break;
+        case 'n':
+          filter.last = strtoul (optarg, NULL, 10);
+          break;
+        case 's':
+          filter.summary = true;
+          break;
+        default:
+          print_usage (argv[0]);
+          return 2;
+        }
+    }
+
+  if (optind != argc - 1)
+    {
+      print_usage (argv[0]);
+      return 2;
+    }
+
+  FILE *file = fopen (argv[optind], "rb");
+  if (file == NULL)
+    {
+      perror (argv[optind]);
+      return 2;
+    }
+
+  TraceRecord *records;
+  Uint32 count;
+  Uint64 firstSequence;
+  bool ok = trace_read (file, &records, &count, &firstSequence);
+  fclose (file);
+  if (!ok)
+    {
+      fprintf (stderr, "%s: not a readable trace dump\n", argv[optind]);
+      return 2;
+    }
+
+  // Extend the 32-bit cycle stamps, then mark which records pass the filter.
+  unsigned long long *cycles
+      = (unsigned long long *)malloc ((count + 1) * sizeof (*cycles));
+  bool *selected = (bool *)malloc (count + 1);
+  unsigned long long cycle = 0;
+  unsigned long matched = 0;
+
+  for (Uint32 i = 0; i < count; i++)
+    {
+      if (i == 0)
+        cycle = records[0].cycle;
+      else
+        cycle += (Uint32)(records[i].cycle - records[i - 1].cycle);
+      cycles[i] = cycle;
+      selected[i] = matches (&filter, &records[i], cycle);
+      matched += selected[i];
+    }
+
+  unsigned long skip
+      = filter.last != 0 && matched > filter.last ? matched - filter.last : 0;
+
+  if (filter.summary)
+    {
+      printf ("records:   %u (sequence %llu..%llu)\n", count,
+              (unsigned long long)firstSequence,
+              (unsigned long long)(firstSequence + count - (count > 0)));
+      if (count > 0)
+        {
+          printf ("cycles:    %llu..%llu\n", cycles[0],
+                  cycles[count - 1] + records[count - 1].cycles);
+        }
+      printf ("matching:  %lu\n", matched - skip);
+    }
+  else
+    {
+      for (Uint32 i = 0; i < count; i++)
+        {
+          if (!selected[i])
+            {
+              continue;
+            }
+          if (skip > 0)
+            {
+              skip--;
+              continue;
+            }
+          print_record (firstSequence + i, cycles[i], &records[i]);
+        }
+    }
+
+  free (selected);
+  free (cycles);
+  free (records);
+  return 0;
+}
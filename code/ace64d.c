@@ -0,0 +1,178 @@
+#include "cpu.h"
+#include "jobserver.h"
+#include "run.h"
+#include "support.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* ace64d.c
+ * ace64d: builds base snapshots from ROM and program images, boots them,
+ * and serves jobs against them on a Unix socket until it is killed (see
+ * jobserver.h for the protocol).  Options before -n describe base 0, those
+ * after each -n the next base.
+ */
+
+static void
+print_usage (const char *program)
+{
+  fprintf (stderr,
+           "Usage: %s [options] <socket path>\n"
+           "  -r <file>[@<addr>]  load an image into the base (default "
+           "$0000)\n"
+           "  -b <addr>   boot the base from addr before serving it\n"
+           "  -s <addr>   end the boot before the instruction at addr\n"
+           "  -c <count>  boot cycle limit\n"
+           "  -n          start the next base\n"
+           "  -j <count>  worker threads (default: one per processor)\n"
+           "  -k <count>  jobs in flight per client (default %d)\n",
+           program, JOBSERVER_DEFAULT_CLIENT_LIMIT);
+}
+
+// Loads "file[@addr]" into cpu.
+static bool
+load_image (CPU *cpu, char *spec)
+{
+  Word loadAddress = 0;
+  char *at = strrchr (spec, '@');
+  if (at != NULL)
+    {
+      *at = '\0';
+      if (!support_parse_address (at + 1, &loadAddress))
+        {
+          fprintf (stderr, "Invalid address: %s\n", at + 1);
+          return false;
+        }
+    }
+  return support_load_image (cpu, spec, loadAddress, false) >= 0;
+}
+
+// Boots the base if asked to and keeps a copy of it in bases.
+static bool
+finish_base (CPU **bases, int *baseCount, CPU *cpu, RunStops *stops,
+             bool boot, Word bootPC)
+{
+  if (*baseCount == JOBSERVER_MAX_BASES)
+    {
+      fprintf (stderr, "Too many bases\n");
+      return false;
+    }
+  if (boot)
+    {
+      cpu->PC = bootPC;
+      RunExit result = run_until (cpu, stops);
+      fprintf (stderr, "base %d boot: %s at $%04X after %llu cycles\n",
+               *baseCount, run_exit_name (result.reason), cpu->PC,
+               (unsigned long long)result.cycles);
+    }
+  else
+    {
+      cpu->PC = get_word_address (cpu->Memory[0xFFFC], cpu->Memory[0xFFFD]);
+    }
+
+  CPU *base = (CPU *)malloc (sizeof (CPU));
+  if (base == NULL)
+    {
+      return false;
+    }
+  memcpy (base, cpu, sizeof (CPU));
+  bases[(*baseCount)++] = base;
+
+  reset (cpu);
+  run_stops_init (stops);
+  return true;
+}
+
+int
+main (int argc, char *argv[])
+{
+  JobServerOptions options = { 0 };
+  CPU *bases[JOBSERVER_MAX_BASES];
+  int baseCount = 0;
+  CPU *cpu = (CPU *)malloc (sizeof (CPU));
+  RunStops *stops = (RunStops *)malloc (sizeof (RunStops));
+  reset (cpu);
+  run_stops_init (stops);
+
+  bool ok = true;
+  bool boot = false;
+  Word bootPC = 0;
+  Word address;
+  int option;
+
+  while (ok && (option = getopt (argc, argv, "r:b:s:c:nj:k:")) != -1)
+    {
+      switch (option)
+        {
+        case 'r':
+          ok = load_image (cpu, optarg);
+          break;
+        case 'b':
+        case 's':
+          ok = support_parse_address (optarg, &address);
+          if (!ok)
+            fprintf (stderr, "Invalid address: %s\n", optarg);
+          else if (option == 'b')
+            {
+              boot = true;
+              bootPC = address;
+            }
+          else
+            ok = run_stop_at (stops, address);
+          break;
+        case 'c':
+          stops->maxCycles = strtoull (optarg, NULL, 10);
+          break;
+        case 'n':
+          ok = finish_base (bases, &baseCount, cpu, stops, boot, bootPC);
+          boot = false;
+          break;
+        case 'j':
+          options.threads = atoi (optarg);
+          break;
+        case 'k':
+          options.clientLimit = atoi (optarg);
+          break;
+        default:
+          print_usage (argv[0]);
+          ok = false;
+        }
+    }
+  if (ok && optind != argc - 1)
+    {
+      print_usage (argv[0]);
+      ok = false;
+    }
+  ok = ok && finish_base (bases, &baseCount, cpu, stops, boot, bootPC);
+  free (cpu);
+  free (stops);
+
+  JobServer *server = ok ? jobserver_create (&options) : NULL;
+  for (int b = 0; b < baseCount; b++)
+    {
+      if (server != NULL)
+        {
+          jobserver_add_base (server, bases[b]);
+          fprintf (stderr, "base %d ready, PC $%04X\n", b, bases[b]->PC);
+        }
+      free (bases[b]);
+    }
+
+  int listener = server != NULL ? jobserver_listen (argv[optind]) : -1;
+  if (server != NULL && listener < 0)
+    {
+      perror (argv[optind]);
+    }
+  ok = listener >= 0;
+  if (ok)
+    {
+      fprintf (stderr, "Listening on %s\n", argv[optind]);
+      ok = jobserver_serve (server, listener);
+      close (listener);
+      unlink (argv[optind]);
+    }
+  jobserver_destroy (server);
+  return ok ? 0 : 2;
+}
@@ -0,0 +1,596 @@
+#include "basicfp.h"
+#include "opcodes.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Scratch space for verification: the memory operand, and the address the
+// routines return to.
+#define OPERAND 0x033C
+#define RETURN 0x03F0
+#define MAX_ROM_STEPS 200000
+
+const Word basicfp_entries[BASICFP_ROUTINES] = {
+  0xB850, 0xB853, 0xB867, 0xB86A, 0xBA28, 0xBA2B, 0xBB0F, 0xBB12,
+};
+
+static bool
+uses_operand (BasicFpRoutine routine)
+{
+  return routine == BASICFP_FSUB || routine == BASICFP_FADD
+         || routine == BASICFP_FMULT || routine == BASICFP_FDIV;
+}
+
+BasicFloat
+basicfp_unpack (const Byte *packed)
+{
+  BasicFloat value;
+  value.exponent = packed[0];
+  value.mantissa = (Uint32)(packed[1] | 0x80) << 24 | (Uint32)packed[2] << 16
+                   | (Uint32)packed[3] << 8 | packed[4];
+  value.rounding = 0;
+  value.sign = packed[1] & 0x80;
+  return value;
+}
+
+void
+basicfp_pack (BasicFloat value, Byte *packed)
+{
+  // An all-ones mantissa at the top exponent would overflow: the ROM raises
+  // an error there, so it is packed unrounded.
+  if (value.exponent != 0 && (value.rounding & 0x80)
+      && !(value.mantissa == 0xFFFFFFFF && value.exponent == 0xFF))
+    {
+      if (++value.mantissa == 0)
+        {
+          value.mantissa = 0x80000000;
+          value.exponent++;
+        }
+    }
+  packed[0] = value.exponent;
+  packed[1] = (value.mantissa >> 24 & 0x7F) | (value.sign & 0x80);
+  packed[2] = value.mantissa >> 16;
+  packed[3] = value.mantissa >> 8;
+  packed[4] = value.mantissa;
+}
+
+static void
+zero (BasicFloat *value)
+{
+  value->exponent = 0;
+  value->sign = 0;
+}
+
+// Stores a 40-bit mantissa (with the rounding byte) shifted left until its
+// top bit is set, decrementing exponent as the ROM's normalization does.
+static void
+normalize (BasicFloat *value, int exponent, Uint64 bits)
+{
+  if (bits == 0)
+    {
+      zero (value);
+      return;
+    }
+  while (!(bits & (1ULL << 39)))
+    {
+      bits <<= 1;
+      if (--exponent < 1)
+        {
+          zero (value);
+          return;
+        }
+    }
+  value->exponent = exponent;
+  value->mantissa = bits >> 8;
+  value->rounding = bits & 0xFF;
+}
+
+bool
+basicfp_from_host (long double host, BasicFloat *value)
+{
+  if (host == 0)
+    {
+      memset (value, 0, sizeof (*value));
+      return true;
+    }
+  int exponent;
+  long double fraction = frexpl (fabsl (host), &exponent);
+  if (exponent + 128 > 0xFF)
+    {
+      return false;
+    }
+  value->sign = host < 0 ? 0x80 : 0;
+  normalize (value, exponent + 128, (Uint64)ldexpl (fraction, 40));
+  return true;
+}
+
+long double
+basicfp_to_host (BasicFloat value)
+{
+  if (value.exponent == 0)
+    {
+      return 0;
+    }
+  Uint64 bits = (Uint64)value.mantissa << 8 | value.rounding;
+  long double host = ldexpl ((long double)bits, value.exponent - 128 - 40);
+  return value.sign & 0x80 ? -host : host;
+}
+
+static BasicFloat
+load (const CPU *cpu, Word address)
+{
+  BasicFloat value;
+  value.exponent = cpu->Memory[address];
+  value.mantissa = (Uint32)cpu->Memory[address + 1] << 24
+                   | (Uint32)cpu->Memory[address + 2] << 16
+                   | (Uint32)cpu->Memory[address + 3] << 8
+                   | cpu->Memory[address + 4];
+  value.rounding = 0;
+  value.sign = cpu->Memory[address + 5];
+  return value;
+}
+
+static void
+poke (CPU *cpu, Word address, Byte value)
+{
+  Sint32 cycles = 0;
+  write_byte (cpu, address, value, &cycles);
+}
+
+static void
+store (CPU *cpu, Word address, BasicFloat value)
+{
+  poke (cpu, address, value.exponent);
+  poke (cpu, address + 1, value.mantissa >> 24);
+  poke (cpu, address + 2, value.mantissa >> 16);
+  poke (cpu, address + 3, value.mantissa >> 8);
+  poke (cpu, address + 4, value.mantissa);
+  poke (cpu, address + 5, value.sign);
+}
+
+BasicFloat
+basicfp_fac (const CPU *cpu)
+{
+  BasicFloat fac = load (cpu, BASICFP_FAC);
+  fac.rounding = cpu->Memory[BASICFP_ROUNDING];
+  return fac;
+}
+
+void
+basicfp_set_fac (CPU *cpu, BasicFloat value)
+{
+  store (cpu, BASICFP_FAC, value);
+  poke (cpu, BASICFP_ROUNDING, value.rounding);
+}
+
+// FADDT.  The smaller operand is shifted right through its rounding byte,
+// ARG's starting at zero, and bits shifted past it are lost.
+static bool
+add (BasicFloat *fac, const BasicFloat *arg)
+{
+  if (arg->exponent == 0)
+    {
+      return true;
+    }
+  if (fac->exponent == 0)
+    {
+      *fac = *arg;
+      fac->rounding = 0;
+      return true;
+    }
+
+  Uint64 facBits = (Uint64)fac->mantissa << 8 | fac->rounding;
+  Uint64 argBits = (Uint64)arg->mantissa << 8;
+  bool argLarger = arg->exponent > fac->exponent;
+  int exponent = argLarger ? arg->exponent : fac->exponent;
+  int shift = argLarger ? arg->exponent - fac->exponent
+                        : fac->exponent - arg->exponent;
+  Uint64 large = argLarger ? argBits : facBits;
+  Uint64 small = argLarger ? facBits : argBits;
+  Byte largeSign = argLarger ? arg->sign : fac->sign;
+  Byte smallSign = argLarger ? fac->sign : arg->sign;
+  small = shift >= 40 ? 0 : small >> shift;
+
+  Uint64 bits;
+  Byte sign = largeSign & 0x80;
+  if (!((largeSign ^ smallSign) & 0x80))
+    {
+      bits = large + small;
+      if (bits >> 40)
+        {
+          if (exponent == 0xFF)
+            {
+              return false;
+            }
+          bits >>= 1;
+          exponent++;
+        }
+    }
+  else if (large >= small)
+    {
+      bits = large - small;
+    }
+  else
+    {
+      bits = small - large;
+      sign = smallSign & 0x80;
+    }
+  fac->sign = sign;
+  normalize (fac, exponent, bits);
+  return true;
+}
+
+// FMULTT
+static bool
+multiply (BasicFloat *fac, const BasicFloat *arg)
+{
+  if (fac->exponent == 0)
+    {
+      return true;
+    }
+  if (arg->exponent == 0)
+    {
+      zero (fac);
+      return true;
+    }
+  int exponent = fac->exponent + arg->exponent - 128;
+  // ADD_EXPONENTS: an overflow is an error, an underflow zero
+  if (exponent > 0xFF)
+    {
+      return false;
+    }
+  if (exponent < 1)
+    {
+      zero (fac);
+      return true;
+    }
+
+  // One multiplier byte at a time, from the rounding byte up.  Each bit
+  // adds ARG into the 32-bit product, then shifts the product right into
+  // the rounding byte; a zero byte shifts a whole byte at once.
+  Byte multiplier[5] = { fac->rounding, fac->mantissa, fac->mantissa >> 8,
+                         fac->mantissa >> 16, fac->mantissa >> 24 };
+  Uint32 product = 0;
+  Byte low = 0;
+  for (int i = 0; i < 5; i++)
+    {
+      if (multiplier[i] == 0)
+        {
+          low = product;
+          product >>= 8;
+          continue;
+        }
+      for (int bit = 0; bit < 8; bit++)
+        {
+          Uint64 sum = product;
+          if (multiplier[i] >> bit & 1)
+            {
+              sum += arg->mantissa;
+            }
+          low = low >> 1 | (Byte)(sum << 7);
+          product = sum >> 1;
+        }
+    }
+  fac->sign = (fac->sign ^ arg->sign) & 0x80;
+  normalize (fac, exponent, (Uint64)product << 8 | low);
+  return true;
+}
+
+// FDIVT.  FAC is rounded first; the quotient gets 34 bits, its first
+// weighing 1, by restoring division.
+static bool
+divide (BasicFloat *fac, const BasicFloat *arg)
+{
+  if (fac->exponent == 0)
+    {
+      return false;
+    }
+  BasicFloat divisor = *fac;
+  if (divisor.rounding & 0x80)
+    {
+      if (++divisor.mantissa == 0)
+        {
+          if (divisor.exponent == 0xFF)
+            {
+              return false;
+            }
+          divisor.mantissa = 0x80000000;
+          divisor.exponent++;
+        }
+    }
+  if (arg->exponent == 0)
+    {
+      zero (fac);
+      return true;
+    }
+  int exponent = arg->exponent - divisor.exponent + 128;
+  // ADD_EXPONENTS: an overflow is an error, an underflow zero
+  if (exponent > 0xFF)
+    {
+      return false;
+    }
+  if (exponent < 1)
+    {
+      zero (fac);
+      return true;
+    }
+  if (++exponent > 0xFF)
+    {
+      return false;
+    }
+
+  Uint64 remainder = arg->mantissa;
+  Uint64 quotient = 0;
+  for (int bit = 0; bit < 34; bit++)
+    {
+      quotient <<= 1;
+      if (remainder >= divisor.mantissa)
+        {
+          remainder -= divisor.mantissa;
+          quotient |= 1;
+        }
+      remainder <<= 1;
+    }
+  fac->sign = (fac->sign ^ arg->sign) & 0x80;
+  normalize (fac, exponent, quotient << 6);
+  return true;
+}
+
+bool
+basicfp_run (CPU *cpu, BasicFpRoutine routine)
+{
+  BasicFloat fac = basicfp_fac (cpu);
+  BasicFloat arg = load (cpu, BASICFP_ARG);
+  if (uses_operand (routine))
+    {
+      Byte packed[5];
+      Word address = get_word_address (cpu->A, cpu->Y);
+      for (int i = 0; i < 5; i++)
+        {
+          packed[i] = cpu->Memory[(Word)(address + i)];
+        }
+      arg = basicfp_unpack (packed);
+    }
+  Byte signCompare = uses_operand (routine)
+                         ? (arg.sign ^ fac.sign)
+                         : cpu->Memory[BASICFP_SIGN_COMPARE];
+
+  BasicFloat result = fac;
+  bool done;
+  switch (routine)
+    {
+    case BASICFP_FSUB:
+    case BASICFP_FSUBT:
+      result.sign ^= 0xFF;
+      done = add (&result, &arg);
+      break;
+    case BASICFP_FADD:
+    case BASICFP_FADDT:
+      done = add (&result, &arg);
+      break;
+    case BASICFP_FMULT:
+    case BASICFP_FMULTT:
+      done = multiply (&result, &arg);
+      break;
+    case BASICFP_FDIV:
+    case BASICFP_FDIVT:
+    default:
+      done = divide (&result, &arg);
+      break;
+    }
+  if (!done)
+    {
+      return false;
+    }
+
+  if (uses_operand (routine))
+    {
+      store (cpu, BASICFP_ARG, arg);
+      poke (cpu, BASICFP_SIGN_COMPARE, signCompare);
+    }
+  basicfp_set_fac (cpu, result);
+  return true;
+}
+
+static bool
+trap (CPU *cpu, void *user)
+{
+  return basicfp_run (cpu, (BasicFpRoutine)(intptr_t)user);
+}
+
+bool
+basicfp_install (Hle *hle, BasicFpRoutine routine,
+                 const BasicFpReport *report)
+{
+  if (report->samples[routine] == 0 || report->mismatches[routine] != 0)
+    {
+      return false;
+    }
+  Uint64 mean = report->romCycles[routine] / report->samples[routine];
+  return hle_trap (hle, basicfp_entries[routine], trap,
+                   (void *)(intptr_t)routine, mean < 1 ? 1 : (Sint32)mean);
+}
+
+/* Verification */
+
+static Uint64
+next_random (Uint64 *state)
+{
+  Uint64 z = (*state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+static BasicFloat
+random_float (Uint64 *state, int lowest, int highest)
+{
+  Uint64 bits = next_random (state);
+  BasicFloat value;
+  value.exponent = lowest + (int)(bits % (Uint64)(highest - lowest + 1));
+  value.mantissa = (Uint32)(bits >> 16) | 0x80000000;
+  value.rounding = bits >> 48;
+  value.sign = bits >> 56 & 0x80;
+  if ((bits >> 60) == 0)
+    {
+      value.exponent = 0;
+    }
+  return value;
+}
+
+static void
+place (Byte *memory, Word address, BasicFloat value)
+{
+  memory[address] = value.exponent;
+  memory[address + 1] = value.mantissa >> 24;
+  memory[address + 2] = value.mantissa >> 16;
+  memory[address + 3] = value.mantissa >> 8;
+  memory[address + 4] = value.mantissa;
+  memory[address + 5] = value.sign;
+}
+
+// Fills in the inputs of routine on cpu, as a caller would.
+static void
+sample (CPU *cpu, BasicFpRoutine routine, Uint64 *state)
+{
+  BasicFloat fac;
+  BasicFloat arg;
+  switch (routine)
+    {
+    case BASICFP_FMULT:
+    case BASICFP_FMULTT:
+    case BASICFP_FDIV:
+    case BASICFP_FDIVT:
+      fac = random_float (state, 0x48, 0xB8);
+      arg = random_float (state, 0x48, 0xB8);
+      break;
+    default:
+      // Exponents close enough for the operands to overlap most of the time
+      fac = random_float (state, 0x60, 0xA0);
+      arg = random_float (state, 0x60, 0xA0);
+      if (arg.exponent != 0)
+        {
+          int exponent = fac.exponent + (int)(next_random (state) % 81) - 40;
+          arg.exponent = exponent < 1 ? 1 : exponent > 0xFF ? 0xFF : exponent;
+        }
+      break;
+    }
+  if (arg.exponent == 0)
+    {
+      arg.sign = 0;
+    }
+  arg.rounding = 0;
+
+  place (cpu->Memory, BASICFP_FAC, fac);
+  cpu->Memory[BASICFP_ROUNDING] = fac.rounding;
+  if (uses_operand (routine))
+    {
+      basicfp_pack (arg, &cpu->Memory[OPERAND]);
+      cpu->A = OPERAND & 0xFF;
+      cpu->Y = OPERAND >> 8;
+    }
+  else
+    {
+      place (cpu->Memory, BASICFP_ARG, arg);
+      cpu->Memory[BASICFP_SIGN_COMPARE] = arg.sign ^ fac.sign;
+      // The ARG forms branch on the flags of a LDA of FAC's exponent
+      cpu->A = fac.exponent;
+    }
+  set_status_flag (&cpu->P, cpu->A);
+}
+
+// Runs routine from the ROM until it returns.  Returns the cycles taken, or
+// 0 if it did not return (an error, typically).
+static Uint64
+run_rom (CPU *cpu, BasicFpRoutine routine)
+{
+  Sint32 cycles = 0;
+  stack_push (cpu, (RETURN - 1) >> 8, &cycles);
+  stack_push (cpu, (RETURN - 1) & 0xFF, &cycles);
+  cpu->PC = basicfp_entries[routine];
+  Uint64 total = 0;
+  for (int step = 0; step < MAX_ROM_STEPS; step++)
+    {
+      total += execute (cpu);
+      if (cpu->PC == RETURN)
+        {
+          return total;
+        }
+    }
+  return 0;
+}
+
+static bool
+same (BasicFloat a, BasicFloat b)
+{
+  if (a.exponent == 0 || b.exponent == 0)
+    {
+      return a.exponent == b.exponent;
+    }
+  return a.exponent == b.exponent && a.mantissa == b.mantissa
+         && a.rounding == b.rounding && (a.sign & 0x80) == (b.sign & 0x80);
+}
+
+bool
+basicfp_verify (Hle *hle, const Byte *rom, Uint32 samples, Uint64 seed,
+                BasicFpReport *report)
+{
+  BasicFpReport local;
+  if (report == NULL)
+    {
+      report = &local;
+    }
+  memset (report, 0, sizeof (*report));
+
+  CPU *romCpu = malloc (sizeof (CPU));
+  CPU *nativeCpu = malloc (sizeof (CPU));
+  if (romCpu == NULL || nativeCpu == NULL)
+    {
+      free (romCpu);
+      free (nativeCpu);
+      return false;
+    }
+  reset (romCpu);
+  reset (nativeCpu);
+  memcpy (romCpu->Memory, rom, MAX_MEMORY);
+  memset (nativeCpu->Memory, 0, MAX_MEMORY);
+
+  bool installed = true;
+  for (int routine = 0; routine < BASICFP_ROUTINES; routine++)
+    {
+      Uint64 state = seed + (Uint64)routine;
+      for (Uint32 i = 0; i < samples; i++)
+        {
+          romCpu->SP = 0xFF;
+          romCpu->P = FLAG_UNDEFINED | FLAG_INTERRUPT_DISABLE;
+          sample (romCpu, routine, &state);
+          memcpy (nativeCpu->Memory, romCpu->Memory, 0x0400);
+          nativeCpu->A = romCpu->A;
+          nativeCpu->Y = romCpu->Y;
+          if (!basicfp_run (nativeCpu, routine))
+            {
+              continue; // The ROM would run
+            }
+          Uint64 cycles = run_rom (romCpu, routine);
+          report->samples[routine]++;
+          report->romCycles[routine] += cycles;
+          if (cycles == 0
+              || !same (basicfp_fac (romCpu), basicfp_fac (nativeCpu)))
+            {
+              report->mismatches[routine]++;
+            }
+        }
+
+      if (report->samples[routine] == 0 || report->mismatches[routine] != 0)
+        {
+          continue;
+        }
+      report->armed[routine] = basicfp_install (hle, routine, report);
+      installed = installed && report->armed[routine];
+    }
+
+  free (romCpu);
+  free (nativeCpu);
+  return installed;
+}
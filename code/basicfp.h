@@ -0,0 +1,106 @@
+#ifndef BASICFP_H_
+#define BASICFP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* basicfp.h
+ * Native traps (see hle.h) for the C64 BASIC floating-point package: FADD,
+ * FSUB, FMULT and FDIV, in both their memory-operand and ARG forms.  A
+ * handler unpacks FAC and ARG from zero page, computes on the host and
+ * writes FAC back, rounding byte included.  Errors (overflow, division by
+ * zero) are left to the ROM.
+ *
+ * The arithmetic follows the ROM's: sums are aligned and normalized through
+ * the 8-bit rounding byte, products are formed by shift-and-add over FAC's
+ * bytes least significant first, and quotients by restoring division into
+ * two guard bits, with bits falling off the bottom lost.  The transcendental
+ * functions are not trapped: the ROM builds them from its own LOG, EXP and
+ * polynomial series, which host arithmetic does not reproduce.
+ *
+ * Since the ROM is not part of the emulator, basicfp_verify() checks every
+ * routine against a memory image holding the user's ROMs: each routine is
+ * run by the interpreter and natively on sampled inputs, and only routines
+ * whose results agree bit for bit on every sample are armed, charging the
+ * ROM's mean cycle count.  basicfp_install() arms a routine in another trap
+ * table from such a report, and nothing is ever armed unverified.
+ */
+#include "cpu.h"
+#include "hle.h"
+
+// Zero-page layout
+#define BASICFP_FAC 0x61 // Exponent, 4 mantissa bytes, sign
+#define BASICFP_FAC_SIGN 0x66
+#define BASICFP_ARG 0x69
+#define BASICFP_ARG_SIGN 0x6E
+#define BASICFP_SIGN_COMPARE 0x6F // FAC sign EOR ARG sign
+#define BASICFP_ROUNDING 0x70     // FAC's rounding byte
+
+typedef enum
+{
+  BASICFP_FSUB,   // FAC = (A/Y) - FAC
+  BASICFP_FSUBT,  // FAC = ARG - FAC
+  BASICFP_FADD,   // FAC = (A/Y) + FAC
+  BASICFP_FADDT,  // FAC = ARG + FAC
+  BASICFP_FMULT,  // FAC = (A/Y) * FAC
+  BASICFP_FMULTT, // FAC = ARG * FAC
+  BASICFP_FDIV,   // FAC = (A/Y) / FAC
+  BASICFP_FDIVT,  // FAC = ARG / FAC
+  BASICFP_ROUTINES
+} BasicFpRoutine;
+
+// An unpacked float.  The value is 0.mantissa * 2^(exponent - 128), or
+// zero if exponent is 0.
+typedef struct
+{
+  Byte exponent;
+  Uint32 mantissa; // Bit 31 set when normalized
+  Byte rounding;   // The 8 bits below the mantissa
+  Byte sign;       // Bit 7
+} BasicFloat;
+
+typedef struct
+{
+  Uint32 samples[BASICFP_ROUTINES];    // Inputs both sides computed
+  Uint32 mismatches[BASICFP_ROUTINES]; // Of those, results that differed
+  Uint64 romCycles[BASICFP_ROUTINES];  // Cycles the ROM took on the samples
+  bool armed[BASICFP_ROUTINES];
+} BasicFpReport;
+
+extern const Word basicfp_entries[BASICFP_ROUTINES];
+
+// The 5-byte packed form: exponent, then the mantissa with the sign in
+// place of its top bit.  Packing rounds on the rounding byte as MOVMF does.
+BasicFloat basicfp_unpack (const Byte *packed);
+void basicfp_pack (BasicFloat value, Byte *packed);
+
+// Conversions from and to the host, truncating to FAC precision.
+// basicfp_from_host() returns false if the value overflows.
+bool basicfp_from_host (long double host, BasicFloat *value);
+long double basicfp_to_host (BasicFloat value);
+
+BasicFloat basicfp_fac (const CPU *cpu);
+void basicfp_set_fac (CPU *cpu, BasicFloat value);
+
+// Runs routine natively on cpu as its trap would, except for the return.
+// Returns false, changing nothing, where the ROM would raise an error.
+bool basicfp_run (CPU *cpu, BasicFpRoutine routine);
+
+// Arms routine if report, from basicfp_verify(), shows it bit-exact on at
+// least one sample, charging the ROM's mean cycle count; false otherwise.
+bool basicfp_install (Hle *hle, BasicFpRoutine routine,
+                      const BasicFpReport *report);
+
+// Compares every routine against the ROM code in rom (a 64 KiB memory image
+// with BASIC and KERNAL banked in) on samples inputs from seed, and arms
+// those that matched on all of them.  report may be NULL.  Returns false if
+// the trap table filled up.
+bool basicfp_verify (Hle *hle, const Byte *rom, Uint32 samples, Uint64 seed,
+                     BasicFpReport *report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
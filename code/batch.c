@@ -0,0 +1,839 @@
+#include "batch.h"
+#include "resultcache.h"
+#include "run.h"
+#include "support.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define JOBS_PER_CLAIM 64     // Lines a worker takes from the index at once
+#define FLUSH_THRESHOLD 65536 // Bytes of results a worker buffers
+#define RESULT_LINE_MAX 256   // A result line without its dumps
+#define MAX_ERROR 128
+
+typedef struct
+{
+  const Byte *data; // NULL when the file is empty
+  size_t size;
+} Mapping;
+
+typedef struct
+{
+  char *data;
+  size_t length;
+  size_t capacity;
+} Buffer;
+
+typedef struct
+{
+  const BatchOptions *options;
+  const char *manifest;
+  size_t *lineStarts; // lineCount + 1 entries; the last is the manifest size
+  size_t lineCount;
+  int directoryLength; // Of the manifest's directory, with its '/'
+  const char *directory;
+  FILE *out;
+  ResultCache *cache; // NULL without one
+
+  atomic_size_t nextLine;
+  atomic_bool failed;
+  pthread_mutex_t lock; // Guards out and stats
+  BatchStats stats;
+} Batch;
+
+typedef struct
+{
+  Batch *batch;
+  CPU *cpu;
+  RunStops *stops;
+  Buffer results;
+  BatchStats stats;
+
+  char imagePath[BATCH_MAX_PATH]; // The mapped image, or ""
+  Mapping image;
+} Worker;
+
+static bool
+map_file (const char *path, Mapping *mapping)
+{
+  int fd = open (path, O_RDONLY);
+  if (fd < 0)
+    {
+      return false;
+    }
+
+  struct stat info;
+  if (fstat (fd, &info) != 0)
+    {
+      close (fd);
+      return false;
+    }
+
+  mapping->data = NULL;
+  mapping->size = (size_t)info.st_size;
+  if (mapping->size > 0)
+    {
+      void *data = mmap (NULL, mapping->size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED)
+        {
+          close (fd);
+          return false;
+        }
+      mapping->data = (const Byte *)data;
+    }
+  close (fd); // The mapping keeps the file
+  return true;
+}
+
+static void
+unmap_file (Mapping *mapping)
+{
+  if (mapping->data != NULL)
+    {
+      munmap ((void *)mapping->data, mapping->size);
+    }
+  mapping->data = NULL;
+  mapping->size = 0;
+}
+
+static bool
+buffer_reserve (Buffer *buffer, size_t extra)
+{
+  if (buffer->length + extra <= buffer->capacity)
+    {
+      return true;
+    }
+
+  size_t capacity = buffer->capacity != 0 ? buffer->capacity : 4096;
+  while (capacity < buffer->length + extra)
+    {
+      capacity *= 2;
+    }
+  char *data = (char *)realloc (buffer->data, capacity);
+  if (data == NULL)
+    {
+      return false;
+    }
+  buffer->data = data;
+  buffer->capacity = capacity;
+  return true;
+}
+
+// Parses length characters of text as a number in base (10 or 16; hex may
+// start with '$') no greater than max.
+static bool
+parse_number (const char *text, size_t length, int base, Uint64 max,
+              Uint64 *value)
+{
+  if (base == 16 && length > 0 && *text == '$')
+    {
+      text++;
+      length--;
+    }
+  if (length == 0)
+    {
+      return false;
+    }
+
+  Uint64 result = 0;
+  for (size_t i = 0; i < length; i++)
+    {
+      char c = text[i];
+      int digit;
+      if (c >= '0' && c <= '9')
+        digit = c - '0';
+      else if (base == 16 && c >= 'a' && c <= 'f')
+        digit = c - 'a' + 10;
+      else if (base == 16 && c >= 'A' && c <= 'F')
+        digit = c - 'A' + 10;
+      else
+        return false;
+
+      if ((Uint64)digit > max || result > (max - digit) / base)
+        {
+          return false;
+        }
+      result = result * base + digit;
+    }
+  *value = result;
+  return true;
+}
+
+static bool
+key_is (const char *key, size_t keyLength, const char *name)
+{
+  return strlen (name) == keyLength && memcmp (key, name, keyLength) == 0;
+}
+
+static bool
+copy_text (char *to, size_t size, const char *text, size_t length)
+{
+  if (length == 0 || length >= size)
+    {
+      return false;
+    }
+  memcpy (to, text, length);
+  to[length] = '\0';
+  return true;
+}
+
+static void
+init_job (BatchJob *job)
+{
+  memset (job, 0, sizeof (*job));
+  job->load = BATCH_DEFAULT_LOAD_ADDRESS;
+  job->P = FLAG_UNDEFINED | FLAG_INTERRUPT_DISABLE; // As after reset()
+  job->SP = 0xFF;
+  job->brk = true;
+  job->selfLoop = true;
+  job->illegal = true;
+}
+
+// Applies one key=value field to job, or returns an error message.
+static const char *
+parse_field (BatchJob *job, const char *key, size_t keyLength,
+             const char *text, size_t length)
+{
+  Uint64 value;
+  Byte *reg = key_is (key, keyLength, "a")    ? &job->A
+              : key_is (key, keyLength, "x")  ? &job->X
+              : key_is (key, keyLength, "y")  ? &job->Y
+              : key_is (key, keyLength, "p")  ? &job->P
+              : key_is (key, keyLength, "sp") ? &job->SP
+                                              : NULL;
+  bool *flag = key_is (key, keyLength, "prg")        ? &job->prg
+               : key_is (key, keyLength, "brk")      ? &job->brk
+               : key_is (key, keyLength, "selfloop") ? &job->selfLoop
+               : key_is (key, keyLength, "illegal")  ? &job->illegal
+                                                     : NULL;
+
+  if (reg != NULL || flag != NULL)
+    {
+      if (!parse_number (text, length, 16, reg != NULL ? 0xFF : 1, &value))
+        {
+          return "bad value";
+        }
+      if (reg != NULL)
+        *reg = (Byte)value;
+      else
+        *flag = value != 0;
+    }
+  else if (key_is (key, keyLength, "id"))
+    {
+      if (!copy_text (job->id, sizeof (job->id), text, length))
+        {
+          return "bad id";
+        }
+    }
+  else if (key_is (key, keyLength, "image"))
+    {
+      if (!copy_text (job->image, sizeof (job->image), text, length))
+        {
+          return "bad image path";
+        }
+    }
+  else if (key_is (key, keyLength, "load")
+           || key_is (key, keyLength, "pc"))
+    {
+      if (!parse_number (text, length, 16, 0xFFFF, &value))
+        {
+          return "bad address";
+        }
+      if (*key == 'l')
+        job->load = (Word)value;
+      else
+        {
+          job->pc = (Word)value;
+          job->pcGiven = true;
+        }
+    }
+  else if (key_is (key, keyLength, "cycles")
+           || key_is (key, keyLength, "instructions"))
+    {
+      if (!parse_number (text, length, 10, UINT64_MAX, &value))
+        {
+          return "bad count";
+        }
+      if (*key == 'c')
+        job->maxCycles = value;
+      else
+        job->maxInstructions = value;
+    }
+  else if (key_is (key, keyLength, "stop")
+           || key_is (key, keyLength, "write"))
+    {
+      Word *addresses = *key == 's' ? job->stops : job->writes;
+      int *count = *key == 's' ? &job->stopCount : &job->writeCount;
+      if (*count == BATCH_MAX_STOPS)
+        {
+          return "too many stops";
+        }
+      if (!parse_number (text, length, 16, 0xFFFF, &value))
+        {
+          return "bad address";
+        }
+      addresses[(*count)++] = (Word)value;
+    }
+  else if (key_is (key, keyLength, "dump"))
+    {
+      const char *dash = (const char *)memchr (text, '-', length);
+      Uint64 low, high;
+      if (job->dumpCount == BATCH_MAX_DUMPS)
+        {
+          return "too many dumps";
+        }
+      if (dash == NULL
+          || !parse_number (text, dash - text, 16, 0xFFFF, &low)
+          || !parse_number (dash + 1, text + length - dash - 1, 16, 0xFFFF,
+                            &high)
+          || high < low)
+        {
+          return "bad dump range";
+        }
+      job->dumps[job->dumpCount].low = (Word)low;
+      job->dumps[job->dumpCount].high = (Word)high;
+      job->dumpCount++;
+    }
+  else
+    {
+      return "unknown field";
+    }
+  return NULL;
+}
+
+int
+batch_parse_job (const char *line, size_t length, BatchJob *job, char *error,
+                 size_t errorSize)
+{
+  const char *end = line + length;
+  const char *p = line;
+  init_job (job);
+
+  while (p < end && (*p == ' ' || *p == '\t'))
+    {
+      p++;
+    }
+  if (p == end || *p == '#')
+    {
+      return 0;
+    }
+
+  while (p < end)
+    {
+      const char *field = p;
+      while (p < end && *p != ' ' && *p != '\t')
+        {
+          p++;
+        }
+      const char *fieldEnd = p;
+      while (p < end && (*p == ' ' || *p == '\t'))
+        {
+          p++;
+        }
+
+      const char *equals
+          = (const char *)memchr (field, '=', fieldEnd - field);
+      const char *message
+          = equals == NULL ? "expected key=value"
+                           : parse_field (job, field, equals - field,
+                                          equals + 1, fieldEnd - equals - 1);
+      if (message != NULL)
+        {
+          snprintf (error, errorSize, "%s: %.*s", message,
+                    (int)(fieldEnd - field), field);
+          return -1;
+        }
+    }
+
+  if (job->image[0] == '\0')
+    {
+      snprintf (error, errorSize, "no image");
+      return -1;
+    }
+  return 1;
+}
+
+static Uint64
+now_ns (void)
+{
+  struct timespec now;
+  clock_gettime (CLOCK_MONOTONIC, &now);
+  return (Uint64)now.tv_sec * 1000000000u + now.tv_nsec;
+}
+
+// Maps the job's image unless it is the one already mapped.
+static const char *
+worker_map_image (Worker *worker, const BatchJob *job)
+{
+  Batch *batch = worker->batch;
+  char path[BATCH_MAX_PATH + 1024];
+  if (job->image[0] != '/' && batch->directoryLength > 0)
+    {
+      snprintf (path, sizeof (path), "%.*s%s", batch->directoryLength,
+                batch->directory, job->image);
+    }
+  else
+    {
+      snprintf (path, sizeof (path), "%s", job->image);
+    }
+
+  if (strcmp (path, worker->imagePath) == 0)
+    {
+      return NULL;
+    }
+  unmap_file (&worker->image);
+  worker->imagePath[0] = '\0';
+  if (strlen (path) >= sizeof (worker->imagePath)
+      || !map_file (path, &worker->image))
+    {
+      return "cannot read image";
+    }
+  strcpy (worker->imagePath, path);
+  return NULL;
+}
+
+// Finds the bytes of the job's image that load into memory, and where.
+// Returns an error message or NULL.
+static const char *
+worker_load_image (Worker *worker, const BatchJob *job, const Byte **bytes,
+                   size_t *size, Word *load)
+{
+  const char *message = worker_map_image (worker, job);
+  if (message != NULL)
+    {
+      return message;
+    }
+
+  *bytes = worker->image.data;
+  *size = worker->image.size;
+  *load = job->load;
+  if (job->prg)
+    {
+      if (*size < 2)
+        {
+          return "no load address";
+        }
+      *load = get_word_address ((*bytes)[0], (*bytes)[1]);
+      *bytes += 2;
+      *size -= 2;
+    }
+  if (*size == 0)
+    {
+      return "empty image";
+    }
+  if (*size > (size_t)(MAX_MEMORY - *load))
+    {
+      *size = MAX_MEMORY - *load;
+    }
+  return NULL;
+}
+
+// Hashes everything the job's result depends on.
+static void
+job_key (const BatchJob *job, const Byte *bytes, size_t size, Word load,
+         ResultKey *key)
+{
+  const char *build = resultcache_build_id ();
+  Word pc = job->pcGiven ? job->pc : load;
+  Byte state[] = { job->A,   job->X,   job->Y,        job->P,
+                   job->SP,  job->brk, job->selfLoop, job->illegal };
+
+  resultcache_key_init (key);
+  resultcache_key_add (key, build, strlen (build));
+  resultcache_key_add (key, &load, sizeof (load));
+  resultcache_key_add (key, &pc, sizeof (pc));
+  resultcache_key_add (key, state, sizeof (state));
+  resultcache_key_add (key, &job->maxCycles, sizeof (job->maxCycles));
+  resultcache_key_add (key, &job->maxInstructions,
+                       sizeof (job->maxInstructions));
+  resultcache_key_add (key, job->stops, job->stopCount * sizeof (Word));
+  resultcache_key_add (key, job->writes, job->writeCount * sizeof (Word));
+  resultcache_key_add (key, job->dumps,
+                       job->dumpCount * sizeof (BatchRange));
+  resultcache_key_add (key, bytes, size);
+}
+
+// Runs one job from its loaded image; returns an error message or NULL.
+static const char *
+worker_run_job (Worker *worker, const BatchJob *job, const Byte *bytes,
+                size_t size, Word load, RunExit *result, Uint64 *ns)
+{
+  CPU *cpu = worker->cpu;
+  RunStops *stops = worker->stops;
+
+  run_stops_init (stops);
+  stops->brk = job->brk;
+  stops->selfLoop = job->selfLoop;
+  stops->illegal = job->illegal;
+  stops->maxCycles = job->maxCycles;
+  stops->maxInstructions = job->maxInstructions;
+  for (int i = 0; i < job->stopCount; i++)
+    {
+      if (!run_stop_at (stops, job->stops[i]))
+        {
+          return "too many stops";
+        }
+    }
+  for (int i = 0; i < job->writeCount; i++)
+    {
+      if (!run_stop_on_write (stops, job->writes[i]))
+        {
+          return "write stops need ACE64_WATCHPOINTS";
+        }
+    }
+
+  reset (cpu);
+  memcpy (&cpu->Memory[load], bytes, size);
+  cpu->PC = job->pcGiven ? job->pc : load;
+  cpu->A = job->A;
+  cpu->X = job->X;
+  cpu->Y = job->Y;
+  cpu->P = job->P;
+  cpu->SP = job->SP;
+
+  Uint64 start = now_ns ();
+  *result = run_until (cpu, stops);
+  *ns = now_ns () - start;
+  return NULL;
+}
+
+// Formats a result line up to its wall time.
+static bool
+format_result (Buffer *out, const char *id, const CPU *cpu,
+               const BatchJob *job, const RunExit *result)
+{
+  if (!buffer_reserve (out, RESULT_LINE_MAX))
+    {
+      return false;
+    }
+  out->length += snprintf (
+      out->data + out->length, RESULT_LINE_MAX,
+      "%s %s pc=%04X a=%02X x=%02X y=%02X p=%02X sp=%02X instructions=%llu"
+      " cycles=%llu",
+      id, run_exit_name (result->reason), cpu->PC, cpu->A, cpu->X, cpu->Y,
+      cpu->P, cpu->SP, (unsigned long long)result->instructions,
+      (unsigned long long)result->cycles);
+
+  static const char digits[] = "0123456789ABCDEF";
+  for (int d = 0; d < job->dumpCount; d++)
+    {
+      Word low = job->dumps[d].low;
+      size_t count = (size_t)job->dumps[d].high - low + 1;
+      if (!buffer_reserve (out, 12 + 2 * count))
+        {
+          return false;
+        }
+      out->length += sprintf (out->data + out->length, " dump=%04X:", low);
+      for (size_t i = 0; i < count; i++)
+        {
+          Byte value = cpu->Memory[low + i];
+          out->data[out->length++] = digits[value >> 4];
+          out->data[out->length++] = digits[value & 15];
+        }
+    }
+  return true;
+}
+
+// Ends a result line with its wall time.
+static bool
+format_time (Buffer *out, Uint64 ns, bool cached)
+{
+  if (!buffer_reserve (out, RESULT_LINE_MAX))
+    {
+      return false;
+    }
+  out->length += snprintf (out->data + out->length, RESULT_LINE_MAX,
+                           " ns=%llu%s\n", (unsigned long long)ns,
+                           cached ? " cached" : "");
+  return true;
+}
+
+static bool
+format_error (Buffer *out, const char *id, const char *message)
+{
+  if (!buffer_reserve (out, RESULT_LINE_MAX))
+    {
+      return false;
+    }
+  out->length += snprintf (out->data + out->length, RESULT_LINE_MAX,
+                           "%s error %s\n", id, message);
+  return true;
+}
+
+static void
+worker_flush (Worker *worker)
+{
+  Batch *batch = worker->batch;
+  if (worker->results.length == 0)
+    {
+      return;
+    }
+  pthread_mutex_lock (&batch->lock);
+  fwrite (worker->results.data, 1, worker->results.length, batch->out);
+  pthread_mutex_unlock (&batch->lock);
+  worker->results.length = 0;
+}
+
+static bool
+worker_do_line (Worker *worker, size_t index)
+{
+  Batch *batch = worker->batch;
+  const char *line = batch->manifest + batch->lineStarts[index];
+  size_t length = batch->lineStarts[index + 1] - batch->lineStarts[index];
+  while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r'))
+    {
+      length--;
+    }
+
+  BatchJob job;
+  char error[MAX_ERROR];
+  char lineId[24];
+  snprintf (lineId, sizeof (lineId), "%zu", index + 1);
+  int parsed = batch_parse_job (line, length, &job, error, sizeof (error));
+  if (parsed == 0)
+    {
+      return true;
+    }
+  worker->stats.jobs++;
+  if (parsed < 0)
+    {
+      worker->stats.failed++;
+      return format_error (&worker->results, lineId, error);
+    }
+
+  const char *id = job.id[0] != '\0' ? job.id : lineId;
+  Buffer *out = &worker->results;
+  const Byte *bytes;
+  size_t size;
+  Word load;
+  ResultKey key;
+  RunExit result;
+  Uint64 ns;
+  const char *message = worker_load_image (worker, &job, &bytes, &size,
+                                           &load);
+
+  if (message == NULL && batch->cache != NULL)
+    {
+      Uint64 start = now_ns ();
+      size_t idLength = strlen (id);
+      job_key (&job, bytes, size, load, &key);
+      if (!buffer_reserve (out, idLength + 1 + RESULTCACHE_MAX_PAYLOAD))
+        {
+          return false;
+        }
+      char *line = out->data + out->length;
+      long cached = resultcache_lookup (batch->cache, &key,
+                                        line + idLength + 1,
+                                        RESULTCACHE_MAX_PAYLOAD);
+      if (cached >= 0)
+        {
+          memcpy (line, id, idLength);
+          line[idLength] = ' ';
+          out->length += idLength + 1 + cached;
+          worker->stats.cached++;
+          return format_time (out, now_ns () - start, true);
+        }
+    }
+
+  if (message == NULL)
+    {
+      message = worker_run_job (worker, &job, bytes, size, load, &result,
+                                &ns);
+    }
+  if (message != NULL)
+    {
+      worker->stats.failed++;
+      return format_error (out, id, message);
+    }
+  worker->stats.instructions += result.instructions;
+  worker->stats.cycles += result.cycles;
+
+  size_t bodyStart = out->length + strlen (id) + 1;
+  if (!format_result (out, id, worker->cpu, &job, &result))
+    {
+      return false;
+    }
+  if (batch->cache != NULL)
+    {
+      resultcache_store (batch->cache, &key, out->data + bodyStart,
+                         out->length - bodyStart);
+    }
+  return format_time (out, ns, false);
+}
+
+static void *
+batch_worker (void *argument)
+{
+  Batch *batch = (Batch *)argument;
+  Worker worker;
+  memset (&worker, 0, sizeof (worker));
+  worker.batch = batch;
+  worker.cpu = (CPU *)malloc (sizeof (CPU));
+  worker.stops = (RunStops *)malloc (sizeof (RunStops));
+
+  bool ok = worker.cpu != NULL && worker.stops != NULL;
+  while (ok && !atomic_load (&batch->failed))
+    {
+      size_t first = atomic_fetch_add (&batch->nextLine, JOBS_PER_CLAIM);
+      if (first >= batch->lineCount)
+        {
+          break;
+        }
+      size_t last = first + JOBS_PER_CLAIM < batch->lineCount
+                        ? first + JOBS_PER_CLAIM
+                        : batch->lineCount;
+      for (size_t i = first; i < last && ok; i++)
+        {
+          ok = worker_do_line (&worker, i);
+        }
+      if (worker.results.length >= FLUSH_THRESHOLD)
+        {
+          worker_flush (&worker);
+        }
+    }
+  if (!ok)
+    {
+      atomic_store (&batch->failed, true);
+    }
+  worker_flush (&worker);
+
+  pthread_mutex_lock (&batch->lock);
+  batch->stats.jobs += worker.stats.jobs;
+  batch->stats.failed += worker.stats.failed;
+  batch->stats.cached += worker.stats.cached;
+  batch->stats.instructions += worker.stats.instructions;
+  batch->stats.cycles += worker.stats.cycles;
+  pthread_mutex_unlock (&batch->lock);
+
+  unmap_file (&worker.image);
+  free (worker.results.data);
+  free (worker.stops);
+  free (worker.cpu);
+  return NULL;
+}
+
+// Records where each line starts; returns false if memory ran out.
+static bool
+index_lines (Batch *batch, const Mapping *manifest)
+{
+  const char *data = (const char *)manifest->data;
+  size_t size = manifest->size;
+  size_t capacity = 1024;
+  size_t count = 0;
+  size_t *starts = (size_t *)malloc (capacity * sizeof (size_t));
+
+  size_t offset = 0;
+  while (starts != NULL && offset < size)
+    {
+      if (count + 1 == capacity)
+        {
+          capacity *= 2;
+          size_t *grown
+              = (size_t *)realloc (starts, capacity * sizeof (size_t));
+          if (grown == NULL)
+            {
+              free (starts);
+              return false;
+            }
+          starts = grown;
+        }
+      starts[count++] = offset;
+      const char *newline
+          = (const char *)memchr (data + offset, '\n', size - offset);
+      offset = newline != NULL ? (size_t)(newline - data) + 1 : size;
+    }
+  if (starts == NULL)
+    {
+      return false;
+    }
+  starts[count] = size;
+
+  batch->manifest = data;
+  batch->lineStarts = starts;
+  batch->lineCount = count;
+  return true;
+}
+
+bool
+batch_run (const char *path, FILE *out, const BatchOptions *options,
+           BatchStats *stats)
+{
+  memset (stats, 0, sizeof (*stats));
+  Mapping manifest;
+  if (!map_file (path, &manifest))
+    {
+      return false;
+    }
+  if (manifest.data != NULL)
+    {
+      madvise ((void *)manifest.data, manifest.size, MADV_SEQUENTIAL);
+    }
+
+  Batch *batch = (Batch *)calloc (1, sizeof (Batch));
+  if (batch == NULL || !index_lines (batch, &manifest))
+    {
+      free (batch);
+      unmap_file (&manifest);
+      return false;
+    }
+  if (options->cachePath != NULL)
+    {
+      batch->cache = resultcache_open (options->cachePath,
+                                       options->cacheSize);
+      if (batch->cache == NULL)
+        {
+          free (batch->lineStarts);
+          free (batch);
+          unmap_file (&manifest);
+          return false;
+        }
+    }
+  batch->options = options;
+  batch->out = out;
+  const char *slash = strrchr (path, '/');
+  batch->directory = path;
+  batch->directoryLength = slash != NULL ? (int)(slash - path) + 1 : 0;
+  pthread_mutex_init (&batch->lock, NULL);
+
+  int threadCount = support_thread_count (options->threads);
+  size_t claims = (batch->lineCount + JOBS_PER_CLAIM - 1) / JOBS_PER_CLAIM;
+  if ((size_t)threadCount > claims)
+    {
+      threadCount = claims > 0 ? (int)claims : 1;
+    }
+
+  pthread_t *threads = (pthread_t *)calloc (threadCount, sizeof (pthread_t));
+  int started = 0;
+  while (threads != NULL && started < threadCount
+         && pthread_create (&threads[started], NULL, batch_worker, batch)
+                == 0)
+    {
+      started++;
+    }
+  if (started == 0)
+    {
+      batch_worker (batch); // Run on the calling thread instead
+    }
+  for (int t = 0; t < started; t++)
+    {
+      pthread_join (threads[t], NULL);
+    }
+  free (threads);
+  fflush (out);
+
+  bool ok = !atomic_load (&batch->failed);
+  *stats = batch->stats;
+  pthread_mutex_destroy (&batch->lock);
+  resultcache_close (batch->cache);
+  free (batch->lineStarts);
+  free (batch);
+  unmap_file (&manifest);
+  return ok;
+}
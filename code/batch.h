@@ -0,0 +1,121 @@
+#ifndef BATCH_H_
+#define BATCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* batch.h
+ * Batch runs: a manifest lists one job per line, and batch_run() runs the
+ * jobs on a pool of threads, each with its own CPU, writing one result line
+ * per job.
+ *
+ * A job line is whitespace-separated key=value fields; '#' starts a comment
+ * line.  Addresses and register values are hex, counts decimal:
+ *
+ *   id=<text>           Names the job in its result (default: line number)
+ *   image=<path>        Required; relative paths are taken from the
+ *                       manifest's directory
+ *   prg=1               The image starts with its load address
+ *   load=<addr>         Load address (default $0200)
+ *   pc=<addr>           Entry PC (default: the load address)
+ *   a= x= y= p= sp=     Initial registers (default: as after reset())
+ *   cycles=<n>          Cycle limit
+ *   instructions=<n>    Instruction limit
+ *   stop=<addr>         Stop before the instruction at addr (repeatable)
+ *   write=<addr>        Stop after a write to addr (repeatable; needs
+ *                       ACE64_WATCHPOINTS)
+ *   brk=0 selfloop=0 illegal=0
+ *                       Run through these instead of stopping
+ *   dump=<addr>-<addr>  Memory to report, inclusive (repeatable)
+ *
+ * Each result line is
+ *
+ *   <id> <reason> pc=.. a=.. x=.. y=.. p=.. sp=.. instructions=<n>
+ *   cycles=<n> [dump=<addr>:<hex bytes> ...] ns=<wall time> [cached]
+ *
+ * or "<id> error <message>" for a job that could not run.  Results are
+ * written in completion order, not manifest order.
+ *
+ * With a result cache, a job is keyed by a hash of its loaded image, its
+ * initial state, its stop conditions and dumps, and the emulator build.
+ * A cached job is not run; its line carries the original results, the
+ * lookup's wall time and "cached".
+ *
+ * The manifest and the images are mapped rather than read; workers keep
+ * their last image mapped, so jobs sharing an image map it once per worker.
+ * Each worker formats results into its own buffer and hands whole buffers
+ * to the output, so a million-job manifest costs one line index and a
+ * handful of writes per thread on top of the runs themselves.
+ */
+#include "cpu.h"
+#include <stddef.h>
+#include <stdio.h>
+
+#define BATCH_DEFAULT_LOAD_ADDRESS 0x0200
+#define BATCH_MAX_ID 64
+#define BATCH_MAX_PATH 1024
+#define BATCH_MAX_STOPS 16
+#define BATCH_MAX_DUMPS 8
+
+typedef struct
+{
+  Word low;
+  Word high; // Inclusive
+} BatchRange;
+
+typedef struct
+{
+  char id[BATCH_MAX_ID];
+  char image[BATCH_MAX_PATH];
+  bool prg;
+  Word load;
+  bool pcGiven;
+  Word pc;
+  Byte A, X, Y, P, SP;
+  Uint64 maxCycles;       // 0 for no limit
+  Uint64 maxInstructions; // 0 for no limit
+  bool brk;
+  bool selfLoop;
+  bool illegal;
+  Word stops[BATCH_MAX_STOPS];
+  int stopCount;
+  Word writes[BATCH_MAX_STOPS];
+  int writeCount;
+  BatchRange dumps[BATCH_MAX_DUMPS];
+  int dumpCount;
+} BatchJob;
+
+typedef struct
+{
+  int threads; // 0: one per online processor
+
+  const char *cachePath; // Result cache file (resultcache.h), or NULL
+  size_t cacheSize;      // Its capacity in bytes
+} BatchOptions;
+
+typedef struct
+{
+  Uint64 jobs;         // Job lines in the manifest
+  Uint64 failed;       // Jobs reported as errors
+  Uint64 cached;       // Jobs answered from the result cache
+  Uint64 instructions; // Executed, so cached jobs do not count
+  Uint64 cycles;
+} BatchStats;
+
+// Parses one manifest line into job.  Returns 1 for a job, 0 for a blank or
+// comment line, and -1 for a malformed line, with a message in error.
+int batch_parse_job (const char *line, size_t length, BatchJob *job,
+                     char *error, size_t errorSize);
+
+// Runs every job in the manifest at path, streaming results to out.
+// Returns false if the manifest cannot be read or the workers cannot start;
+// a job that fails is reported in its result line and counted in stats.
+bool batch_run (const char *path, FILE *out, const BatchOptions *options,
+                BatchStats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,264 @@
+#include "breakpoints.h"
+#include <string.h>
+
+static void
+breakpoints_mark (Breakpoints *breakpoints, const Breakpoint *entry)
+{
+  Uint64 *bits = breakpoints->bits[entry->kind];
+  for (Uint32 address = entry->low; address <= entry->high; address++)
+    {
+      bits[address >> 6] |= 1ULL << (address & 63);
+    }
+}
+
+static void
+breakpoints_rebuild (Breakpoints *breakpoints)
+{
+  memset (breakpoints->bits, 0, sizeof (breakpoints->bits));
+  for (int i = 0; i < breakpoints->count; i++)
+    {
+      breakpoints_mark (breakpoints, &breakpoints->entries[i]);
+    }
+}
+
+void
+breakpoints_init (Breakpoints *breakpoints)
+{
+  memset (breakpoints, 0, sizeof (*breakpoints));
+  breakpoints->nextId = 1;
+}
+
+int
+breakpoints_add (Breakpoints *breakpoints, BreakKind kind, Word low,
+                 Word high, const BreakCondition *condition)
+{
+  if (breakpoints->count == MAX_BREAKPOINTS || high < low)
+    {
+      return -1;
+    }
+#ifndef ACE64_WATCHPOINTS
+  if (kind != BREAK_EXECUTE)
+    {
+      return -1;
+    }
+#endif
+
+  Breakpoint *entry = &breakpoints->entries[breakpoints->count++];
+  entry->id = breakpoints->nextId++;
+  entry->kind = kind;
+  entry->low = low;
+  entry->high = high;
+  if (condition != NULL)
+    {
+      entry->condition = *condition;
+    }
+  else
+    {
+      entry->condition.op = CONDITION_ALWAYS;
+    }
+
+  breakpoints_mark (breakpoints, entry);
+  return entry->id;
+}
+
+bool
+breakpoints_remove (Breakpoints *breakpoints, int id)
+{
+  for (int i = 0; i < breakpoints->count; i++)
+    {
+      if (breakpoints->entries[i].id == id)
+        {
+          breakpoints->entries[i]
+              = breakpoints->entries[--breakpoints->count];
+          breakpoints_rebuild (breakpoints);
+          return true;
+        }
+    }
+  return false;
+}
+
+void
+breakpoints_remove_all (Breakpoints *breakpoints)
+{
+  breakpoints->count = 0;
+  breakpoints_rebuild (breakpoints);
+}
+
+void
+breakpoints_resume (Breakpoints *breakpoints)
+{
+  if (breakpoints->hit.triggered && breakpoints->hit.kind == BREAK_EXECUTE)
+    {
+      breakpoints->resumeArmed = true;
+      breakpoints->resumePC = breakpoints->hit.address;
+    }
+  breakpoints->hit.triggered = false;
+}
+
+bool
+breakpoints_condition_holds (const CPU *cpu, const BreakCondition *condition,
+                             Byte value)
+{
+  Word actual;
+  switch (condition->reg)
+    {
+    case REGISTER_A:
+      actual = cpu->A;
+      break;
+    case REGISTER_X:
+      actual = cpu->X;
+      break;
+    case REGISTER_Y:
+      actual = cpu->Y;
+      break;
+    case REGISTER_P:
+      actual = cpu->P;
+      break;
+    case REGISTER_SP:
+      actual = cpu->SP;
+      break;
+    case REGISTER_PC:
+      actual = cpu->PC;
+      break;
+    default:
+      actual = value;
+      break;
+    }
+
+  switch (condition->op)
+    {
+    case CONDITION_EQUAL:
+      return actual == condition->value;
+    case CONDITION_NOT_EQUAL:
+      return actual != condition->value;
+    case CONDITION_LESS:
+      return actual < condition->value;
+    case CONDITION_LESS_EQUAL:
+      return actual <= condition->value;
+    case CONDITION_GREATER:
+      return actual > condition->value;
+    case CONDITION_GREATER_EQUAL:
+      return actual >= condition->value;
+    case CONDITION_BITS_SET:
+      return (actual & condition->value) != 0;
+    case CONDITION_BITS_CLEAR:
+      return (actual & condition->value) == 0;
+    default:
+      return true;
+    }
+}
+
+// Returns the id of the first breakpoint of this kind covering address whose
+// condition holds, or 0.
+static int
+breakpoints_match (const Breakpoints *breakpoints, const CPU *cpu,
+                   BreakKind kind, Word address, Byte value)
+{
+  for (int i = 0; i < breakpoints->count; i++)
+    {
+      const Breakpoint *entry = &breakpoints->entries[i];
+      if (entry->kind == kind && address >= entry->low
+          && address <= entry->high
+          && breakpoints_condition_holds (cpu, &entry->condition, value))
+        {
+          return entry->id;
+        }
+    }
+  return 0;
+}
+
+static void
+breakpoints_trigger (Breakpoints *breakpoints, int id, BreakKind kind,
+                     Word address, Byte value)
+{
+  if (breakpoints->hit.triggered)
+    {
+      return; // Keep the first hit of the instruction
+    }
+  breakpoints->hit.triggered = true;
+  breakpoints->hit.id = id;
+  breakpoints->hit.kind = kind;
+  breakpoints->hit.address = address;
+  breakpoints->hit.value = value;
+  breakpoints->hit.pc = breakpoints->instructionPC;
+}
+
+// Called when PC's execute bit is set; true if the instruction must not run.
+static bool
+breakpoints_stop (Breakpoints *breakpoints, const CPU *cpu)
+{
+  if (breakpoints->resumeArmed)
+    {
+      breakpoints->resumeArmed = false;
+      if (breakpoints->resumePC == cpu->PC)
+        {
+          return false;
+        }
+    }
+
+  Byte opcode = cpu->Memory[cpu->PC];
+  int id = breakpoints_match (breakpoints, cpu, BREAK_EXECUTE, cpu->PC,
+                              opcode);
+  if (id == 0)
+    {
+      return false;
+    }
+
+  breakpoints_trigger (breakpoints, id, BREAK_EXECUTE, cpu->PC, opcode);
+  return true;
+}
+
+#ifdef ACE64_WATCHPOINTS
+void
+breakpoints_access (CPU *cpu, BreakKind kind, Word address, Byte value)
+{
+  Breakpoints *breakpoints = cpu->breakpoints;
+  int id = breakpoints_match (breakpoints, cpu, kind, address, value);
+  if (id != 0)
+    {
+      breakpoints_trigger (breakpoints, id, kind, address, value);
+    }
+}
+#endif
+
+Uint64
+breakpoints_run (CPU *cpu, Breakpoints *breakpoints, Uint64 max,
+                 Uint64 *cycles)
+{
+  Uint64 executed = 0;
+  Uint64 total = 0;
+  const Uint64 *executeBits = breakpoints->bits[BREAK_EXECUTE];
+
+#ifdef ACE64_WATCHPOINTS
+  // Only hook the accessors while there is something to watch.
+  bool watching = false;
+  for (int i = 0; i < breakpoints->count; i++)
+    {
+      watching = watching || breakpoints->entries[i].kind != BREAK_EXECUTE;
+    }
+  cpu->breakpoints = watching ? breakpoints : NULL;
+#endif
+
+  while (executed < max && !breakpoints->hit.triggered)
+    {
+      breakpoints->instructionPC = cpu->PC;
+      if (breakpoints_test (executeBits, cpu->PC)
+          && breakpoints_stop (breakpoints, cpu))
+        {
+          break;
+        }
+
+      total += execute (cpu);
+      executed++;
+    }
+
+#ifdef ACE64_WATCHPOINTS
+  cpu->breakpoints = NULL;
+#endif
+
+  if (cycles != NULL)
+    {
+      *cycles = total;
+    }
+  return executed;
+}
@@ -0,0 +1,136 @@
+#ifndef BREAKPOINTS_H_
+#define BREAKPOINTS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* breakpoints.h
+ * Execute breakpoints and read/write watchpoints.  Every breakpoint marks
+ * its address range in one of three 64K-bit bitmaps, so a check is a single
+ * bit test; a breakpoint's register condition is only evaluated when its bit
+ * is hit.
+ *
+ * Execute breakpoints are tested by breakpoints_run() before each
+ * instruction, so code that calls execute() directly pays nothing for them.
+ * Watchpoints need hooks in read_byte/write_byte, which are only built into
+ * the core when ACE64_WATCHPOINTS is defined (cmake -DACE64_WATCHPOINTS=ON);
+ * even then the hooks are a NULL test outside breakpoints_run().
+ */
+#include "cpu.h"
+
+#define MAX_BREAKPOINTS 64
+
+typedef enum
+{
+  BREAK_EXECUTE, // Stop before the instruction at the address executes
+  BREAK_READ,    // Stop after an instruction reads the address
+  BREAK_WRITE,   // Stop after an instruction writes the address
+  BREAK_KINDS
+} BreakKind;
+
+typedef enum
+{
+  REGISTER_A,
+  REGISTER_X,
+  REGISTER_Y,
+  REGISTER_P,
+  REGISTER_SP,
+  REGISTER_PC,
+  REGISTER_VALUE // The byte read or written; the opcode for BREAK_EXECUTE
+} ConditionRegister;
+
+typedef enum
+{
+  CONDITION_ALWAYS,
+  CONDITION_EQUAL,
+  CONDITION_NOT_EQUAL,
+  CONDITION_LESS,
+  CONDITION_LESS_EQUAL,
+  CONDITION_GREATER,
+  CONDITION_GREATER_EQUAL,
+  CONDITION_BITS_SET,  // (register & value) != 0
+  CONDITION_BITS_CLEAR // (register & value) == 0
+} ConditionOperator;
+
+typedef struct
+{
+  ConditionRegister reg;
+  ConditionOperator op;
+  Word value;
+} BreakCondition;
+
+typedef struct
+{
+  int id;
+  BreakKind kind;
+  Word low;
+  Word high; // Inclusive
+  BreakCondition condition;
+} Breakpoint;
+
+typedef struct
+{
+  bool triggered;
+  int id;
+  BreakKind kind;
+  Word address;
+  Byte value;
+  Word pc; // Address of the instruction that hit
+} BreakpointHit;
+
+struct Breakpoints
+{
+  Uint64 bits[BREAK_KINDS][MAX_MEMORY / 64];
+  Breakpoint entries[MAX_BREAKPOINTS];
+  int count;
+  int nextId;
+
+  BreakpointHit hit;
+
+  // Run state kept by breakpoints_run().
+  Word instructionPC;
+  bool resumeArmed;
+  Word resumePC;
+};
+
+static inline bool
+breakpoints_test (const Uint64 *bits, Word address)
+{
+  return (bits[address >> 6] >> (address & 63)) & 1;
+}
+
+void breakpoints_init (Breakpoints *breakpoints);
+
+// Adds a breakpoint over [low, high]; condition may be NULL.  Returns its id,
+// or -1 if the set is full or a watchpoint was asked for in a build without
+// ACE64_WATCHPOINTS.
+int breakpoints_add (Breakpoints *breakpoints, BreakKind kind, Word low,
+                     Word high, const BreakCondition *condition);
+bool breakpoints_remove (Breakpoints *breakpoints, int id);
+void breakpoints_remove_all (Breakpoints *breakpoints);
+
+// Clears the last hit.  If the CPU stopped at an execute breakpoint, the
+// next execute() at that PC runs the instruction instead of stopping again.
+void breakpoints_resume (Breakpoints *breakpoints);
+
+bool breakpoints_condition_holds (const CPU *cpu,
+                                  const BreakCondition *condition, Byte value);
+
+// Runs until a breakpoint or watchpoint triggers or max instructions have
+// executed.  Returns the number of instructions executed; *cycles (may be
+// NULL) receives their cycles.  An execute breakpoint stops before its
+// instruction; a watchpoint stops after the instruction that hit it.
+Uint64 breakpoints_run (CPU *cpu, Breakpoints *breakpoints, Uint64 max,
+                        Uint64 *cycles);
+
+#ifdef ACE64_WATCHPOINTS
+// Core hook, called from the memory accessors when the address's bit is set.
+void breakpoints_access (CPU *cpu, BreakKind kind, Word address, Byte value);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
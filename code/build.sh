@@ -1,6 +1,6 @@
 mkdir -p ../../build
 pushd ../../build
-gcc -g -o ace64 ../ace64/code/ace64.c ../ace64/code/cpu.h ../ace64/code/cpu.c ../ace64/code/opcodes.h ../ace64/code/opcodes.c -lpthread -Llib -Wall -Wno-write-strings -Wno-unused-variable
+gcc -g -o ace64 ../ace64/code/ace64.c ../ace64/code/cpu.h ../ace64/code/cpu.c ../ace64/code/opcodes.h ../ace64/code/opcodes.c ../ace64/code/run.c ../ace64/code/batch.c ../ace64/code/resultcache.c ../ace64/code/breakpoints.c -lpthread -Llib -Wall -Wno-write-strings -Wno-unused-variable
 
 chmod +x ace64
 popd
@@ -0,0 +1,181 @@
+#include "codemap.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ACE64_CODEMAP
+void
+codemap_attach (CPU *cpu, CodeMap *map)
+{
+  cpu->codemap = map;
+}
+#endif
+
+void
+codemap_clear (CodeMap *map)
+{
+  memset (map, 0, sizeof (*map));
+}
+
+void
+codemap_modified (CodeMap *map, Word address)
+{
+  map->attributes[address] |= CODEMAP_MODIFIED;
+
+  Uint32 key = (Uint32)map->instructionPC << 16 | address;
+  Uint32 slot = (key * 2654435761u) >> 20; // 12 bits: CODEMAP_HOTSPOTS
+  for (Uint32 probe = 0; probe < CODEMAP_HOTSPOTS; probe++)
+    {
+      CodeMapHotspot *hotspot
+          = &map->hotspots[(slot + probe) & (CODEMAP_HOTSPOTS - 1)];
+      if (hotspot->count == 0)
+        {
+          hotspot->writerPC = map->instructionPC;
+          hotspot->address = address;
+          hotspot->count = 1;
+          map->hotspotCount++;
+          return;
+        }
+      if (hotspot->writerPC == map->instructionPC
+          && hotspot->address == address)
+        {
+          hotspot->count += hotspot->count != UINT32_MAX;
+          return;
+        }
+    }
+  map->droppedWrites++;
+}
+
+CodeMapClass
+codemap_class (const CodeMap *map, Word address)
+{
+  Byte attributes = map->attributes[address];
+  if (attributes & CODEMAP_MODIFIED)
+    return CODEMAP_SELF_MODIFIED;
+  if (attributes & CODEMAP_EXECUTED)
+    return attributes & (CODEMAP_READ | CODEMAP_WRITTEN)
+               ? CODEMAP_CODE_AND_DATA
+               : CODEMAP_CODE;
+  if (attributes & (CODEMAP_READ | CODEMAP_WRITTEN))
+    return CODEMAP_DATA;
+  return CODEMAP_UNUSED;
+}
+
+const char *
+codemap_class_name (CodeMapClass mapClass)
+{
+  static const char *names[] = { "unused", "data", "code", "code+data",
+                                 "self-modified" };
+  return names[mapClass];
+}
+
+static int
+compare_hotspots (const void *a, const void *b)
+{
+  const CodeMapHotspot *left = (const CodeMapHotspot *)a;
+  const CodeMapHotspot *right = (const CodeMapHotspot *)b;
+  if (left->count != right->count)
+    return left->count < right->count ? 1 : -1;
+  if (left->writerPC != right->writerPC)
+    return left->writerPC < right->writerPC ? -1 : 1;
+  return left->address < right->address ? -1 : left->address > right->address;
+}
+
+Uint32
+codemap_hotspots (const CodeMap *map, CodeMapHotspot *hotspots, Uint32 max)
+{
+  CodeMapHotspot *all = (CodeMapHotspot *)malloc (
+      (map->hotspotCount + 1) * sizeof (CodeMapHotspot));
+  if (all == NULL)
+    {
+      return 0;
+    }
+
+  Uint32 count = 0;
+  for (Uint32 i = 0; i < CODEMAP_HOTSPOTS; i++)
+    {
+      if (map->hotspots[i].count != 0)
+        {
+          all[count++] = map->hotspots[i];
+        }
+    }
+  qsort (all, count, sizeof (CodeMapHotspot), compare_hotspots);
+
+  if (count > max)
+    {
+      count = max;
+    }
+  memcpy (hotspots, all, count * sizeof (CodeMapHotspot));
+  free (all);
+  return count;
+}
+
+bool
+codemap_write_map (const CodeMap *map, FILE *file)
+{
+  Uint32 start = 0;
+  for (Uint32 address = 1; address <= MAX_MEMORY; address++)
+    {
+      CodeMapClass runClass = codemap_class (map, (Word)start);
+      if (address < MAX_MEMORY
+          && codemap_class (map, (Word)address) == runClass)
+        {
+          continue;
+        }
+      if (runClass != CODEMAP_UNUSED)
+        {
+          fprintf (file, "$%04X-$%04X %s\n", start, address - 1,
+                   codemap_class_name (runClass));
+        }
+      start = address;
+    }
+  return !ferror (file);
+}
+
+bool
+codemap_write_report (const CodeMap *map, Uint32 limit, FILE *file)
+{
+  Uint32 max = limit == 0 ? CODEMAP_HOTSPOTS : limit;
+  CodeMapHotspot *hotspots
+      = (CodeMapHotspot *)malloc (max * sizeof (CodeMapHotspot));
+  if (hotspots == NULL)
+    {
+      return false;
+    }
+  Uint32 count = codemap_hotspots (map, hotspots, max);
+
+  Uint64 writes = map->droppedWrites;
+  for (Uint32 i = 0; i < CODEMAP_HOTSPOTS; i++)
+    {
+      writes += map->hotspots[i].count;
+    }
+  fprintf (file,
+           "Self-modifying writes: %llu from %u writer/address pairs",
+           (unsigned long long)writes, map->hotspotCount);
+  if (map->droppedWrites > 0)
+    {
+      fprintf (file, " (%llu writes not attributed)",
+               (unsigned long long)map->droppedWrites);
+    }
+  fprintf (file, "\n");
+  if (count > 0)
+    {
+      fprintf (file, "%12s  %-6s  %s\n", "writes", "writer", "modified");
+    }
+  for (Uint32 i = 0; i < count; i++)
+    {
+      fprintf (file, "%12u  $%04X   $%04X\n", hotspots[i].count,
+               hotspots[i].writerPC, hotspots[i].address);
+    }
+  free (hotspots);
+
+  fprintf (file, "\nWrites to code pages:\n");
+  for (int page = 0; page < 256; page++)
+    {
+      if (map->codePageWrites[page] != 0)
+        {
+          fprintf (file, "  page $%02X  %u\n", page,
+                   map->codePageWrites[page]);
+        }
+    }
+  return !ferror (file);
+}
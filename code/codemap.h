@@ -0,0 +1,117 @@
+#ifndef CODEMAP_H_
+#define CODEMAP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* codemap.h
+ * Code/data classification and self-modifying code detection.  Every
+ * address collects attribute bits as it is executed (fetched through PC,
+ * operands included), read or written.  A write to a byte that was already
+ * executed is a self-modifying write, counted per (writing PC, modified
+ * address) pair; writes anywhere in a page that holds executed code are
+ * counted per page, since those are what invalidate cached translations.
+ *
+ * Recording is only built into the core when ACE64_CODEMAP is defined
+ * (cmake -DACE64_CODEMAP=ON).  The report functions are always available.
+ */
+#include "cpu.h"
+#include <stdio.h>
+
+#define CODEMAP_EXECUTED 0x01
+#define CODEMAP_READ 0x02
+#define CODEMAP_WRITTEN 0x04
+#define CODEMAP_MODIFIED 0x08 // Written after it was executed
+
+#define CODEMAP_HOTSPOTS 4096 // Distinct (writer, address) pairs kept
+
+typedef enum
+{
+  CODEMAP_UNUSED,
+  CODEMAP_DATA,          // Read or written, never executed
+  CODEMAP_CODE,          // Executed only
+  CODEMAP_CODE_AND_DATA, // Executed and also read or written as data
+  CODEMAP_SELF_MODIFIED  // Written after being executed
+} CodeMapClass;
+
+typedef struct
+{
+  Word writerPC; // Instruction that wrote
+  Word address;  // Executed byte it overwrote
+  Uint32 count;  // Zero marks an empty slot
+} CodeMapHotspot;
+
+struct CodeMap
+{
+  Byte attributes[MAX_MEMORY];
+  Byte codePages[256]; // Nonzero once any byte of the page has executed
+  Uint32 codePageWrites[256];
+
+  // Open-addressed table of self-modifying writes.
+  CodeMapHotspot hotspots[CODEMAP_HOTSPOTS];
+  Uint32 hotspotCount;
+  Uint64 droppedWrites; // Self-modifying writes whose pair did not fit
+
+  Word instructionPC; // Set by execute() while attached
+};
+
+// Out of line: self-modifying writes are rare.
+void codemap_modified (CodeMap *map, Word address);
+
+static inline void
+codemap_execute (CodeMap *map, Word address)
+{
+  map->attributes[address] |= CODEMAP_EXECUTED;
+  map->codePages[address >> 8] = 1;
+}
+
+static inline void
+codemap_read (CodeMap *map, Word address)
+{
+  map->attributes[address] |= CODEMAP_READ;
+}
+
+static inline void
+codemap_write (CodeMap *map, Word address)
+{
+  Byte attributes = map->attributes[address];
+  map->attributes[address] = attributes | CODEMAP_WRITTEN;
+  if (map->codePages[address >> 8])
+    {
+      Uint32 *writes = &map->codePageWrites[address >> 8];
+      *writes += *writes != UINT32_MAX;
+      if (attributes & CODEMAP_EXECUTED)
+        {
+          codemap_modified (map, address);
+        }
+    }
+}
+
+#ifdef ACE64_CODEMAP
+// Starts recording into map (which is not cleared); NULL stops.
+void codemap_attach (CPU *cpu, CodeMap *map);
+#endif
+
+void codemap_clear (CodeMap *map);
+
+CodeMapClass codemap_class (const CodeMap *map, Word address);
+const char *codemap_class_name (CodeMapClass mapClass);
+
+// Copies up to max hotspots, most frequent first.  Returns the number copied.
+Uint32 codemap_hotspots (const CodeMap *map, CodeMapHotspot *hotspots,
+                         Uint32 max);
+
+// Text map, one line per run of addresses of the same class, e.g.
+// "$0200-$02FF code".  Unused runs are left out.
+bool codemap_write_map (const CodeMap *map, FILE *file);
+
+// Self-modifying code report: the top hotspots (limit, 0 for all) with the
+// writing PC and the modified address, then the code pages by write count.
+bool codemap_write_report (const CodeMap *map, Uint32 limit, FILE *file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
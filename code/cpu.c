@@ -1,9 +1,131 @@
 #include "cpu.h"
 #include "opcodes.h"
+#include "trace_ring.h"
 #include <stdbool.h>
 #include <stdio.h>
 
-static const OpcodeFunction opcodes[256] = {
+#ifdef ACE64_HEATMAP
+#include "heatmap.h"
+#define HEATMAP_COUNT(cpu, counters, address)                                \
+  do                                                                          \
+    {                                                                         \
+      if ((cpu)->heatmap != NULL)                                             \
+        {                                                                     \
+          heatmap_count (&(cpu)->heatmap->counters[(Word)(address)]);         \
+        }                                                                     \
+    }                                                                         \
+  while (0)
+#else
+#define HEATMAP_COUNT(cpu, counters, address) ((void)0)
+#endif
+
+#ifdef ACE64_WATCHPOINTS
+#include "breakpoints.h"
+#define WATCH(cpu, kind, address, value)                                      \
+  do                                                                          \
+    {                                                                         \
+      if ((cpu)->breakpoints != NULL                                          \
+          && breakpoints_test ((cpu)->breakpoints->bits[kind],                \
+                               (Word)(address)))                              \
+        {                                                                     \
+          breakpoints_access ((cpu), (kind), (Word)(address), (value));       \
+        }                                                                     \
+    }                                                                         \
+  while (0)
+#else
+#define WATCH(cpu, kind, address, value) ((void)0)
+#endif
+
+#ifdef ACE64_LAST_WRITER
+#include "writers.h"
+#define LAST_WRITE(cpu, address)                                              \
+  do                                                                          \
+    {                                                                         \
+      if ((cpu)->lastWriters != NULL)                                         \
+        {                                                                     \
+          (cpu)->lastWriters->stamps[(Word)(address)]                         \
+              = (cpu)->lastWriters->stamp;                                    \
+        }                                                                     \
+    }                                                                         \
+  while (0)
+#else
+#define LAST_WRITE(cpu, address) ((void)0)
+#endif
+
+#ifdef ACE64_CODEMAP
+#include "codemap.h"
+#define CODEMAP_MARK(cpu, kind, address)                                      \
+  do                                                                          \
+    {                                                                         \
+      if ((cpu)->codemap != NULL)                                             \
+        {                                                                     \
+          codemap_##kind ((cpu)->codemap, (Word)(address));                   \
+        }                                                                     \
+    }                                                                         \
+  while (0)
+#else
+#define CODEMAP_MARK(cpu, kind, address) ((void)0)
+#endif
+
+#ifdef ACE64_STATE_HASH
+#include "statehash.h"
+#define STATE_HASH_WRITE(cpu, address, value)                                 \
+  do                                                                          \
+    {                                                                         \
+      if ((cpu)->stateHash != NULL)                                           \
+        {                                                                     \
+          statehash_update ((cpu)->stateHash, (Word)(address),                \
+                            (cpu)->Memory[(Word)(address)], (value));         \
+        }                                                                     \
+    }                                                                         \
+  while (0)
+#else
+#define STATE_HASH_WRITE(cpu, address, value) ((void)0)
+#endif
+
+#ifdef ACE64_MEMO
+#include "memo.h"
+#define MEMO_ACCESS(cpu, kind, address)                                       \
+  do                                                                          \
+    {                                                                         \
+      if ((cpu)->memo != NULL && (cpu)->memo->record != NULL)                 \
+        {                                                                     \
+          MEMO_##kind ((cpu), (Word)(address));                               \
+        }                                                                     \
+    }                                                                         \
+  while (0)
+#define MEMO_read(cpu, address)                                               \
+  memo_read ((cpu)->memo, (address), (cpu)->Memory[(address)])
+#define MEMO_write(cpu, address) memo_write ((cpu)->memo, (address))
+#else
+#define MEMO_ACCESS(cpu, kind, address) ((void)0)
+#endif
+
+#ifdef ACE64_LOOPS
+#include "loops.h"
+#endif
+
+#ifdef ACE64_HLE
+#include "hle.h"
+#endif
+
+#ifdef ACE64_HOSTCALL
+#include "hostcall.h"
+#endif
+
+#ifdef ACE64_TAINT
+#include "taint.h"
+#define TAINT_READ(cpu, address)                                              \
+  ((cpu)->taint.current |= (cpu)->taint.memory[(Word)(address)]              \
+                           | (cpu)->taint.sources[(Word)(address)])
+#define TAINT_WRITE(cpu, address)                                             \
+  ((cpu)->taint.memory[(Word)(address)] = (cpu)->taint.current)
+#else
+#define TAINT_READ(cpu, address) ((void)0)
+#define TAINT_WRITE(cpu, address) ((void)0)
+#endif
+
+const OpcodeFunction opcode_table[256] = {
 ins_brk, ins_ora_idx, ins_nop /*JAM*/, NULL, ins_nop /*zp*/, ins_ora_zp, ins_asl_zp, NULL, ins_php, ins_ora_im, ins_asl_acc, NULL, ins_nop /*abs*/, ins_ora_abs, ins_asl_abs, NULL,
 ins_bpl, ins_ora_idy, ins_nop /*JAM*/, NULL, ins_nop /*zpx*/, ins_ora_zpx, ins_asl_zpx, NULL, ins_clc, ins_ora_aby, ins_nop /*imp*/, NULL, ins_nop /*abx*/, ins_ora_abx, ins_asl_abx, NULL,
 ins_jsr, ins_and_idx, ins_nop /*JAM*/, NULL, ins_bit_zp, ins_and_zp, ins_rol_zp, NULL, ins_plp, ins_and_im, ins_rol_acc, NULL, ins_bit_abs, ins_and_abs, ins_rol_abs, NULL,
@@ -69,6 +191,41 @@ reset (CPU *cpu)
 
   cpu->P = FLAG_UNDEFINED | FLAG_INTERRUPT_DISABLE;
 
+  cpu->dispatch = opcode_table;
+  cpu->profile = NULL;
+  cpu->trace = NULL;
+  cpu->stepping = false;
+#ifdef ACE64_HEATMAP
+  cpu->heatmap = NULL;
+#endif
+#ifdef ACE64_WATCHPOINTS
+  cpu->breakpoints = NULL;
+#endif
+#ifdef ACE64_LAST_WRITER
+  cpu->lastWriters = NULL;
+#endif
+#ifdef ACE64_CODEMAP
+  cpu->codemap = NULL;
+#endif
+#ifdef ACE64_STATE_HASH
+  cpu->stateHash = NULL;
+#endif
+#ifdef ACE64_MEMO
+  cpu->memo = NULL;
+#endif
+#ifdef ACE64_LOOPS
+  cpu->loops = NULL;
+#endif
+#ifdef ACE64_HLE
+  cpu->hle = NULL;
+#endif
+#ifdef ACE64_HOSTCALL
+  cpu->hostcalls = NULL;
+#endif
+#ifdef ACE64_TAINT
+  taint_reset (cpu);
+#endif
+
   initialize_memory (cpu);
 }
 
@@ -76,6 +233,9 @@ Byte
 fetch_byte (CPU *cpu, Sint32 *cycles)
 {
   Byte Data = cpu->Memory[cpu->PC];
+  HEATMAP_COUNT (cpu, executes, cpu->PC);
+  CODEMAP_MARK (cpu, execute, cpu->PC);
+  MEMO_ACCESS (cpu, read, cpu->PC);
   cpu->PC++;
   *cycles += 1;
   return (Data);
@@ -88,17 +248,31 @@ fetch_byte (CPU *cpu, Sint32 *cycles)
 void
 burn_cycle (CPU *cpu, Sint32 *cycles)
 {
+#ifdef ACE64_CODEMAP
+  // The dummy read at PC is not a data access; keep it off the code map.
+  CodeMap *codemap = cpu->codemap;
+  cpu->codemap = NULL;
+  Byte data = read_byte (cpu, cpu->PC, cycles);
+  cpu->codemap = codemap;
+#else
   Byte data = read_byte (cpu, cpu->PC, cycles);
+#endif
 }
 
 Word
 fetch_word (CPU *cpu, Sint32 *cycles)
 {
   Word data = cpu->Memory[cpu->PC];
+  HEATMAP_COUNT (cpu, executes, cpu->PC);
+  CODEMAP_MARK (cpu, execute, cpu->PC);
+  MEMO_ACCESS (cpu, read, cpu->PC);
   cpu->PC++;
 
   *cycles += 1;
   data |= (cpu->Memory[cpu->PC] << 8);
+  HEATMAP_COUNT (cpu, executes, cpu->PC);
+  CODEMAP_MARK (cpu, execute, cpu->PC);
+  MEMO_ACCESS (cpu, read, cpu->PC);
   cpu->PC++;
 
   *cycles += 1;
@@ -110,6 +284,11 @@ Byte
 read_byte (CPU *cpu, Word address, Sint32 *cycles)
 {
   Byte data = cpu->Memory[address];
+  HEATMAP_COUNT (cpu, reads, address);
+  CODEMAP_MARK (cpu, read, address);
+  MEMO_ACCESS (cpu, read, address);
+  WATCH (cpu, BREAK_READ, address, data);
+  TAINT_READ (cpu, address);
   *cycles += 1;
   return (data);
 }
@@ -118,8 +297,18 @@ Word
 read_word (CPU *cpu, Byte address, Sint32 *cycles)
 {
   Word Data = cpu->Memory[address];
+  HEATMAP_COUNT (cpu, reads, address);
+  CODEMAP_MARK (cpu, read, address);
+  MEMO_ACCESS (cpu, read, address);
+  WATCH (cpu, BREAK_READ, address, Data);
+  TAINT_READ (cpu, address);
   *cycles += 1;
   Data = cpu->Memory[address + 1] << 8;
+  HEATMAP_COUNT (cpu, reads, address + 1);
+  CODEMAP_MARK (cpu, read, address + 1);
+  MEMO_ACCESS (cpu, read, address + 1);
+  WATCH (cpu, BREAK_READ, address + 1, Data >> 8);
+  TAINT_READ (cpu, address + 1);
   *cycles += 1;
 
   return (Data);
@@ -127,15 +316,36 @@ read_word (CPU *cpu, Byte address, Sint32 *cycles)
 void
 write_byte (CPU *cpu, Word address, Byte value, Sint32 *cycles)
 {
+  STATE_HASH_WRITE (cpu, address, value);
   cpu->Memory[address] = value;
+  HEATMAP_COUNT (cpu, writes, address);
+  CODEMAP_MARK (cpu, write, address);
+  WATCH (cpu, BREAK_WRITE, address, value);
+  LAST_WRITE (cpu, address);
+  MEMO_ACCESS (cpu, write, address);
+  TAINT_WRITE (cpu, address);
   *cycles += 1;
 }
 
 void
 write_word (CPU *cpu, Word value, Byte address, Sint32 *cycles)
 {
+  STATE_HASH_WRITE (cpu, address, value & 0xFF);
+  STATE_HASH_WRITE (cpu, address - 1, value >> 8);
   cpu->Memory[address] = value & 0xFF;
   cpu->Memory[address - 1] = (value >> 8);
+  HEATMAP_COUNT (cpu, writes, address);
+  CODEMAP_MARK (cpu, write, address);
+  HEATMAP_COUNT (cpu, writes, address - 1);
+  CODEMAP_MARK (cpu, write, address - 1);
+  WATCH (cpu, BREAK_WRITE, address, value & 0xFF);
+  WATCH (cpu, BREAK_WRITE, address - 1, value >> 8);
+  LAST_WRITE (cpu, address);
+  LAST_WRITE (cpu, address - 1);
+  MEMO_ACCESS (cpu, write, address);
+  MEMO_ACCESS (cpu, write, address - 1);
+  TAINT_WRITE (cpu, address);
+  TAINT_WRITE (cpu, address - 1);
   *cycles += 2;
 }
 
@@ -179,6 +389,40 @@ get_word_address (Byte loByte, Byte hiByte)
   return address;
 }
 
+#if defined(ACE64_LOOPS) || defined(ACE64_MEMO)
+// Native loops and replayed calls bypass the memory accessors and the
+// dispatch table, so they only run while nothing is watching individual
+// instructions or accesses, or stepping through them.
+static bool
+fast_paths_allowed (const CPU *cpu)
+{
+  bool watched = cpu->stepping || cpu->trace != NULL
+                 || cpu->dispatch != opcode_table;
+#ifdef ACE64_HEATMAP
+  watched = watched || cpu->heatmap != NULL;
+#endif
+#ifdef ACE64_WATCHPOINTS
+  watched = watched || cpu->breakpoints != NULL;
+#endif
+#ifdef ACE64_LAST_WRITER
+  watched = watched || cpu->lastWriters != NULL;
+#endif
+#ifdef ACE64_CODEMAP
+  watched = watched || cpu->codemap != NULL;
+#endif
+#ifdef ACE64_STATE_HASH
+  watched = watched || cpu->stateHash != NULL;
+#endif
+#ifdef ACE64_MEMO
+  watched = watched || (cpu->memo != NULL && cpu->memo->record != NULL);
+#endif
+#ifdef ACE64_TAINT
+  watched = true;
+#endif
+  return !watched;
+}
+#endif
+
 // TODO:  If we want to emulate something cycle exact, we would want these
 // instructions to be designed in a way that there are discrete steps:
 //        - Cycle 1: Get instruction from the Program Counter
@@ -198,17 +442,121 @@ execute (CPU *cpu)
 {
 
   Sint32 cycles = 0;
+  // Before the trap path, which writes memory too.
+#ifdef ACE64_LAST_WRITER
+  LastWriters *writers = cpu->lastWriters;
+  if (writers != NULL)
+    {
+      writers->stamp = writers_stamp (writers->cycle, cpu->PC);
+    }
+#endif
+#ifdef ACE64_MEMO
+  Memo *memo = cpu->memo;
+  if (memo != NULL && fast_paths_allowed (cpu))
+    {
+      Sint32 replayed = memo_begin (cpu, memo);
+      if (replayed != 0)
+        {
+          return replayed;
+        }
+    }
+#endif
+#ifdef ACE64_HLE
+  if (cpu->hle != NULL && !cpu->stepping)
+    {
+      Sint32 trapped = hle_run (cpu, cpu->hle);
+      if (trapped != 0)
+        {
+#ifdef ACE64_MEMO
+          if (memo != NULL && memo->record != NULL)
+            {
+              memo_abort (memo);
+            }
+#endif
+#ifdef ACE64_LAST_WRITER
+          if (writers != NULL)
+            {
+              writers->cycle += trapped;
+            }
+#endif
+          return trapped;
+        }
+    }
+#endif
+#ifdef ACE64_LOOPS
+  if (cpu->loops != NULL && fast_paths_allowed (cpu))
+    {
+      Sint32 native = loops_run (cpu, cpu->loops);
+      if (native != 0)
+        {
+          return native;
+        }
+    }
+#endif
+  Trace *trace = cpu->trace;
+  TraceRecord *record = trace != NULL ? trace_begin (trace, cpu) : NULL;
+#ifdef ACE64_CODEMAP
+  if (cpu->codemap != NULL)
+    {
+      cpu->codemap->instructionPC = cpu->PC;
+    }
+#endif
+#ifdef ACE64_TAINT
+  Word taintRule = taint_begin (cpu, cpu->Memory[cpu->PC]);
+#endif
 
   Byte instruction = fetch_byte (cpu, &cycles); // One cycle
 
-  if (opcodes[instruction] != NULL)
+  OpcodeFunction handler = cpu->dispatch[instruction];
+
+#ifdef ACE64_HOSTCALL
+  // Ahead of the handler: the profiled table has no NULL slots.
+  if (cpu->hostcalls != NULL && instruction == cpu->hostcalls->opcode)
     {
-      opcodes[instruction](cpu, &cycles);
+#ifdef ACE64_MEMO
+      if (memo != NULL && memo->record != NULL)
+        {
+          memo_abort (memo);
+        }
+#endif
+      hostcall_run (cpu, cpu->hostcalls, &cycles);
+    }
+  else
+#endif
+  if (handler != NULL)
+    {
+      handler (cpu, &cycles);
     }
   else
     {
       printf ("Operation not handled");
     }
 
+  if (record != NULL)
+    {
+      trace_end (trace, record, cycles);
+    }
+#ifdef ACE64_LAST_WRITER
+  if (writers != NULL)
+    {
+      writers->cycle += cycles;
+    }
+#endif
+#ifdef ACE64_TAINT
+  taint_end (cpu, taintRule);
+#endif
+#ifdef ACE64_MEMO
+  if (memo != NULL)
+    {
+      memo_end (cpu, memo, cycles);
+    }
+#endif
+
   return cycles;
 }
+
+bool
+is_opcode_implemented (Byte opcode)
+{
+  return opcode_table[opcode] != NULL;
+}
@@ -316,8 +316,37 @@ typedef signed char SByte;
 
 typedef uint32_t Uint32;
 typedef int32_t Sint32;
+typedef uint64_t Uint64;
+
+typedef struct CPU CPU;
+typedef struct OpcodeProfile OpcodeProfile;
+typedef struct Heatmap Heatmap;
+typedef struct Trace Trace;
+typedef struct Breakpoints Breakpoints;
+typedef struct LastWriters LastWriters;
+typedef struct CodeMap CodeMap;
+typedef struct StateHash StateHash;
+typedef struct Memo Memo;
+typedef struct Loops Loops;
+typedef struct Hle Hle;
+typedef struct HostCalls HostCalls;
 
+typedef void (*OpcodeFunction)(CPU *cpu, Sint32 *cycles);
+
+#ifdef ACE64_TAINT
+// Taint tags for the taint-tracking instantiation of the core; see taint.h.
 typedef struct
+{
+  Byte memory[MAX_MEMORY];
+  Byte sources[MAX_MEMORY]; // ORed into every read of the address
+  Byte a, x, y, p, sp;
+  Byte pc;      // Tags of the last indirect jump or return target
+  Byte current; // Tags flowing through the executing instruction
+  Word rules[256];
+} TaintState;
+#endif
+
+struct CPU
 {
   Word PC; // Program Counter
   Byte SP; // Stack Pointer
@@ -328,9 +357,50 @@ typedef struct
   Byte X; // X Index Register
   Byte Y; // Y Index Register
   Byte Memory[MAX_MEMORY];
-} CPU;
 
-typedef void (*OpcodeFunction)(CPU *cpu, Sint32 *cycles);
+  // Dispatch table used by execute().  reset() selects the plain table;
+  // profile_attach() swaps in the instrumented one for this instance only.
+  const OpcodeFunction *dispatch;
+  OpcodeProfile *profile;
+  Trace *trace; // NULL unless trace_attach() armed a trace
+  // Set by run_until() while every execute() must run exactly one
+  // instruction: no replayed calls, native loops or traps.
+  bool stepping;
+
+#ifdef ACE64_HEATMAP
+  Heatmap *heatmap; // NULL unless heatmap_attach() was called
+#endif
+#ifdef ACE64_WATCHPOINTS
+  Breakpoints *breakpoints; // Set only inside breakpoints_run()
+#endif
+#ifdef ACE64_LAST_WRITER
+  LastWriters *lastWriters; // NULL unless writers_attach() was called
+#endif
+#ifdef ACE64_CODEMAP
+  CodeMap *codemap; // NULL unless codemap_attach() was called
+#endif
+#ifdef ACE64_STATE_HASH
+  StateHash *stateHash; // NULL unless statehash_attach() was called
+#endif
+#ifdef ACE64_MEMO
+  Memo *memo; // NULL unless memo_attach() was called
+#endif
+#ifdef ACE64_LOOPS
+  Loops *loops; // NULL unless loops_attach() was called
+#endif
+#ifdef ACE64_HLE
+  Hle *hle; // NULL unless hle_attach() was called
+#endif
+#ifdef ACE64_HOSTCALL
+  HostCalls *hostcalls; // NULL unless hostcall_attach() was called
+#endif
+#ifdef ACE64_TAINT
+  TaintState taint;
+#endif
+};
+
+// The plain dispatch table: one handler per opcode, NULL if unimplemented.
+extern const OpcodeFunction opcode_table[256];
 
 void initialize_memory (CPU *cpu);
 void reset (CPU *cpu);
@@ -348,6 +418,7 @@ Byte get_flag (CPU *cpu, Byte flagToGet);
 Byte get_carry_flag(CPU *cpu);
 Word get_word_address (Byte loByte, Byte hiByte);
 Sint32 execute (CPU *cpu);
+bool is_opcode_implemented (Byte opcode);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,731 @@
+#include "explore.h"
+#include "statehash.h"
+#include "support.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define VISITED_SHARDS 64 // Selected by the top six bits of the state hash
+
+typedef struct
+{
+  atomic_uint refs;
+  Byte bytes[EXPLORE_CHUNK_SIZE];
+} Chunk;
+
+typedef struct
+{
+  Chunk *chunks[EXPLORE_CHUNKS];
+  Uint64 memoryHash;
+  Uint64 hash;
+  double score;
+  Word PC;
+  Byte SP, P, A, X, Y;
+  int depth;
+  Byte inputs[]; // The depth inputs leading here
+} Snapshot;
+
+typedef struct
+{
+  Snapshot **items;
+  size_t count;
+  size_t capacity;
+} SnapshotList;
+
+typedef struct
+{
+  const ExploreOptions *options;
+  pthread_mutex_t visitedLocks[VISITED_SHARDS];
+  StateSet visited[VISITED_SHARDS];
+
+  atomic_size_t liveStates;
+  atomic_size_t liveChunks;
+  atomic_size_t peakStates;
+  atomic_size_t peakChunks;
+  atomic_ullong childrenRun;
+  atomic_bool stop;   // The child limit was reached
+  atomic_bool failed; // Memory ran out
+
+  // Guards everything below.
+  pthread_mutex_t lock;
+  pthread_cond_t changed;
+  ExploreStats stats;
+  CPU *best;
+  Byte *bestInputs;
+
+  // Breadth-first: the level being expanded and the next one.
+  SnapshotList *level;
+  atomic_size_t nextIndex;
+  SnapshotList nextLevel;
+
+  // Depth-first: the shared stack and the number of workers expanding.
+  SnapshotList stack;
+  int busy;
+} Explorer;
+
+typedef struct
+{
+  Explorer *explorer;
+  CPU *cpu;
+  ExploreStats stats;
+  SnapshotList children;
+} Worker;
+
+static void
+note_peak (atomic_size_t *peak, size_t value)
+{
+  size_t seen = atomic_load (peak);
+  while (value > seen && !atomic_compare_exchange_weak (peak, &seen, value))
+    {
+    }
+}
+
+static Chunk *
+chunk_new (Explorer *explorer, const Byte *bytes)
+{
+  Chunk *chunk = (Chunk *)malloc (sizeof (Chunk));
+  if (chunk == NULL)
+    {
+      atomic_store (&explorer->failed, true);
+      return NULL;
+    }
+  atomic_init (&chunk->refs, 1);
+  memcpy (chunk->bytes, bytes, EXPLORE_CHUNK_SIZE);
+  note_peak (&explorer->peakChunks,
+             atomic_fetch_add (&explorer->liveChunks, 1) + 1);
+  return chunk;
+}
+
+static void
+chunk_release (Explorer *explorer, Chunk *chunk)
+{
+  if (chunk != NULL && atomic_fetch_sub (&chunk->refs, 1) == 1)
+    {
+      free (chunk);
+      atomic_fetch_sub (&explorer->liveChunks, 1);
+    }
+}
+
+// Returns NULL, counting nothing, if maxStates snapshots are alive.
+static Snapshot *
+snapshot_new (Explorer *explorer)
+{
+  size_t maxStates = explorer->options->maxStates;
+  size_t live = atomic_fetch_add (&explorer->liveStates, 1) + 1;
+  if (maxStates != 0 && live > maxStates)
+    {
+      atomic_fetch_sub (&explorer->liveStates, 1);
+      return NULL;
+    }
+
+  Snapshot *snapshot = (Snapshot *)calloc (
+      1, sizeof (Snapshot) + (size_t)explorer->options->maxDepth);
+  if (snapshot == NULL)
+    {
+      atomic_fetch_sub (&explorer->liveStates, 1);
+      atomic_store (&explorer->failed, true);
+      return NULL;
+    }
+  note_peak (&explorer->peakStates, live);
+  return snapshot;
+}
+
+static void
+snapshot_free (Explorer *explorer, Snapshot *snapshot)
+{
+  for (int c = 0; c < EXPLORE_CHUNKS; c++)
+    {
+      chunk_release (explorer, snapshot->chunks[c]);
+    }
+  free (snapshot);
+  atomic_fetch_sub (&explorer->liveStates, 1);
+}
+
+static void
+snapshot_load (CPU *cpu, const Snapshot *snapshot)
+{
+  for (int c = 0; c < EXPLORE_CHUNKS; c++)
+    {
+      memcpy (&cpu->Memory[c * EXPLORE_CHUNK_SIZE], snapshot->chunks[c]->bytes,
+              EXPLORE_CHUNK_SIZE);
+    }
+  cpu->PC = snapshot->PC;
+  cpu->SP = snapshot->SP;
+  cpu->P = snapshot->P;
+  cpu->A = snapshot->A;
+  cpu->X = snapshot->X;
+  cpu->Y = snapshot->Y;
+}
+
+static bool
+list_push (SnapshotList *list, Snapshot *snapshot)
+{
+  if (list->count == list->capacity)
+    {
+      size_t capacity = list->capacity != 0 ? list->capacity * 2 : 64;
+      Snapshot **items
+          = (Snapshot **)realloc (list->items, capacity * sizeof (*items));
+      if (items == NULL)
+        {
+          return false;
+        }
+      list->items = items;
+      list->capacity = capacity;
+    }
+  list->items[list->count++] = snapshot;
+  return true;
+}
+
+static void
+list_free (Explorer *explorer, SnapshotList *list)
+{
+  for (size_t i = 0; i < list->count; i++)
+    {
+      snapshot_free (explorer, list->items[i]);
+    }
+  free (list->items);
+  memset (list, 0, sizeof (*list));
+}
+
+// Best first; equal scores in hash order, so a beam does not depend on
+// which thread finished first.
+static int
+compare_best_first (const void *left, const void *right)
+{
+  const Snapshot *a = *(Snapshot *const *)left;
+  const Snapshot *b = *(Snapshot *const *)right;
+  if (a->score != b->score)
+    {
+      return a->score > b->score ? -1 : 1;
+    }
+  return a->hash < b->hash ? -1 : a->hash > b->hash;
+}
+
+// Returns 1 if hash is new, 0 if seen, -1 if the set could not grow.
+static int
+visit (Explorer *explorer, Uint64 hash)
+{
+  int shard = (int)(hash >> 58);
+  pthread_mutex_lock (&explorer->visitedLocks[shard]);
+  int added = stateset_insert (&explorer->visited[shard], hash);
+  pthread_mutex_unlock (&explorer->visitedLocks[shard]);
+  return added;
+}
+
+static void
+record_best (Explorer *explorer, const CPU *cpu, const Snapshot *parent,
+             Byte input, double score)
+{
+  pthread_mutex_lock (&explorer->lock);
+  ExploreStats *stats = &explorer->stats;
+  if (!stats->found || score > stats->bestScore)
+    {
+      stats->found = true;
+      stats->bestScore = score;
+      stats->bestDepth = parent->depth + 1;
+      if (explorer->best != NULL)
+        {
+          memcpy (explorer->best, cpu, sizeof (CPU));
+        }
+      if (explorer->bestInputs != NULL)
+        {
+          memcpy (explorer->bestInputs, parent->inputs, parent->depth);
+          explorer->bestInputs[parent->depth] = input;
+        }
+    }
+  pthread_mutex_unlock (&explorer->lock);
+}
+
+// Decides the fate of a child that has run in the worker's CPU, whose
+// memory hash is memoryHash and whose changed chunks are set in changed.
+// Returns its snapshot, or NULL if it was pruned, dropped or is not to be
+// expanded.
+static Snapshot *
+keep_child (Worker *worker, const Snapshot *parent, Byte input, bool halted,
+            Uint64 memoryHash, Uint64 changed)
+{
+  Explorer *explorer = worker->explorer;
+  const ExploreOptions *options = explorer->options;
+  CPU *cpu = worker->cpu;
+  Uint64 hash = memoryHash ^ statehash_registers (cpu);
+
+  int added = visit (explorer, hash);
+  if (added < 0)
+    {
+      atomic_store (&explorer->failed, true);
+      return NULL;
+    }
+  if (added == 0)
+    {
+      worker->stats.duplicates++;
+      return NULL;
+    }
+
+  double score = options->score != NULL
+                     ? options->score (cpu, parent->depth + 1, options->user)
+                     : 0.0;
+  if (score < 0.0)
+    {
+      worker->stats.pruned++;
+      return NULL;
+    }
+  record_best (explorer, cpu, parent, input, score);
+
+  if (halted)
+    {
+      worker->stats.halted++;
+      return NULL;
+    }
+  if (parent->depth + 1 >= options->maxDepth)
+    {
+      return NULL;
+    }
+
+  Snapshot *child = snapshot_new (explorer);
+  if (child == NULL)
+    {
+      worker->stats.dropped++;
+      return NULL;
+    }
+  for (int c = 0; c < EXPLORE_CHUNKS; c++)
+    {
+      if (changed & (1ULL << c))
+        {
+          child->chunks[c]
+              = chunk_new (explorer, &cpu->Memory[c * EXPLORE_CHUNK_SIZE]);
+          if (child->chunks[c] == NULL)
+            {
+              snapshot_free (explorer, child);
+              return NULL;
+            }
+        }
+      else
+        {
+          child->chunks[c] = parent->chunks[c];
+          atomic_fetch_add (&child->chunks[c]->refs, 1);
+        }
+    }
+  child->memoryHash = memoryHash;
+  child->hash = hash;
+  child->score = score;
+  child->PC = cpu->PC;
+  child->SP = cpu->SP;
+  child->P = cpu->P;
+  child->A = cpu->A;
+  child->X = cpu->X;
+  child->Y = cpu->Y;
+  child->depth = parent->depth + 1;
+  memcpy (child->inputs, parent->inputs, parent->depth);
+  child->inputs[parent->depth] = input;
+  return child;
+}
+
+// Runs one child of parent, which is loaded into the worker's CPU, and
+// restores the CPU to the parent's state afterwards.
+static Snapshot *
+run_child (Worker *worker, const Snapshot *parent, Byte input)
+{
+  const ExploreOptions *options = worker->explorer->options;
+  CPU *cpu = worker->cpu;
+
+  worker->stats.children++;
+  cpu->Memory[options->inputAddress] = input;
+
+  bool halted = false;
+  for (Uint32 step = 0; step < options->stepLimit; step++)
+    {
+      if (!is_opcode_implemented (cpu->Memory[cpu->PC]))
+        {
+          halted = true;
+          break;
+        }
+      execute (cpu);
+      if (options->stopAtPC && cpu->PC == options->stopPC)
+        {
+          break;
+        }
+    }
+
+  // Find the chunks the run changed and update the hash byte by byte.
+  Uint64 changed = 0;
+  Uint64 memoryHash = parent->memoryHash;
+  for (int c = 0; c < EXPLORE_CHUNKS; c++)
+    {
+      const Byte *before = parent->chunks[c]->bytes;
+      const Byte *after = &cpu->Memory[c * EXPLORE_CHUNK_SIZE];
+      if (memcmp (before, after, EXPLORE_CHUNK_SIZE) == 0)
+        {
+          continue;
+        }
+      changed |= 1ULL << c;
+      for (int i = 0; i < EXPLORE_CHUNK_SIZE; i++)
+        {
+          if (before[i] != after[i])
+            {
+              Word address = (Word)(c * EXPLORE_CHUNK_SIZE + i);
+              memoryHash ^= statehash_key (address, before[i])
+                            ^ statehash_key (address, after[i]);
+            }
+        }
+    }
+
+  Snapshot *child
+      = keep_child (worker, parent, input, halted, memoryHash, changed);
+
+  for (int c = 0; c < EXPLORE_CHUNKS; c++)
+    {
+      if (changed & (1ULL << c))
+        {
+          memcpy (&cpu->Memory[c * EXPLORE_CHUNK_SIZE],
+                  parent->chunks[c]->bytes, EXPLORE_CHUNK_SIZE);
+        }
+    }
+  cpu->PC = parent->PC;
+  cpu->SP = parent->SP;
+  cpu->P = parent->P;
+  cpu->A = parent->A;
+  cpu->X = parent->X;
+  cpu->Y = parent->Y;
+  return child;
+}
+
+// Runs every child of parent into worker->children.
+static void
+expand (Worker *worker, const Snapshot *parent)
+{
+  Explorer *explorer = worker->explorer;
+  const ExploreOptions *options = explorer->options;
+
+  worker->stats.expanded++;
+  snapshot_load (worker->cpu, parent);
+  for (int i = 0; i < options->inputCount; i++)
+    {
+      if (atomic_load (&explorer->stop) || atomic_load (&explorer->failed))
+        {
+          return;
+        }
+      if (options->childLimit != 0
+          && atomic_fetch_add (&explorer->childrenRun, 1)
+                 >= options->childLimit)
+        {
+          atomic_store (&explorer->stop, true);
+          return;
+        }
+
+      Snapshot *child = run_child (worker, parent, options->inputs[i]);
+      if (child != NULL && !list_push (&worker->children, child))
+        {
+          snapshot_free (explorer, child);
+          atomic_store (&explorer->failed, true);
+        }
+    }
+}
+
+static void
+merge_stats (ExploreStats *total, const ExploreStats *stats)
+{
+  total->expanded += stats->expanded;
+  total->children += stats->children;
+  total->duplicates += stats->duplicates;
+  total->pruned += stats->pruned;
+  total->dropped += stats->dropped;
+  total->halted += stats->halted;
+}
+
+static bool
+worker_init (Worker *worker, Explorer *explorer)
+{
+  memset (worker, 0, sizeof (*worker));
+  worker->explorer = explorer;
+  worker->cpu = (CPU *)malloc (sizeof (CPU));
+  if (worker->cpu == NULL)
+    {
+      return false;
+    }
+  reset (worker->cpu); // A private CPU with nothing attached
+  return true;
+}
+
+static void
+worker_finish (Worker *worker)
+{
+  Explorer *explorer = worker->explorer;
+  pthread_mutex_lock (&explorer->lock);
+  merge_stats (&explorer->stats, &worker->stats);
+  pthread_mutex_unlock (&explorer->lock);
+  list_free (explorer, &worker->children);
+  free (worker->cpu);
+}
+
+// Breadth-first worker: expands states of the current level until none are
+// left, then hands its children over to the next level.
+static void *
+breadth_worker (void *argument)
+{
+  Worker worker;
+  Explorer *explorer = (Explorer *)argument;
+  if (!worker_init (&worker, explorer))
+    {
+      atomic_store (&explorer->failed, true);
+      return NULL;
+    }
+
+  for (;;)
+    {
+      size_t index = atomic_fetch_add (&explorer->nextIndex, 1);
+      if (index >= explorer->level->count || atomic_load (&explorer->stop)
+          || atomic_load (&explorer->failed))
+        {
+          break;
+        }
+      expand (&worker, explorer->level->items[index]);
+    }
+
+  pthread_mutex_lock (&explorer->lock);
+  for (size_t i = 0; i < worker.children.count; i++)
+    {
+      if (!list_push (&explorer->nextLevel, worker.children.items[i]))
+        {
+          snapshot_free (explorer, worker.children.items[i]);
+          atomic_store (&explorer->failed, true);
+        }
+    }
+  pthread_mutex_unlock (&explorer->lock);
+  worker.children.count = 0;
+
+  worker_finish (&worker);
+  return NULL;
+}
+
+// Depth-first worker: pops the most recent state off the shared stack and
+// pushes its children back, best on top, until the stack is empty and no
+// other worker can add to it.
+static void *
+depth_worker (void *argument)
+{
+  Worker worker;
+  Explorer *explorer = (Explorer *)argument;
+  if (!worker_init (&worker, explorer))
+    {
+      atomic_store (&explorer->failed, true);
+      return NULL;
+    }
+
+  pthread_mutex_lock (&explorer->lock);
+  for (;;)
+    {
+      while (explorer->stack.count == 0 && explorer->busy > 0
+             && !atomic_load (&explorer->stop)
+             && !atomic_load (&explorer->failed))
+        {
+          pthread_cond_wait (&explorer->changed, &explorer->lock);
+        }
+      if (explorer->stack.count == 0 || atomic_load (&explorer->stop)
+          || atomic_load (&explorer->failed))
+        {
+          break;
+        }
+
+      Snapshot *parent = explorer->stack.items[--explorer->stack.count];
+      explorer->busy++;
+      pthread_mutex_unlock (&explorer->lock);
+
+      expand (&worker, parent);
+      snapshot_free (explorer, parent);
+      qsort (worker.children.items, worker.children.count,
+             sizeof (Snapshot *), compare_best_first);
+
+      pthread_mutex_lock (&explorer->lock);
+      while (worker.children.count > 0)
+        {
+          Snapshot *child = worker.children.items[--worker.children.count];
+          if (!list_push (&explorer->stack, child))
+            {
+              snapshot_free (explorer, child);
+              atomic_store (&explorer->failed, true);
+            }
+        }
+      explorer->busy--;
+      pthread_cond_broadcast (&explorer->changed);
+    }
+  pthread_cond_broadcast (&explorer->changed);
+  pthread_mutex_unlock (&explorer->lock);
+
+  worker_finish (&worker);
+  return NULL;
+}
+
+static void
+run_threads (Explorer *explorer, int threadCount, void *(*worker) (void *))
+{
+  pthread_t *threads = (pthread_t *)calloc (threadCount, sizeof (pthread_t));
+  if (threads == NULL)
+    {
+      atomic_store (&explorer->failed, true);
+      return;
+    }
+
+  int started = 0;
+  while (started < threadCount
+         && pthread_create (&threads[started], NULL, worker, explorer) == 0)
+    {
+      started++;
+    }
+  if (started == 0)
+    {
+      worker (explorer); // Run on the calling thread instead
+    }
+  for (int t = 0; t < started; t++)
+    {
+      pthread_join (threads[t], NULL);
+    }
+  free (threads);
+}
+
+static void
+explore_breadth_first (Explorer *explorer, Snapshot *root, int threadCount)
+{
+  const ExploreOptions *options = explorer->options;
+  SnapshotList level = { 0 };
+  if (!list_push (&level, root))
+    {
+      snapshot_free (explorer, root);
+      atomic_store (&explorer->failed, true);
+      return;
+    }
+
+  while (level.count > 0 && !atomic_load (&explorer->stop)
+         && !atomic_load (&explorer->failed))
+    {
+      explorer->level = &level;
+      atomic_store (&explorer->nextIndex, 0);
+      run_threads (explorer, threadCount, breadth_worker);
+      list_free (explorer, &level);
+
+      level = explorer->nextLevel;
+      memset (&explorer->nextLevel, 0, sizeof (explorer->nextLevel));
+      if (options->beamWidth != 0 && level.count > options->beamWidth)
+        {
+          qsort (level.items, level.count, sizeof (Snapshot *),
+                 compare_best_first);
+          for (size_t i = options->beamWidth; i < level.count; i++)
+            {
+              snapshot_free (explorer, level.items[i]);
+            }
+          explorer->stats.dropped += level.count - options->beamWidth;
+          level.count = options->beamWidth;
+        }
+    }
+  list_free (explorer, &level);
+}
+
+static void
+explore_depth_first (Explorer *explorer, Snapshot *root, int threadCount)
+{
+  if (!list_push (&explorer->stack, root))
+    {
+      snapshot_free (explorer, root);
+      atomic_store (&explorer->failed, true);
+      return;
+    }
+  run_threads (explorer, threadCount, depth_worker);
+  list_free (explorer, &explorer->stack);
+}
+
+static Snapshot *
+snapshot_root (Explorer *explorer, const CPU *root)
+{
+  Snapshot *snapshot = snapshot_new (explorer);
+  if (snapshot == NULL)
+    {
+      return NULL;
+    }
+
+  for (int c = 0; c < EXPLORE_CHUNKS; c++)
+    {
+      snapshot->chunks[c]
+          = chunk_new (explorer, &root->Memory[c * EXPLORE_CHUNK_SIZE]);
+      if (snapshot->chunks[c] == NULL)
+        {
+          snapshot_free (explorer, snapshot);
+          return NULL;
+        }
+    }
+  snapshot->hash = statehash_compute (root);
+  snapshot->memoryHash = snapshot->hash ^ statehash_registers (root);
+  snapshot->PC = root->PC;
+  snapshot->SP = root->SP;
+  snapshot->P = root->P;
+  snapshot->A = root->A;
+  snapshot->X = root->X;
+  snapshot->Y = root->Y;
+  return snapshot;
+}
+
+bool
+explore_run (const CPU *root, const ExploreOptions *options,
+             ExploreStats *stats, CPU *best, Byte *bestInputs)
+{
+  memset (stats, 0, sizeof (*stats));
+  if (options->inputs == NULL || options->inputCount <= 0
+      || options->stepLimit == 0 || options->maxDepth <= 0)
+    {
+      return false;
+    }
+
+  int threadCount = support_thread_count (options->threads);
+
+  Explorer *explorer = (Explorer *)calloc (1, sizeof (Explorer));
+  if (explorer == NULL)
+    {
+      return false;
+    }
+  explorer->options = options;
+  explorer->best = best;
+  explorer->bestInputs = bestInputs;
+  pthread_mutex_init (&explorer->lock, NULL);
+  pthread_cond_init (&explorer->changed, NULL);
+  bool ok = true;
+  for (int s = 0; s < VISITED_SHARDS; s++)
+    {
+      pthread_mutex_init (&explorer->visitedLocks[s], NULL);
+      ok = stateset_init (&explorer->visited[s], 1024) && ok;
+    }
+
+  Snapshot *start = ok ? snapshot_root (explorer, root) : NULL;
+  if (start != NULL && visit (explorer, start->hash) >= 0)
+    {
+      if (options->order == EXPLORE_DEPTH_FIRST)
+        {
+          explore_depth_first (explorer, start, threadCount);
+        }
+      else
+        {
+          explore_breadth_first (explorer, start, threadCount);
+        }
+    }
+  else
+    {
+      if (start != NULL)
+        {
+          snapshot_free (explorer, start);
+        }
+      atomic_store (&explorer->failed, true);
+    }
+
+  *stats = explorer->stats;
+  stats->peakStates = atomic_load (&explorer->peakStates);
+  stats->peakChunks = atomic_load (&explorer->peakChunks);
+  ok = !atomic_load (&explorer->failed);
+
+  for (int s = 0; s < VISITED_SHARDS; s++)
+    {
+      stateset_free (&explorer->visited[s]);
+      pthread_mutex_destroy (&explorer->visitedLocks[s]);
+    }
+  pthread_cond_destroy (&explorer->changed);
+  pthread_mutex_destroy (&explorer->lock);
+  free (explorer);
+  return ok;
+}
@@ -0,0 +1,87 @@
+#ifndef EXPLORE_H_
+#define EXPLORE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* explore.h
+ * State-space exploration: from a root state, every input of an alphabet is
+ * tried in turn, each child running until it reaches a stop PC or a step
+ * limit, and the children are expanded again breadth- or depth-first across
+ * a pool of threads.
+ *
+ * States are copy-on-write snapshots: 64 reference-counted 1 KiB chunks
+ * plus the registers, so a child only owns the chunks its run changed.
+ * Children whose state hash (statehash.h) has been seen before are pruned,
+ * and a scoring callback guides the search: negative scores prune, breadth-
+ * first keeps the best beamWidth states of each level, and depth-first
+ * expands the best child first.  Depth-first pruning is global, so a state
+ * first reached at the depth limit is not expanded from a shallower path.
+ */
+#include "cpu.h"
+#include <stddef.h>
+
+#define EXPLORE_CHUNK_SIZE 1024
+#define EXPLORE_CHUNKS (MAX_MEMORY / EXPLORE_CHUNK_SIZE)
+
+typedef enum
+{
+  EXPLORE_BREADTH_FIRST,
+  EXPLORE_DEPTH_FIRST,
+} ExploreOrder;
+
+// Scores a child after its run; negative prunes it.  Called concurrently
+// from the worker threads, each with its own CPU.
+typedef double (*ExploreScore) (const CPU *cpu, int depth, void *user);
+
+typedef struct
+{
+  ExploreOrder order;
+  int threads; // 0: one per online processor
+
+  Word inputAddress; // Each input is stored here before a child runs
+  const Byte *inputs;
+  int inputCount;
+
+  Uint32 stepLimit; // Instructions a child runs at most
+  bool stopAtPC;    // Also stop a child when it returns to stopPC
+  Word stopPC;
+  int maxDepth;
+
+  size_t beamWidth;  // Breadth-first: best states kept per level (0: all)
+  size_t maxStates;  // Live snapshots at most (0: no limit)
+  Uint64 childLimit; // Children run at most (0: no limit)
+
+  ExploreScore score; // NULL: every child scores 0
+  void *user;
+} ExploreOptions;
+
+typedef struct
+{
+  Uint64 expanded;   // States whose children were run
+  Uint64 children;   // Children run
+  Uint64 duplicates; // Pruned by state hash
+  Uint64 pruned;     // Pruned by a negative score
+  Uint64 dropped;    // Discarded by the beam or maxStates
+  Uint64 halted;     // Stopped at an unimplemented opcode; not expanded
+  size_t peakStates; // Most snapshots alive at once
+  size_t peakChunks; // Most chunks alive at once
+
+  bool found;       // A child was scored
+  double bestScore; // Ties go to whichever child was scored first
+  int bestDepth;
+} ExploreStats;
+
+// Explores from root, which is not modified.  If found, the best child's
+// state is copied to best and its inputs to bestInputs (maxDepth bytes);
+// either may be NULL.  Returns false if the options are invalid or memory
+// ran out.
+bool explore_run (const CPU *root, const ExploreOptions *options,
+                  ExploreStats *stats, CPU *best, Byte *bestInputs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,246 @@
+#include "cpu.h"
+#include "support.h"
+#include "trace.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* functional.c
+ * Runs Klaus Dormann's 6502 functional test (or the decimal-mode test) to
+ * its trap and reports pass/fail along with the emulated speed.
+ *
+ * Both tests end in a "JMP *" (or "Bxx *") self-loop.  The functional test
+ * passes if it traps at the success address; the decimal test passes if its
+ * ERROR byte is zero when it stops.  The decimal test's default end_of_test
+ * macro emits $DB (65C02 STP), so an unimplemented opcode also ends the run.
+ *
+ * With -t the run is traced and, if it fails, the last records are dumped
+ * for ace64-trace.
+ */
+
+#define FUNCTIONAL_LOAD_ADDRESS 0x0000
+#define FUNCTIONAL_ENTRY_POINT 0x0400
+#define FUNCTIONAL_SUCCESS_TRAP 0x3469
+
+#define DECIMAL_LOAD_ADDRESS 0x0200
+#define DECIMAL_ENTRY_POINT 0x0200
+#define DECIMAL_ERROR_ADDRESS 0x000B
+
+#define DEFAULT_INSTRUCTION_LIMIT 500000000ULL
+#define DEFAULT_TRACE_RECORDS (1u << 20)
+
+typedef struct
+{
+  const char *path;
+  Word loadAddress;
+  Word entryPoint;
+  long successTrap;  // -1 when the pass check uses errorAddress instead
+  long errorAddress; // -1 when the pass check uses successTrap instead
+  unsigned long long instructionLimit;
+  const char *tracePath;
+  Uint32 traceRecords;
+} HarnessOptions;
+
+typedef struct
+{
+  Word stopPC;
+  bool trapped;
+  bool unimplemented;
+  unsigned long long instructions;
+  unsigned long long cycles;
+  double seconds;
+} HarnessResult;
+
+static void
+print_usage (const char *program)
+{
+  fprintf (stderr,
+           "Usage: %s [options] <image>\n"
+           "  -d            decimal-mode test presets (load/entry $0200, "
+           "ERROR at $000B)\n"
+           "  -l <addr>     load address (default $0000)\n"
+           "  -e <addr>     entry PC (default $0400)\n"
+           "  -s <addr>     success trap PC (default $3469)\n"
+           "  -r <addr>     pass if this byte is zero at the trap\n"
+           "  -m <count>    instruction limit (default %llu)\n"
+           "  -t <file>     trace the run; dump the trace here on failure\n"
+           "  -T <records>  trace ring size (default %u)\n",
+           program, DEFAULT_INSTRUCTION_LIMIT, DEFAULT_TRACE_RECORDS);
+}
+
+static HarnessResult
+run_to_trap (CPU *cpu, unsigned long long instructionLimit)
+{
+  HarnessResult result = { 0 };
+  double start = support_now_seconds ();
+
+  while (result.instructions < instructionLimit)
+    {
+      Word pc = cpu->PC;
+
+      if (!is_opcode_implemented (cpu->Memory[pc]))
+        {
+          result.unimplemented = true;
+          break;
+        }
+
+      result.cycles += execute (cpu);
+      result.instructions++;
+
+      if (cpu->PC == pc)
+        {
+          result.trapped = true;
+          break;
+        }
+    }
+
+  result.stopPC = cpu->PC;
+  result.seconds = support_now_seconds () - start;
+  return result;
+}
+
+int
+main (int argc, char *argv[])
+{
+  HarnessOptions options = { NULL,
+                             FUNCTIONAL_LOAD_ADDRESS,
+                             FUNCTIONAL_ENTRY_POINT,
+                             FUNCTIONAL_SUCCESS_TRAP,
+                             -1,
+                             DEFAULT_INSTRUCTION_LIMIT,
+                             NULL,
+                             DEFAULT_TRACE_RECORDS };
+  Word address;
+  int option;
+
+  while ((option = getopt (argc, argv, "dl:e:s:r:m:t:T:")) != -1)
+    {
+      switch (option)
+        {
+        case 'd':
+          options.loadAddress = DECIMAL_LOAD_ADDRESS;
+          options.entryPoint = DECIMAL_ENTRY_POINT;
+          options.successTrap = -1;
+          options.errorAddress = DECIMAL_ERROR_ADDRESS;
+          break;
+        case 'l':
+        case 'e':
+        case 's':
+        case 'r':
+          if (!support_parse_address (optarg, &address))
+            {
+              fprintf (stderr, "Invalid address: %s\n", optarg);
+              return 2;
+            }
+          if (option == 'l')
+            options.loadAddress = address;
+          else if (option == 'e')
+            options.entryPoint = address;
+          else if (option == 's')
+            options.successTrap = address;
+          else
+            options.errorAddress = address;
+          break;
+        case 'm':
+          options.instructionLimit = strtoull (optarg, NULL, 10);
+          break;
+        case 't':
+          options.tracePath = optarg;
+          break;
+        case 'T':
+          options.traceRecords = (Uint32)strtoul (optarg, NULL, 10);
+          break;
+        default:
+          print_usage (argv[0]);
+          return 2;
+        }
+    }
+
+  if (optind != argc - 1)
+    {
+      print_usage (argv[0]);
+      return 2;
+    }
+  options.path = argv[optind];
+
+  CPU *cpu = (CPU *)malloc (sizeof (CPU));
+  reset (cpu);
+
+  if (support_load_image (cpu, options.path, options.loadAddress, false) < 0)
+    {
+      free (cpu);
+      return 2;
+    }
+  cpu->PC = options.entryPoint;
+
+  Trace *trace = NULL;
+  if (options.tracePath != NULL)
+    {
+      trace = trace_create (options.traceRecords);
+      if (trace == NULL)
+        {
+          fprintf (stderr, "Cannot allocate a %u record trace\n",
+                   options.traceRecords);
+          free (cpu);
+          return 2;
+        }
+      trace_attach (cpu, trace);
+    }
+
+  HarnessResult result = run_to_trap (cpu, options.instructionLimit);
+
+  bool passed = result.trapped || result.unimplemented;
+  if (passed && options.successTrap >= 0)
+    {
+      passed = result.trapped && result.stopPC == options.successTrap;
+    }
+  if (passed && options.errorAddress >= 0)
+    {
+      passed = cpu->Memory[options.errorAddress] == 0;
+    }
+
+  double mhz = result.seconds > 0
+                   ? (double)result.cycles / result.seconds / 1e6
+                   : 0.0;
+  double nsPerInstruction
+      = result.instructions > 0
+            ? result.seconds * 1e9 / (double)result.instructions
+            : 0.0;
+
+  printf ("%s: %s\n", options.path, passed ? "PASS" : "FAIL");
+  printf ("  stopped at $%04X (%s)\n", result.stopPC,
+          result.trapped         ? "self-loop trap"
+          : result.unimplemented ? "unimplemented opcode"
+                                 : "instruction limit");
+  printf ("  instructions: %llu, cycles: %llu, time: %.3f s\n",
+          result.instructions, result.cycles, result.seconds);
+  printf ("  emulated speed: %.2f MHz, %.2f ns/instruction\n", mhz,
+          nsPerInstruction);
+
+  if (trace != NULL && !passed)
+    {
+      FILE *file = fopen (options.tracePath, "wb");
+      if (file == NULL || !trace_write (trace, 0, file))
+        {
+          perror (options.tracePath);
+        }
+      else
+        {
+          Uint64 kept = trace_count (trace);
+          if (kept > trace_capacity (trace))
+            {
+              kept = trace_capacity (trace);
+            }
+          printf ("  trace: last %llu instructions written to %s\n",
+                  (unsigned long long)kept, options.tracePath);
+        }
+      if (file != NULL)
+        {
+          fclose (file);
+        }
+    }
+  trace_destroy (trace);
+
+  free (cpu);
+  return passed ? 0 : 1;
+}
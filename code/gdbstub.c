@@ -0,0 +1,1154 @@
+#include "gdbstub.h"
+#include "breakpoints.h"
+#include "writers.h"
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#define GDB_PACKET_SIZE 4096
+#define GDB_REGISTER_BYTES 7 // A, X, Y, P, SP, PC low, PC high
+#define GDB_REGISTER_COUNT 6
+#define GDB_POLL_INSTRUCTIONS 65536 // Instructions between checks for ^C
+#define GDB_INTERRUPT 0x03
+#define GDB_WRITER_LINES 64 // Addresses listed per "monitor writer"
+
+#define GDB_SIGINT 2
+#define GDB_SIGTRAP 5
+
+// A breakpoint or watchpoint inserted with a Z packet.  Access watchpoints
+// need a read and a write breakpoint.
+typedef struct
+{
+  char type;
+  Word address;
+  Word length;
+  int ids[2];
+} GdbInsertion;
+
+typedef struct
+{
+  CPU *cpu;
+  Breakpoints *breakpoints;
+  int fd;
+  bool noAck;
+
+  Byte input[GDB_PACKET_SIZE];
+  size_t inputLength;
+  size_t inputPosition;
+
+  GdbInsertion insertions[MAX_BREAKPOINTS];
+  int insertionCount;
+
+  char stopReply[32];
+  char packet[GDB_PACKET_SIZE + 1];
+  char reply[GDB_PACKET_SIZE + 1];
+} GdbSession;
+
+// Target description for qXfer:features:read.  gdb has no 6502
+// architecture of its own, so this is what lays out the 'g' packet.
+static const char target_xml[]
+    = "<?xml version=\"1.0\"?>\n"
+      "<!DOCTYPE target SYSTEM \"gdb-target.dtd\">\n"
+      "<target version=\"1.0\">\n"
+      "  <feature name=\"org.ace64.mos6510\">\n"
+      "    <flags id=\"status\" size=\"1\">\n"
+      "      <field name=\"C\" start=\"0\" end=\"0\"/>\n"
+      "      <field name=\"Z\" start=\"1\" end=\"1\"/>\n"
+      "      <field name=\"I\" start=\"2\" end=\"2\"/>\n"
+      "      <field name=\"D\" start=\"3\" end=\"3\"/>\n"
+      "      <field name=\"B\" start=\"4\" end=\"4\"/>\n"
+      "      <field name=\"V\" start=\"6\" end=\"6\"/>\n"
+      "      <field name=\"N\" start=\"7\" end=\"7\"/>\n"
+      "    </flags>\n"
+      "    <reg name=\"a\" bitsize=\"8\" type=\"uint8\" regnum=\"0\"/>\n"
+      "    <reg name=\"x\" bitsize=\"8\" type=\"uint8\"/>\n"
+      "    <reg name=\"y\" bitsize=\"8\" type=\"uint8\"/>\n"
+      "    <reg name=\"p\" bitsize=\"8\" type=\"status\"/>\n"
+      "    <reg name=\"sp\" bitsize=\"8\" type=\"uint8\"/>\n"
+      "    <reg name=\"pc\" bitsize=\"16\" type=\"code_ptr\"/>\n"
+      "  </feature>\n"
+      "</target>\n";
+
+static const char *register_names[]
+    = { "a", "x", "y", "p", "sp", "pc", "value" };
+static const char *operator_names[]
+    = { "", "==", "!=", "<", "<=", ">", ">=", "&", "!&" };
+static const char hex_digits[] = "0123456789abcdef";
+
+static int
+hex_value (int c)
+{
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  return -1;
+}
+
+static void
+encode_hex (char *text, const Byte *bytes, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+    {
+      text[2 * i] = hex_digits[bytes[i] >> 4];
+      text[2 * i + 1] = hex_digits[bytes[i] & 0xF];
+    }
+  text[2 * count] = '\0';
+}
+
+// Decodes exactly count bytes; false if text is shorter or not hex.
+static bool
+decode_hex (const char *text, Byte *bytes, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+    {
+      int high = hex_value (text[2 * i]);
+      int low = high < 0 ? -1 : hex_value (text[2 * i + 1]);
+      if (low < 0)
+        {
+          return false;
+        }
+      bytes[i] = (Byte)(high << 4 | low);
+    }
+  return true;
+}
+
+// Parses a hex number and advances *text past it.
+static bool
+parse_hex (const char **text, unsigned long *value)
+{
+  char *end;
+  *value = strtoul (*text, &end, 16);
+  if (end == *text)
+    {
+      return false;
+    }
+  *text = end;
+  return true;
+}
+
+static bool
+write_all (int fd, const char *data, size_t length)
+{
+  while (length > 0)
+    {
+      ssize_t sent = send (fd, data, length, MSG_NOSIGNAL);
+      if (sent < 0 && errno == EINTR)
+        {
+          continue;
+        }
+      if (sent <= 0)
+        {
+          return false;
+        }
+      data += sent;
+      length -= (size_t)sent;
+    }
+  return true;
+}
+
+// Returns the next byte from the client, or -1 once the connection is gone.
+static int
+gdb_getc (GdbSession *session)
+{
+  if (session->inputPosition == session->inputLength)
+    {
+      ssize_t received;
+      do
+        {
+          received = recv (session->fd, session->input,
+                           sizeof (session->input), 0);
+        }
+      while (received < 0 && errno == EINTR);
+      if (received <= 0)
+        {
+          return -1;
+        }
+      session->inputLength = (size_t)received;
+      session->inputPosition = 0;
+    }
+  return session->input[session->inputPosition++];
+}
+
+static bool
+gdb_input_pending (GdbSession *session)
+{
+  if (session->inputPosition < session->inputLength)
+    {
+      return true;
+    }
+  struct pollfd pending = { session->fd, POLLIN, 0 };
+  return poll (&pending, 1, 0) > 0;
+}
+
+// Frames and sends a packet, resending until it is acknowledged.
+static bool
+gdb_send (GdbSession *session, const char *data)
+{
+  char frame[GDB_PACKET_SIZE + 5];
+  size_t length = 0;
+  Byte sum = 0;
+
+  frame[length++] = '$';
+  for (const char *c = data; *c != '\0'; c++)
+    {
+      frame[length++] = *c;
+      sum += (Byte)*c;
+    }
+  frame[length++] = '#';
+  frame[length++] = hex_digits[sum >> 4];
+  frame[length++] = hex_digits[sum & 0xF];
+
+  for (;;)
+    {
+      if (!write_all (session->fd, frame, length))
+        {
+          return false;
+        }
+      if (session->noAck)
+        {
+          return true;
+        }
+
+      int ack;
+      do
+        {
+          ack = gdb_getc (session);
+        }
+      while (ack >= 0 && ack != '+' && ack != '-');
+      if (ack != '-')
+        {
+          return ack == '+';
+        }
+    }
+}
+
+// Reads the next well-formed packet into packet, acknowledging it.  Acks
+// and ^C outside a continue are skipped.
+static bool
+gdb_receive (GdbSession *session, char *packet, size_t size)
+{
+  for (;;)
+    {
+      int c;
+      do
+        {
+          c = gdb_getc (session);
+        }
+      while (c >= 0 && c != '$');
+
+      size_t length = 0;
+      Byte sum = 0;
+      while ((c = gdb_getc (session)) >= 0 && c != '#')
+        {
+          sum += (Byte)c;
+          if (length + 1 < size)
+            {
+              packet[length++] = (char)c;
+            }
+        }
+      int high = c < 0 ? -1 : gdb_getc (session);
+      int low = high < 0 ? -1 : gdb_getc (session);
+      if (low < 0)
+        {
+          return false;
+        }
+      packet[length] = '\0';
+
+      bool valid = hex_value (high) >= 0 && hex_value (low) >= 0
+                   && (hex_value (high) << 4 | hex_value (low)) == sum;
+      if (!session->noAck && !write_all (session->fd, valid ? "+" : "-", 1))
+        {
+          return false;
+        }
+      if (valid)
+        {
+          return true;
+        }
+    }
+}
+
+// Sends text to the client's console.
+static bool
+gdb_console (GdbSession *session, const char *text)
+{
+  char packet[GDB_PACKET_SIZE];
+  size_t length = strlen (text);
+  if (length > (sizeof (packet) - 2) / 2)
+    {
+      length = (sizeof (packet) - 2) / 2;
+    }
+  packet[0] = 'O';
+  encode_hex (packet + 1, (const Byte *)text, length);
+  return gdb_send (session, packet);
+}
+
+static void
+gdb_read_registers (const CPU *cpu, Byte *registers)
+{
+  registers[0] = cpu->A;
+  registers[1] = cpu->X;
+  registers[2] = cpu->Y;
+  registers[3] = cpu->P;
+  registers[4] = cpu->SP;
+  registers[5] = (Byte)(cpu->PC & 0xFF);
+  registers[6] = (Byte)(cpu->PC >> 8);
+}
+
+static void
+gdb_write_registers (CPU *cpu, const Byte *registers)
+{
+  cpu->A = registers[0];
+  cpu->X = registers[1];
+  cpu->Y = registers[2];
+  cpu->P = registers[3];
+  cpu->SP = registers[4];
+  cpu->PC = (Word)(registers[5] | registers[6] << 8);
+}
+
+static void
+gdb_set_stop (GdbSession *session, int signal)
+{
+  snprintf (session->stopReply, sizeof (session->stopReply), "S%02x",
+            signal);
+}
+
+static const GdbInsertion *
+gdb_find_insertion (const GdbSession *session, int id)
+{
+  for (int i = 0; i < session->insertionCount; i++)
+    {
+      const GdbInsertion *insertion = &session->insertions[i];
+      if (insertion->ids[0] == id || insertion->ids[1] == id)
+        {
+          return insertion;
+        }
+    }
+  return NULL;
+}
+
+// Builds the stop reply for the breakpoint engine's hit.
+static void
+gdb_stop_at_hit (GdbSession *session)
+{
+  const BreakpointHit *hit = &session->breakpoints->hit;
+  if (hit->kind == BREAK_EXECUTE)
+    {
+      gdb_set_stop (session, GDB_SIGTRAP);
+      return;
+    }
+
+  const GdbInsertion *insertion = gdb_find_insertion (session, hit->id);
+  const char *reason = hit->kind == BREAK_READ ? "rwatch" : "watch";
+  if (insertion != NULL && insertion->type == '4')
+    {
+      reason = "awatch";
+    }
+  snprintf (session->stopReply, sizeof (session->stopReply), "T%02x%s:%x;",
+            GDB_SIGTRAP, reason, hit->address);
+}
+
+static void
+gdb_step (GdbSession *session)
+{
+  breakpoints_resume (session->breakpoints);
+  breakpoints_run (session->cpu, session->breakpoints, 1, NULL);
+  if (session->breakpoints->hit.triggered)
+    {
+      gdb_stop_at_hit (session);
+    }
+  else
+    {
+      gdb_set_stop (session, GDB_SIGTRAP);
+    }
+}
+
+// Runs in chunks, checking for ^C between them.  False if the connection
+// went away.
+static bool
+gdb_continue (GdbSession *session)
+{
+  breakpoints_resume (session->breakpoints);
+  for (;;)
+    {
+      breakpoints_run (session->cpu, session->breakpoints,
+                       GDB_POLL_INSTRUCTIONS, NULL);
+      if (session->breakpoints->hit.triggered)
+        {
+          gdb_stop_at_hit (session);
+          return true;
+        }
+
+      while (gdb_input_pending (session))
+        {
+          int c = gdb_getc (session);
+          if (c < 0)
+            {
+              return false;
+            }
+          if (c == GDB_INTERRUPT)
+            {
+              gdb_set_stop (session, GDB_SIGINT);
+              return true;
+            }
+        }
+    }
+}
+
+// Handles Z (insert) and z (remove) packets.  Types 0 and 1 are execute
+// breakpoints; 2, 3 and 4 are write, read and access watchpoints.
+static const char *
+gdb_insert (GdbSession *session, const char *arguments, bool insert)
+{
+  char type = arguments[0];
+  const char *text = arguments + 1;
+  unsigned long address, length;
+  if (type < '0' || type > '4' || *text++ != ','
+      || !parse_hex (&text, &address) || *text++ != ','
+      || !parse_hex (&text, &length) || address > 0xFFFF)
+    {
+      return type < '0' || type > '4' ? "" : "E01";
+    }
+#ifndef ACE64_WATCHPOINTS
+  if (type >= '2')
+    {
+      return ""; // Let the client fall back to software watchpoints
+    }
+#endif
+
+  Word low = (Word)address;
+  Word high = low;
+  if (type >= '2' && length > 1)
+    {
+      high = address + length - 1 > 0xFFFF ? 0xFFFF
+                                           : (Word)(address + length - 1);
+    }
+
+  if (!insert)
+    {
+      for (int i = 0; i < session->insertionCount; i++)
+        {
+          GdbInsertion *insertion = &session->insertions[i];
+          if (insertion->type == type && insertion->address == low
+              && insertion->length == (Word)length)
+            {
+              breakpoints_remove (session->breakpoints, insertion->ids[0]);
+              breakpoints_remove (session->breakpoints, insertion->ids[1]);
+              *insertion = session->insertions[--session->insertionCount];
+              break;
+            }
+        }
+      return "OK";
+    }
+
+  if (session->insertionCount == MAX_BREAKPOINTS)
+    {
+      return "E01";
+    }
+  BreakKind kinds[] = { BREAK_EXECUTE, BREAK_EXECUTE, BREAK_WRITE,
+                        BREAK_READ,    BREAK_READ };
+  GdbInsertion *insertion = &session->insertions[session->insertionCount];
+  insertion->type = type;
+  insertion->address = low;
+  insertion->length = (Word)length;
+  insertion->ids[0] = breakpoints_add (session->breakpoints,
+                                       kinds[type - '0'], low, high, NULL);
+  insertion->ids[1] = 0;
+  if (insertion->ids[0] < 0)
+    {
+      return "E01";
+    }
+  if (type == '4')
+    {
+      insertion->ids[1] = breakpoints_add (session->breakpoints, BREAK_WRITE,
+                                           low, high, NULL);
+      if (insertion->ids[1] < 0)
+        {
+          breakpoints_remove (session->breakpoints, insertion->ids[0]);
+          return "E01";
+        }
+    }
+  session->insertionCount++;
+  return "OK";
+}
+
+// Parses "<reg> <op> <value>" from the remaining tokens.
+static bool
+parse_condition (char **save, BreakCondition *condition)
+{
+  const char *reg = strtok_r (NULL, " ", save);
+  const char *op = strtok_r (NULL, " ", save);
+  const char *value = strtok_r (NULL, " ", save);
+  if (reg == NULL || op == NULL || value == NULL
+      || strtok_r (NULL, " ", save) != NULL)
+    {
+      return false;
+    }
+
+  int r = 0;
+  while (r <= REGISTER_VALUE && strcmp (reg, register_names[r]) != 0)
+    {
+      r++;
+    }
+  int o = CONDITION_EQUAL;
+  while (o <= CONDITION_BITS_CLEAR && strcmp (op, operator_names[o]) != 0)
+    {
+      o++;
+    }
+
+  unsigned long number;
+  if (*value == '$')
+    {
+      value++;
+    }
+  if (r > REGISTER_VALUE || o > CONDITION_BITS_CLEAR
+      || !parse_hex (&value, &number) || *value != '\0' || number > 0xFFFF)
+    {
+      return false;
+    }
+
+  condition->reg = (ConditionRegister)r;
+  condition->op = (ConditionOperator)o;
+  condition->value = (Word)number;
+  return true;
+}
+
+// Parses "<lo>[-<hi>]".
+static bool
+parse_range (const char *text, Word *low, Word *high)
+{
+  unsigned long first, last;
+  if (*text == '$')
+    {
+      text++;
+    }
+  if (!parse_hex (&text, &first))
+    {
+      return false;
+    }
+  last = first;
+  if (*text == '-')
+    {
+      text++;
+      if (*text == '$')
+        {
+          text++;
+        }
+      if (!parse_hex (&text, &last))
+        {
+          return false;
+        }
+    }
+  if (*text != '\0' || first > last || last > 0xFFFF)
+    {
+      return false;
+    }
+  *low = (Word)first;
+  *high = (Word)last;
+  return true;
+}
+
+static void
+gdb_monitor_info (GdbSession *session, char *output, size_t size)
+{
+  static const char *kind_names[] = { "break", "read", "write" };
+  size_t length = 0;
+
+  if (session->breakpoints->count == 0)
+    {
+      snprintf (output, size, "No breakpoints.\n");
+      return;
+    }
+  for (int i = 0; i < session->breakpoints->count && length < size; i++)
+    {
+      const Breakpoint *entry = &session->breakpoints->entries[i];
+      length += snprintf (output + length, size - length, "%3d  %-5s  $%04X",
+                          entry->id, kind_names[entry->kind], entry->low);
+      if (length < size && entry->high != entry->low)
+        {
+          length += snprintf (output + length, size - length, "-$%04X",
+                              entry->high);
+        }
+      if (length < size && entry->condition.op != CONDITION_ALWAYS)
+        {
+          length += snprintf (output + length, size - length,
+                              "  if %s %s $%X",
+                              register_names[entry->condition.reg],
+                              operator_names[entry->condition.op],
+                              entry->condition.value);
+        }
+      if (length < size)
+        {
+          length += snprintf (output + length, size - length, "\n");
+        }
+    }
+}
+
+static void
+gdb_monitor_writer (const CPU *cpu, const char *range, char *output,
+                    size_t size)
+{
+#ifdef ACE64_LAST_WRITER
+  Word low, high;
+  if (range == NULL || !parse_range (range, &low, &high))
+    {
+      snprintf (output, size, "Usage: writer <lo>[-<hi>]\n");
+      return;
+    }
+  if (cpu->lastWriters == NULL)
+    {
+      snprintf (output, size, "No last-writer table is attached.\n");
+      return;
+    }
+
+  size_t length = 0;
+  for (Uint32 address = low; address <= high && length < size; address++)
+    {
+      Word pc;
+      Uint64 cycle;
+      if (address - low == GDB_WRITER_LINES)
+        {
+          snprintf (output + length, size - length, "...\n");
+          break;
+        }
+      if (writers_query (cpu->lastWriters, (Word)address, &pc, &cycle))
+        {
+          length += snprintf (output + length, size - length,
+                              "$%04X  written by $%04X at cycle %llu\n",
+                              address, pc, (unsigned long long)cycle);
+        }
+      else
+        {
+          length += snprintf (output + length, size - length,
+                              "$%04X  not written\n", address);
+        }
+    }
+#else
+  (void)cpu;
+  (void)range;
+  snprintf (output, size,
+            "Last-writer queries need an ACE64_LAST_WRITER build.\n");
+#endif
+}
+
+// Runs a monitor command; output is the text for the client's console.
+static void
+gdb_monitor (GdbSession *session, char *command, char *output, size_t size)
+{
+  static const char *usage
+      = "Commands: break <addr> [if <reg> <op> <value>]\n"
+        "          watch [read|write|access] <lo>[-<hi>] [if ...]\n"
+        "          delete [<id>]\n"
+        "          info\n"
+        "          writer <lo>[-<hi>]\n";
+  Breakpoints *breakpoints = session->breakpoints;
+  char *save;
+  const char *verb = strtok_r (command, " ", &save);
+  const char *word = verb == NULL ? NULL : strtok_r (NULL, " ", &save);
+
+  if (verb != NULL && strcmp (verb, "info") == 0)
+    {
+      gdb_monitor_info (session, output, size);
+      return;
+    }
+
+  if (verb != NULL && strcmp (verb, "writer") == 0)
+    {
+      gdb_monitor_writer (session->cpu, word, output, size);
+      return;
+    }
+
+  if (verb != NULL && strcmp (verb, "delete") == 0)
+    {
+      if (word == NULL)
+        {
+          // Keep the client's own Z breakpoints.
+          for (int i = breakpoints->count - 1; i >= 0; i--)
+            {
+              int id = breakpoints->entries[i].id;
+              if (gdb_find_insertion (session, id) == NULL)
+                {
+                  breakpoints_remove (breakpoints, id);
+                }
+            }
+          snprintf (output, size, "Deleted all monitor breakpoints.\n");
+        }
+      else if (gdb_find_insertion (session, atoi (word)) == NULL
+               && breakpoints_remove (breakpoints, atoi (word)))
+        {
+          snprintf (output, size, "Deleted %d.\n", atoi (word));
+        }
+      else
+        {
+          snprintf (output, size, "No monitor breakpoint %s.\n", word);
+        }
+      return;
+    }
+
+  BreakKind kinds[2] = { BREAK_EXECUTE, BREAK_KINDS };
+  if (verb != NULL && strcmp (verb, "watch") == 0)
+    {
+      kinds[0] = BREAK_WRITE;
+      if (word != NULL && strcmp (word, "read") == 0)
+        {
+          kinds[0] = BREAK_READ;
+        }
+      else if (word != NULL && strcmp (word, "access") == 0)
+        {
+          kinds[0] = BREAK_READ;
+          kinds[1] = BREAK_WRITE;
+        }
+      if (word != NULL
+          && (strcmp (word, "read") == 0 || strcmp (word, "write") == 0
+              || strcmp (word, "access") == 0))
+        {
+          word = strtok_r (NULL, " ", &save);
+        }
+    }
+  else if (verb == NULL || strcmp (verb, "break") != 0)
+    {
+      snprintf (output, size, "%s", usage);
+      return;
+    }
+
+  Word low, high;
+  BreakCondition condition = { REGISTER_A, CONDITION_ALWAYS, 0 };
+  const char *keyword = strtok_r (NULL, " ", &save);
+  if (word == NULL || !parse_range (word, &low, &high)
+      || (kinds[0] == BREAK_EXECUTE && high != low)
+      || (keyword != NULL
+          && (strcmp (keyword, "if") != 0
+              || !parse_condition (&save, &condition))))
+    {
+      snprintf (output, size, "%s", usage);
+      return;
+    }
+
+  int ids[2] = { 0, 0 };
+  for (int i = 0; i < 2 && kinds[i] != BREAK_KINDS; i++)
+    {
+      ids[i] = breakpoints_add (breakpoints, kinds[i], low, high,
+                                &condition);
+      if (ids[i] < 0)
+        {
+          if (i > 0)
+            {
+              breakpoints_remove (breakpoints, ids[0]);
+            }
+#ifdef ACE64_WATCHPOINTS
+          snprintf (output, size, "Too many breakpoints.\n");
+#else
+          snprintf (output, size,
+                    kinds[i] == BREAK_EXECUTE
+                        ? "Too many breakpoints.\n"
+                        : "Watchpoints need an ACE64_WATCHPOINTS build.\n");
+#endif
+          return;
+        }
+    }
+
+  if (ids[1] != 0)
+    snprintf (output, size, "Watchpoints %d, %d.\n", ids[0], ids[1]);
+  else if (kinds[0] == BREAK_EXECUTE)
+    snprintf (output, size, "Breakpoint %d at $%04X.\n", ids[0], low);
+  else
+    snprintf (output, size, "Watchpoint %d.\n", ids[0]);
+}
+
+// Handles qRcmd,<hex command>: console output first, then OK.
+static bool
+gdb_query_command (GdbSession *session, const char *hex, char *reply)
+{
+  char command[GDB_PACKET_SIZE / 2 + 1];
+  size_t length = strlen (hex) / 2;
+  if (length >= sizeof (command)
+      || !decode_hex (hex, (Byte *)command, length))
+    {
+      strcpy (reply, "E01");
+      return true;
+    }
+  command[length] = '\0';
+
+  char output[GDB_PACKET_SIZE];
+  output[0] = '\0';
+  gdb_monitor (session, command, output, sizeof (output));
+
+  // One console packet per line keeps each under the packet size.
+  for (char *line = output; *line != '\0';)
+    {
+      char *next = strchr (line, '\n');
+      next = next == NULL ? line + strlen (line) : next + 1;
+      char saved = *next;
+      *next = '\0';
+      if (!gdb_console (session, line))
+        {
+          return false;
+        }
+      *next = saved;
+      line = next;
+    }
+  strcpy (reply, "OK");
+  return true;
+}
+
+// Answers "qXfer:features:read:<annex>:<offset>,<length>".  The
+// description holds none of the characters the binary reply would escape.
+static void
+gdb_read_features (const char *arguments, char *reply, size_t size)
+{
+  static const char annex[] = "target.xml:";
+  unsigned long offset, length;
+  if (strncmp (arguments, annex, sizeof (annex) - 1) != 0)
+    {
+      strcpy (reply, "E00");
+      return;
+    }
+  arguments += sizeof (annex) - 1;
+  if (!parse_hex (&arguments, &offset) || *arguments++ != ','
+      || !parse_hex (&arguments, &length))
+    {
+      strcpy (reply, "E01");
+      return;
+    }
+
+  size_t total = sizeof (target_xml) - 1;
+  size_t start = offset < total ? offset : total;
+  size_t chunk = total - start;
+  if (chunk > length)
+    {
+      chunk = length;
+    }
+  if (chunk > size - 2)
+    {
+      chunk = size - 2;
+    }
+  reply[0] = start + chunk < total ? 'm' : 'l';
+  memcpy (reply + 1, target_xml + start, chunk);
+  reply[1 + chunk] = '\0';
+}
+
+static void
+gdb_read_memory (const CPU *cpu, const char *arguments, char *reply)
+{
+  unsigned long address, length;
+  if (!parse_hex (&arguments, &address) || *arguments++ != ','
+      || !parse_hex (&arguments, &length) || address > 0xFFFF)
+    {
+      strcpy (reply, "E01");
+      return;
+    }
+  if (length > GDB_PACKET_SIZE / 2 - 1)
+    {
+      length = GDB_PACKET_SIZE / 2 - 1;
+    }
+  for (unsigned long i = 0; i < length; i++)
+    {
+      Byte value = cpu->Memory[(Word)(address + i)];
+      encode_hex (reply + 2 * i, &value, 1);
+    }
+  reply[2 * length] = '\0';
+}
+
+static void
+gdb_write_memory (CPU *cpu, const char *arguments, char *reply)
+{
+  unsigned long address, length;
+  Byte bytes[GDB_PACKET_SIZE / 2];
+  if (!parse_hex (&arguments, &address) || *arguments++ != ','
+      || !parse_hex (&arguments, &length) || *arguments++ != ':'
+      || address > 0xFFFF || length > sizeof (bytes)
+      || strlen (arguments) != 2 * length
+      || !decode_hex (arguments, bytes, length))
+    {
+      strcpy (reply, "E01");
+      return;
+    }
+  // Through write_byte, so an attached state hash, code map or last-writer
+  // table sees the change.  No watchpoints are armed between runs.
+  Sint32 cycles = 0;
+  for (unsigned long i = 0; i < length; i++)
+    {
+      write_byte (cpu, (Word)(address + i), bytes[i], &cycles);
+    }
+  strcpy (reply, "OK");
+}
+
+static void
+gdb_register (CPU *cpu, const char *arguments, bool write, char *reply)
+{
+  static const Byte offsets[GDB_REGISTER_COUNT] = { 0, 1, 2, 3, 4, 5 };
+  static const Byte widths[GDB_REGISTER_COUNT] = { 1, 1, 1, 1, 1, 2 };
+  Byte registers[GDB_REGISTER_BYTES];
+  unsigned long index;
+
+  gdb_read_registers (cpu, registers);
+  if (!parse_hex (&arguments, &index) || index >= GDB_REGISTER_COUNT)
+    {
+      strcpy (reply, "E01");
+      return;
+    }
+  if (!write)
+    {
+      encode_hex (reply, registers + offsets[index], widths[index]);
+      return;
+    }
+  if (*arguments++ != '='
+      || strlen (arguments) != 2u * widths[index]
+      || !decode_hex (arguments, registers + offsets[index], widths[index]))
+    {
+      strcpy (reply, "E01");
+      return;
+    }
+  gdb_write_registers (cpu, registers);
+  strcpy (reply, "OK");
+}
+
+// Sets PC from the optional address argument of 's' and 'c'.
+static void
+gdb_resume_address (CPU *cpu, const char *arguments)
+{
+  unsigned long address;
+  if (parse_hex (&arguments, &address) && address <= 0xFFFF)
+    {
+      cpu->PC = (Word)address;
+    }
+}
+
+int
+gdbstub_listen (const char *address)
+{
+  int fd;
+
+  if (strchr (address, '/') != NULL)
+    {
+      struct sockaddr_un local;
+      struct stat existing;
+      memset (&local, 0, sizeof (local));
+      local.sun_family = AF_UNIX;
+      if (strlen (address) >= sizeof (local.sun_path))
+        {
+          errno = ENAMETOOLONG;
+          return -1;
+        }
+      strcpy (local.sun_path, address);
+
+      // Replace a stale socket, but never any other kind of file.
+      if (stat (address, &existing) == 0 && S_ISSOCK (existing.st_mode))
+        {
+          unlink (address);
+        }
+      fd = socket (AF_UNIX, SOCK_STREAM, 0);
+      if (fd < 0)
+        {
+          return -1;
+        }
+      if (bind (fd, (struct sockaddr *)&local, sizeof (local)) < 0
+          || listen (fd, 1) < 0)
+        {
+          int saved = errno;
+          close (fd);
+          errno = saved;
+          return -1;
+        }
+      return fd;
+    }
+
+  char host[256] = "127.0.0.1";
+  const char *port = address;
+  const char *colon = strrchr (address, ':');
+  if (colon != NULL)
+    {
+      size_t length = (size_t)(colon - address);
+      if (length >= sizeof (host))
+        {
+          errno = ENAMETOOLONG;
+          return -1;
+        }
+      if (length > 0)
+        {
+          memcpy (host, address, length);
+          host[length] = '\0';
+        }
+      port = colon + 1;
+    }
+
+  struct addrinfo hints, *found;
+  memset (&hints, 0, sizeof (hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_flags = AI_NUMERICSERV;
+  if (getaddrinfo (host, port, &hints, &found) != 0)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  fd = socket (found->ai_family, found->ai_socktype, found->ai_protocol);
+  if (fd >= 0)
+    {
+      int on = 1;
+      setsockopt (fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof (on));
+      if (bind (fd, found->ai_addr, found->ai_addrlen) < 0
+          || listen (fd, 1) < 0)
+        {
+          int saved = errno;
+          close (fd);
+          errno = saved;
+          fd = -1;
+        }
+    }
+  freeaddrinfo (found);
+  return fd;
+}
+
+GdbSessionEnd
+gdbstub_serve (CPU *cpu, int fd)
+{
+  GdbSession *session = (GdbSession *)calloc (1, sizeof (GdbSession));
+  Breakpoints *breakpoints = (Breakpoints *)malloc (sizeof (Breakpoints));
+  if (session == NULL || breakpoints == NULL)
+    {
+      free (session);
+      free (breakpoints);
+      return GDB_DISCONNECTED;
+    }
+  breakpoints_init (breakpoints);
+  session->cpu = cpu;
+  session->breakpoints = breakpoints;
+  session->fd = fd;
+  gdb_set_stop (session, GDB_SIGTRAP);
+
+  // Replies are small and latency-bound; fails harmlessly on Unix sockets.
+  int on = 1;
+  setsockopt (fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof (on));
+
+  char *packet = session->packet;
+  char *reply = session->reply;
+  GdbSessionEnd end = GDB_DISCONNECTED;
+  bool connected = true;
+
+  while (connected && gdb_receive (session, packet, sizeof (session->packet)))
+    {
+      Byte registers[GDB_REGISTER_BYTES];
+      const char *arguments = packet + 1;
+      bool noAck = false;
+      reply[0] = '\0';
+
+      switch (packet[0])
+        {
+        case '?':
+          strcpy (reply, session->stopReply);
+          break;
+        case 'g':
+          gdb_read_registers (cpu, registers);
+          encode_hex (reply, registers, GDB_REGISTER_BYTES);
+          break;
+        case 'G':
+          if (strlen (arguments) == 2 * GDB_REGISTER_BYTES
+              && decode_hex (arguments, registers, GDB_REGISTER_BYTES))
+            {
+              gdb_write_registers (cpu, registers);
+              strcpy (reply, "OK");
+            }
+          else
+            {
+              strcpy (reply, "E01");
+            }
+          break;
+        case 'p':
+        case 'P':
+          gdb_register (cpu, arguments, packet[0] == 'P', reply);
+          break;
+        case 'm':
+          gdb_read_memory (cpu, arguments, reply);
+          break;
+        case 'M':
+          gdb_write_memory (cpu, arguments, reply);
+          break;
+        case 's':
+          gdb_resume_address (cpu, arguments);
+          gdb_step (session);
+          strcpy (reply, session->stopReply);
+          break;
+        case 'c':
+          gdb_resume_address (cpu, arguments);
+          connected = gdb_continue (session);
+          strcpy (reply, session->stopReply);
+          break;
+        case 'Z':
+        case 'z':
+          strcpy (reply, gdb_insert (session, arguments, packet[0] == 'Z'));
+          break;
+        case 'H':
+          strcpy (reply, "OK");
+          break;
+        case 'q':
+          if (strncmp (packet, "qSupported", 10) == 0)
+            {
+              snprintf (reply, sizeof (session->reply),
+                        "PacketSize=%x;QStartNoAckMode+;"
+                        "qXfer:features:read+",
+                        GDB_PACKET_SIZE);
+            }
+          else if (strncmp (packet, "qXfer:features:read:", 20) == 0)
+            {
+              gdb_read_features (packet + 20, reply,
+                                 sizeof (session->reply));
+            }
+          else if (strcmp (packet, "qAttached") == 0)
+            {
+              strcpy (reply, "1");
+            }
+          else if (strncmp (packet, "qRcmd,", 6) == 0)
+            {
+              connected = gdb_query_command (session, packet + 6, reply);
+            }
+          break;
+        case 'Q':
+          if (strcmp (packet, "QStartNoAckMode") == 0)
+            {
+              strcpy (reply, "OK");
+              noAck = true;
+            }
+          break;
+        case 'D':
+          strcpy (reply, "OK");
+          end = GDB_DETACHED;
+          connected = false;
+          break;
+        case 'k':
+          end = GDB_KILLED;
+          break;
+        }
+
+      if (end == GDB_KILLED)
+        {
+          break;
+        }
+      if (!connected && end != GDB_DETACHED)
+        {
+          break;
+        }
+      if (!gdb_send (session, reply))
+        {
+          end = GDB_DISCONNECTED;
+          break;
+        }
+      session->noAck = session->noAck || noAck;
+    }
+
+  free (breakpoints);
+  free (session);
+  return end;
+}
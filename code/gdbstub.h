@@ -0,0 +1,53 @@
+#ifndef GDBSTUB_H_
+#define GDBSTUB_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* gdbstub.h
+ * GDB remote serial protocol stub.  gdbstub_serve() speaks RSP over a
+ * connected socket: register and memory access, single-step, continue
+ * (interruptible with ^C), and Z/z breakpoints and watchpoints backed by
+ * the bitmap breakpoint engine.
+ *
+ * Registers, in 'g' packet order: A, X, Y, P, SP (one byte each), then PC
+ * (two bytes, little-endian).  gdb has no 6502 architecture, so the stub
+ * serves this layout as target.xml through qXfer:features:read.
+ *
+ * Conditional breakpoints are set with monitor commands and evaluated by
+ * the emulator, so a condition that rarely holds costs no round trips:
+ *
+ *   monitor break <addr> [if <reg> <op> <value>]
+ *   monitor watch [read|write|access] <lo>[-<hi>] [if <reg> <op> <value>]
+ *   monitor delete [<id>]
+ *   monitor info
+ *   monitor writer <lo>[-<hi>]   (who last wrote each address)
+ *
+ * where reg is a, x, y, p, sp, pc or value (the byte accessed), op is one
+ * of == != < <= > >= & (bits set) !& (bits clear), and numbers are hex.
+ * "writer" reads the CPU's last-writer table, if one is attached.
+ */
+#include "cpu.h"
+
+typedef enum
+{
+  GDB_DETACHED,     // The client sent 'D'
+  GDB_KILLED,       // The client sent 'k'
+  GDB_DISCONNECTED, // The connection closed or failed
+} GdbSessionEnd;
+
+// Listens on "[host:]port" (TCP, host defaults to 127.0.0.1) or, if the
+// address contains a '/', on a Unix socket at that path.  Returns the
+// listening socket, or -1 with errno set.
+int gdbstub_listen (const char *address);
+
+// Serves one RSP session on a connected socket.  The CPU is only touched
+// from the calling thread.
+GdbSessionEnd gdbstub_serve (CPU *cpu, int fd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,165 @@
+#include "heatmap.h"
+#include <string.h>
+
+#define HEATMAP_MAGIC "A64H"
+#define HEATMAP_VERSION 1
+
+#ifdef ACE64_HEATMAP
+void
+heatmap_attach (CPU *cpu, Heatmap *heatmap)
+{
+  cpu->heatmap = heatmap;
+}
+#endif
+
+void
+heatmap_clear (Heatmap *heatmap)
+{
+  memset (heatmap, 0, sizeof (*heatmap));
+}
+
+static Uint32
+saturating_add (Uint32 a, Uint32 b)
+{
+  return a > UINT32_MAX - b ? UINT32_MAX : a + b;
+}
+
+static Uint32
+heatmap_value (const Heatmap *heatmap, HeatmapKind kind, Word address)
+{
+  switch (kind)
+    {
+    case HEATMAP_READ:
+      return heatmap->reads[address];
+    case HEATMAP_WRITE:
+      return heatmap->writes[address];
+    case HEATMAP_EXECUTE:
+      return heatmap->executes[address];
+    default:
+      return saturating_add (saturating_add (heatmap->reads[address],
+                                             heatmap->writes[address]),
+                             heatmap->executes[address]);
+    }
+}
+
+Uint32
+heatmap_page_total (const Heatmap *heatmap, HeatmapKind kind, Byte page)
+{
+  Uint32 total = 0;
+  for (int offset = 0; offset < 256; offset++)
+    {
+      total = saturating_add (
+          total, heatmap_value (heatmap, kind, (Word)(page << 8 | offset)));
+    }
+  return total;
+}
+
+static bool
+write_uint32s (const Uint32 *values, Uint32 count, FILE *file)
+{
+  Byte buffer[1024];
+  for (Uint32 i = 0; i < count; i += sizeof (buffer) / 4)
+    {
+      Uint32 chunk = count - i < sizeof (buffer) / 4 ? count - i
+                                                     : sizeof (buffer) / 4;
+      for (Uint32 j = 0; j < chunk; j++)
+        {
+          Uint32 value = values[i + j];
+          buffer[j * 4] = value & 0xFF;
+          buffer[j * 4 + 1] = (value >> 8) & 0xFF;
+          buffer[j * 4 + 2] = (value >> 16) & 0xFF;
+          buffer[j * 4 + 3] = (value >> 24) & 0xFF;
+        }
+      if (fwrite (buffer, chunk * 4, 1, file) != 1)
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+static bool
+read_uint32s (Uint32 *values, Uint32 count, FILE *file)
+{
+  Byte buffer[1024];
+  for (Uint32 i = 0; i < count; i += sizeof (buffer) / 4)
+    {
+      Uint32 chunk = count - i < sizeof (buffer) / 4 ? count - i
+                                                     : sizeof (buffer) / 4;
+      if (fread (buffer, chunk * 4, 1, file) != 1)
+        {
+          return false;
+        }
+      for (Uint32 j = 0; j < chunk; j++)
+        {
+          values[i + j] = (Uint32)buffer[j * 4]
+                          | (Uint32)buffer[j * 4 + 1] << 8
+                          | (Uint32)buffer[j * 4 + 2] << 16
+                          | (Uint32)buffer[j * 4 + 3] << 24;
+        }
+    }
+  return true;
+}
+
+bool
+heatmap_write_binary (const Heatmap *heatmap, FILE *file)
+{
+  Uint32 version = HEATMAP_VERSION;
+
+  return fwrite (HEATMAP_MAGIC, 4, 1, file) == 1
+         && write_uint32s (&version, 1, file)
+         && write_uint32s (heatmap->reads, MAX_MEMORY, file)
+         && write_uint32s (heatmap->writes, MAX_MEMORY, file)
+         && write_uint32s (heatmap->executes, MAX_MEMORY, file);
+}
+
+bool
+heatmap_read_binary (Heatmap *heatmap, FILE *file)
+{
+  char magic[4];
+  Byte version[4];
+
+  if (fread (magic, 4, 1, file) != 1 || memcmp (magic, HEATMAP_MAGIC, 4) != 0
+      || fread (version, 4, 1, file) != 1 || version[0] != HEATMAP_VERSION)
+    {
+      return false;
+    }
+  return read_uint32s (heatmap->reads, MAX_MEMORY, file)
+         && read_uint32s (heatmap->writes, MAX_MEMORY, file)
+         && read_uint32s (heatmap->executes, MAX_MEMORY, file);
+}
+
+// 0 for an untouched address, then 7..255 spread over the 32 possible bit
+// lengths of the count.
+static Byte
+heatmap_shade (Uint32 count)
+{
+  int bits = 0;
+  while (count != 0)
+    {
+      bits++;
+      count >>= 1;
+    }
+  return bits == 0 ? 0 : (Byte)(bits * 255 / 32);
+}
+
+bool
+heatmap_write_pgm (const Heatmap *heatmap, HeatmapKind kind, FILE *file)
+{
+  Byte row[256];
+
+  fprintf (file, "P5\n256 256\n255\n");
+  for (int page = 0; page < 256; page++)
+    {
+      for (int offset = 0; offset < 256; offset++)
+        {
+          row[offset] = heatmap_shade (
+              heatmap_value (heatmap, kind, (Word)(page << 8 | offset)));
+        }
+      if (fwrite (row, sizeof (row), 1, file) != 1)
+        {
+          return false;
+        }
+    }
+  return true;
+}
@@ -0,0 +1,66 @@
+#ifndef HEATMAP_H_
+#define HEATMAP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* heatmap.h
+ * Per-address read, write and execute counters.  Counting happens in
+ * fetch_byte/read_byte/write_byte and is only built into the core when
+ * ACE64_HEATMAP is defined (cmake -DACE64_HEATMAP=ON); without it the CPU has
+ * no heatmap field and the memory accessors are unchanged.  The dump
+ * functions are always available.
+ */
+#include "cpu.h"
+#include <stdio.h>
+
+typedef enum
+{
+  HEATMAP_READ,
+  HEATMAP_WRITE,
+  HEATMAP_EXECUTE,
+  HEATMAP_ALL // Sum of the three, for the image dump only
+} HeatmapKind;
+
+// Counters saturate at UINT32_MAX rather than wrapping.  Execute counts every
+// byte fetched through PC, operands included.
+struct Heatmap
+{
+  Uint32 reads[MAX_MEMORY];
+  Uint32 writes[MAX_MEMORY];
+  Uint32 executes[MAX_MEMORY];
+};
+
+static inline void
+heatmap_count (Uint32 *counter)
+{
+  *counter += *counter != UINT32_MAX;
+}
+
+#ifdef ACE64_HEATMAP
+// Starts counting into heatmap (which is not cleared); NULL stops counting.
+void heatmap_attach (CPU *cpu, Heatmap *heatmap);
+#endif
+
+void heatmap_clear (Heatmap *heatmap);
+
+// Adds the counters of a page (256 addresses) together, saturating.
+Uint32 heatmap_page_total (const Heatmap *heatmap, HeatmapKind kind,
+                           Byte page);
+
+// Binary dump: the magic "A64H", a little-endian Uint32 version (1), then the
+// read, write and execute arrays as little-endian Uint32s.
+bool heatmap_write_binary (const Heatmap *heatmap, FILE *file);
+bool heatmap_read_binary (Heatmap *heatmap, FILE *file);
+
+// 256x256 8-bit binary PGM: row is the high byte of the address, column the
+// low byte.  Brightness is log2 of the count so cold code stays visible next
+// to hot loops.
+bool heatmap_write_pgm (const Heatmap *heatmap, HeatmapKind kind, FILE *file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
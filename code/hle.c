@@ -0,0 +1,277 @@
+#include "hle.h"
+#include "opcodes.h"
+#include <string.h>
+
+#ifdef ACE64_HLE
+void
+hle_attach (CPU *cpu, Hle *hle)
+{
+  cpu->hle = hle;
+}
+#endif
+
+void
+hle_clear (Hle *hle)
+{
+  memset (hle, 0, sizeof (*hle));
+}
+
+static HleTrap *
+find (Hle *hle, Word address)
+{
+  for (int i = 0; i < hle->trapCount; i++)
+    {
+      if (hle->traps[i].address == address)
+        {
+          return &hle->traps[i];
+        }
+    }
+  return NULL;
+}
+
+const HleTrap *
+hle_find (const Hle *hle, Word address)
+{
+  return find ((Hle *)hle, address);
+}
+
+bool
+hle_trap (Hle *hle, Word address, HleHandler handler, void *user,
+          Sint32 cycles)
+{
+  if (handler == NULL || cycles < 1)
+    {
+      return false;
+    }
+  HleTrap *trap = find (hle, address);
+  if (trap == NULL)
+    {
+      if (hle->trapCount == HLE_MAX_TRAPS)
+        {
+          return false;
+        }
+      trap = &hle->traps[hle->trapCount++];
+    }
+  trap->address = address;
+  trap->handler = handler;
+  trap->user = user;
+  trap->cycles = cycles;
+  trap->calls = 0;
+  hle->armed[address >> 3] |= 1 << (address & 7);
+  return true;
+}
+
+void
+hle_untrap (Hle *hle, Word address)
+{
+  HleTrap *trap = find (hle, address);
+  if (trap != NULL)
+    {
+      *trap = hle->traps[--hle->trapCount];
+      hle->armed[address >> 3] &= ~(1 << (address & 7));
+    }
+}
+
+Sint32
+hle_call (CPU *cpu, Hle *hle)
+{
+  HleTrap *trap = find (hle, cpu->PC);
+  if (trap == NULL || !trap->handler (cpu, trap->user))
+    {
+      return 0;
+    }
+
+  // RTS
+  Sint32 cycles = 0;
+  Byte loByte = stack_pop (cpu, &cycles);
+  Byte hiByte = stack_pop (cpu, &cycles);
+  cpu->PC = get_word_address (loByte, hiByte) + 1;
+
+  trap->calls++;
+  return trap->cycles;
+}
+
+/* KERNAL traps.  Memory changes go through write_byte so that the access
+ * hooks see them. */
+
+static void
+poke (CPU *cpu, Word address, Byte value)
+{
+  Sint32 cycles = 0;
+  write_byte (cpu, address, value, &cycles);
+}
+
+static void
+fail (CPU *cpu, Byte error)
+{
+  cpu->A = error;
+  set_flag (&cpu->P, FLAG_CARRY);
+}
+
+// Copies the file name set by SETNAM into name.
+static Byte
+file_name (const CPU *cpu, Byte *name)
+{
+  Byte length = cpu->Memory[HLE_NAME_LENGTH];
+  Word address = get_word_address (cpu->Memory[HLE_NAME_ADDRESS],
+                                   cpu->Memory[HLE_NAME_ADDRESS + 1]);
+  for (int i = 0; i < length; i++)
+    {
+      name[i] = cpu->Memory[(Word)(address + i)];
+    }
+  return length;
+}
+
+static bool
+kernal_setlfs (CPU *cpu, void *user)
+{
+  poke (cpu, HLE_LOGICAL_FILE, cpu->A);
+  poke (cpu, HLE_DEVICE_NUMBER, cpu->X);
+  poke (cpu, HLE_SECONDARY_ADDRESS, cpu->Y);
+  return true;
+}
+
+static bool
+kernal_setnam (CPU *cpu, void *user)
+{
+  poke (cpu, HLE_NAME_LENGTH, cpu->A);
+  poke (cpu, HLE_NAME_ADDRESS, cpu->X);
+  poke (cpu, HLE_NAME_ADDRESS + 1, cpu->Y);
+  return true;
+}
+
+static bool
+kernal_chrout (CPU *cpu, void *user)
+{
+  const HleDevice *device = &((Hle *)user)->device;
+  if (device->output == NULL)
+    {
+      return false;
+    }
+  device->output (cpu->A, device->user);
+  clear_flag (&cpu->P, FLAG_CARRY);
+  return true;
+}
+
+static bool
+kernal_getin (CPU *cpu, void *user)
+{
+  const HleDevice *device = &((Hle *)user)->device;
+  if (device->input == NULL)
+    {
+      return false;
+    }
+  int key = device->input (device->user);
+  cpu->A = key < 0 ? 0 : (Byte)key;
+  set_status_flag (&cpu->P, cpu->A);
+  clear_flag (&cpu->P, FLAG_CARRY);
+  return true;
+}
+
+// Keys reach GETIN straight from the device, so there is nothing to scan.
+static bool
+kernal_scnkey (CPU *cpu, void *user)
+{
+  return ((Hle *)user)->device.input != NULL;
+}
+
+// A = 0 loads, otherwise verifies.  Secondary address 0 loads at X/Y, any
+// other at the file's own address.  Returns the end address in X/Y.
+static bool
+kernal_load (CPU *cpu, void *user)
+{
+  Hle *hle = (Hle *)user;
+  const HleDevice *device = &hle->device;
+  if (device->load == NULL)
+    {
+      return false;
+    }
+
+  Byte name[256];
+  Byte nameLength = file_name (cpu, name);
+  Byte *file = hle->file;
+  long size = device->load (name, nameLength, file, sizeof (hle->file),
+                            device->user);
+  poke (cpu, HLE_STATUS, 0);
+  if (size < 2)
+    {
+      fail (cpu, HLE_FILE_NOT_FOUND);
+      return true;
+    }
+
+  Word address = cpu->Memory[HLE_SECONDARY_ADDRESS] == 0
+                     ? get_word_address (cpu->X, cpu->Y)
+                     : get_word_address (file[0], file[1]);
+  Uint32 length = (Uint32)size - 2;
+  if (address + length > MAX_MEMORY)
+    {
+      length = MAX_MEMORY - address;
+    }
+  bool verify = cpu->A != 0;
+  for (Uint32 i = 0; i < length; i++)
+    {
+      if (!verify)
+        {
+          poke (cpu, address + i, file[2 + i]);
+        }
+      else if (cpu->Memory[address + i] != file[2 + i])
+        {
+          poke (cpu, HLE_STATUS, cpu->Memory[HLE_STATUS] | 0x10);
+        }
+    }
+
+  Word end = address + length;
+  poke (cpu, HLE_END_ADDRESS, end & 0xFF);
+  poke (cpu, HLE_END_ADDRESS + 1, end >> 8);
+  cpu->X = end & 0xFF;
+  cpu->Y = end >> 8;
+  clear_flag (&cpu->P, FLAG_CARRY);
+  return true;
+}
+
+// A is the zero-page address of a pointer to the start, X/Y the end (not
+// included).  The file is written with the start as its load address.
+static bool
+kernal_save (CPU *cpu, void *user)
+{
+  Hle *hle = (Hle *)user;
+  const HleDevice *device = &hle->device;
+  if (device->save == NULL)
+    {
+      return false;
+    }
+
+  Byte name[256];
+  Byte nameLength = file_name (cpu, name);
+  Word start = get_word_address (cpu->Memory[cpu->A],
+                                 cpu->Memory[(Byte)(cpu->A + 1)]);
+  Word end = get_word_address (cpu->X, cpu->Y);
+  Uint32 length = end > start ? end - start : 0;
+
+  Byte *file = hle->file;
+  file[0] = start & 0xFF;
+  file[1] = start >> 8;
+  memcpy (&file[2], &cpu->Memory[start], length);
+
+  poke (cpu, HLE_STATUS, 0);
+  if (!device->save (name, nameLength, file, length + 2, device->user))
+    {
+      fail (cpu, HLE_DEVICE_NOT_PRESENT);
+      return true;
+    }
+  clear_flag (&cpu->P, FLAG_CARRY);
+  return true;
+}
+
+bool
+hle_install_kernal (Hle *hle, const HleDevice *device)
+{
+  hle->device = *device;
+  return hle_trap (hle, HLE_SETLFS, kernal_setlfs, hle, HLE_CYCLES_SETLFS)
+         && hle_trap (hle, HLE_SETNAM, kernal_setnam, hle, HLE_CYCLES_SETNAM)
+         && hle_trap (hle, HLE_CHROUT, kernal_chrout, hle, HLE_CYCLES_CHROUT)
+         && hle_trap (hle, HLE_GETIN, kernal_getin, hle, HLE_CYCLES_GETIN)
+         && hle_trap (hle, HLE_SCNKEY, kernal_scnkey, hle, HLE_CYCLES_SCNKEY)
+         && hle_trap (hle, HLE_LOAD, kernal_load, hle, HLE_CYCLES_LOAD)
+         && hle_trap (hle, HLE_SAVE, kernal_save, hle, HLE_CYCLES_SAVE);
+}
@@ -0,0 +1,141 @@
+#ifndef HLE_H_
+#define HLE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* hle.h
+ * High-level emulation traps.  A trap table maps entry points (typically
+ * KERNAL jump table addresses) to host handlers: when execute() reaches an
+ * armed PC, the handler does the routine's work on the registers and
+ * memory, the trap returns as the routine's RTS would, and execute()
+ * charges the trap's cycle cost as one step.  A handler may decline, in
+ * which case the code at the entry point runs as usual.
+ *
+ * hle_install_kernal() arms native CHROUT, GETIN, SCNKEY, SETLFS, SETNAM,
+ * LOAD and SAVE over an HleDevice of host callbacks, keeping the KERNAL's
+ * zero-page variables (file name, logical file, status, end address)
+ * current, so programs can use them with or without a ROM image loaded.
+ * Setting exact stops every trap, leaving the ROM code to run.
+ *
+ * Only built into the core when ACE64_HLE is defined (cmake -DACE64_HLE=ON);
+ * traps are per CPU instance.  Trapped routines are not seen by the trace;
+ * the access hooks only see the return address pulled off the stack and
+ * the KERNAL traps' memory writes.  A JSR cache recording that reaches a
+ * trap is abandoned, since the host side effects cannot be replayed.
+ */
+#include "cpu.h"
+#include <stddef.h>
+
+#define HLE_MAX_TRAPS 32
+
+// KERNAL jump table entries
+#define HLE_SETLFS 0xFFBA
+#define HLE_SETNAM 0xFFBD
+#define HLE_LOAD 0xFFD5
+#define HLE_SAVE 0xFFD8
+#define HLE_CHROUT 0xFFD2
+#define HLE_GETIN 0xFFE4
+#define HLE_SCNKEY 0xFF9F
+
+// KERNAL zero-page variables
+#define HLE_STATUS 0x90
+#define HLE_END_ADDRESS 0xAE // And $AF
+#define HLE_NAME_LENGTH 0xB7
+#define HLE_LOGICAL_FILE 0xB8
+#define HLE_SECONDARY_ADDRESS 0xB9
+#define HLE_DEVICE_NUMBER 0xBA
+#define HLE_NAME_ADDRESS 0xBB // And $BC
+
+// KERNAL error codes, returned in A with carry set
+#define HLE_FILE_NOT_FOUND 4
+#define HLE_DEVICE_NOT_PRESENT 5
+
+// Cycles charged by the KERNAL traps, JSR excluded and RTS included: rough
+// costs of the ROM routines on their common paths.
+#define HLE_CYCLES_SETLFS 22
+#define HLE_CYCLES_SETNAM 22
+#define HLE_CYCLES_CHROUT 150
+#define HLE_CYCLES_GETIN 90
+#define HLE_CYCLES_SCNKEY 400
+#define HLE_CYCLES_LOAD 20000
+#define HLE_CYCLES_SAVE 20000
+
+// Does the routine's work and returns true, or returns false to leave it to
+// the code at the entry point.
+typedef bool (*HleHandler) (CPU *cpu, void *user);
+
+typedef struct
+{
+  Word address;
+  HleHandler handler;
+  void *user;
+  Sint32 cycles;
+  Uint64 calls; // Calls handled
+} HleTrap;
+
+// Host side of the KERNAL traps.  A NULL callback leaves its routine (and,
+// for load and save, the whole call) to the ROM.
+typedef struct
+{
+  void (*output) (Byte character, void *user); // CHROUT
+  int (*input) (void *user); // GETIN: the next key, or -1 if none
+
+  // Reads file name into buffer (at most capacity bytes), returning its
+  // size or -1 if there is no such file.  A PRG file starts with its load
+  // address.
+  long (*load) (const Byte *name, Byte nameLength, Byte *buffer,
+                size_t capacity, void *user);
+  bool (*save) (const Byte *name, Byte nameLength, const Byte *data,
+                size_t size, void *user);
+  void *user;
+} HleDevice;
+
+struct Hle
+{
+  bool exact; // Run every routine from ROM
+  Byte armed[MAX_MEMORY / 8];
+  HleTrap traps[HLE_MAX_TRAPS];
+  int trapCount;
+  HleDevice device; // For the KERNAL traps
+  Byte file[MAX_MEMORY + 2]; // LOAD and SAVE buffer
+};
+
+Sint32 hle_call (CPU *cpu, Hle *hle);
+
+// execute() calls this before each instruction while a trap table is
+// attached.  Returns the cycles of a handled trap, or 0 to execute the
+// instruction normally.
+static inline Sint32
+hle_run (CPU *cpu, Hle *hle)
+{
+  if (!(hle->armed[cpu->PC >> 3] & (1 << (cpu->PC & 7))) || hle->exact)
+    {
+      return 0;
+    }
+  return hle_call (cpu, hle);
+}
+
+#ifdef ACE64_HLE
+// Starts trapping with hle; NULL stops.
+void hle_attach (CPU *cpu, Hle *hle);
+#endif
+
+void hle_clear (Hle *hle);
+
+// Arms a trap at address, replacing any trap already there.  cycles must be
+// positive.  Returns false if the table is full.
+bool hle_trap (Hle *hle, Word address, HleHandler handler, void *user,
+               Sint32 cycles);
+void hle_untrap (Hle *hle, Word address);
+const HleTrap *hle_find (const Hle *hle, Word address);
+
+// Arms the KERNAL traps over device, which is copied.
+bool hle_install_kernal (Hle *hle, const HleDevice *device);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
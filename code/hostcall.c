@@ -0,0 +1,294 @@
+#include "hostcall.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+HostCalls *
+hostcall_create (Byte opcode, bool immediate)
+{
+  if (is_opcode_implemented (opcode))
+    {
+      return NULL;
+    }
+  HostCalls *calls = calloc (1, sizeof (HostCalls));
+  if (calls == NULL)
+    {
+      return NULL;
+    }
+  calls->opcode = opcode;
+  calls->immediate = immediate;
+  calls->channels[0] = stdout;
+  calls->channels[1] = stderr;
+  return calls;
+}
+
+void
+hostcall_destroy (HostCalls *calls)
+{
+  if (calls == NULL)
+    {
+      return;
+    }
+  for (int i = 2; i < HOSTCALL_MAX_CHANNELS; i++)
+    {
+      if (calls->channels[i] != NULL)
+        {
+          fclose (calls->channels[i]);
+        }
+    }
+  free (calls->directory);
+  free (calls);
+}
+
+#ifdef ACE64_HOSTCALL
+void
+hostcall_attach (CPU *cpu, HostCalls *calls)
+{
+  cpu->hostcalls = calls;
+}
+#endif
+
+void
+hostcall_clear_exit (HostCalls *calls)
+{
+  calls->exited = false;
+  calls->status = 0;
+}
+
+void
+hostcall_register (HostCalls *calls, Byte number, HostService service,
+                   void *user)
+{
+  calls->services[number].service = service;
+  calls->services[number].user = user;
+}
+
+void
+hostcall_run (CPU *cpu, HostCalls *calls, Sint32 *cycles)
+{
+  Word start = cpu->PC - 1;
+  Byte number = calls->immediate ? fetch_byte (cpu, cycles) : cpu->A;
+  burn_cycle (cpu, cycles);
+  if (calls->exited)
+    {
+      // Halted: the call only spends its cycles until the exit is cleared.
+      cpu->PC = start;
+      return;
+    }
+
+  const HostServiceEntry *entry = &calls->services[number];
+  Word block = get_word_address (cpu->X, cpu->Y);
+  Byte error = entry->service != NULL
+                   ? entry->service (cpu, block, entry->user)
+                   : HOSTCALL_NO_SERVICE;
+  calls->calls++;
+  cpu->A = error;
+  set_status_flag (&cpu->P, error);
+  if (error != HOSTCALL_OK)
+    {
+      set_flag (&cpu->P, FLAG_CARRY);
+    }
+  else
+    {
+      clear_flag (&cpu->P, FLAG_CARRY);
+    }
+  if (calls->exited)
+    {
+      cpu->PC = start;
+    }
+}
+
+/* Standard services.  Memory changes go through write_byte so that the
+ * access hooks see them. */
+
+static Byte
+peek (const CPU *cpu, Word block, int offset)
+{
+  return cpu->Memory[(Word)(block + offset)];
+}
+
+static Word
+peek_word (const CPU *cpu, Word block, int offset)
+{
+  return get_word_address (peek (cpu, block, offset),
+                           peek (cpu, block, offset + 1));
+}
+
+static void
+poke (CPU *cpu, Word address, Byte value)
+{
+  Sint32 cycles = 0;
+  write_byte (cpu, address, value, &cycles);
+}
+
+static FILE *
+channel (HostCalls *calls, Byte number)
+{
+  return number < HOSTCALL_MAX_CHANNELS ? calls->channels[number] : NULL;
+}
+
+// Opens the file named at +0 (length at +2) in the calls' directory.
+static FILE *
+open_file (const CPU *cpu, HostCalls *calls, Word block, const char *mode,
+           Byte *error)
+{
+  Word address = peek_word (cpu, block, 0);
+  Byte length = peek (cpu, block, 2);
+  char name[256];
+  for (int i = 0; i < length; i++)
+    {
+      name[i] = cpu->Memory[(Word)(address + i)];
+    }
+  name[length] = '\0';
+  if (calls->directory == NULL || length == 0 || name[0] == '.'
+      || strlen (name) != length || strpbrk (name, "/\\:") != NULL)
+    {
+      *error = HOSTCALL_BAD_NAME;
+      return NULL;
+    }
+
+  size_t size = strlen (calls->directory) + length + 2;
+  char *path = malloc (size);
+  if (path == NULL)
+    {
+      *error = HOSTCALL_FILE_ERROR;
+      return NULL;
+    }
+  snprintf (path, size, "%s/%s", calls->directory, name);
+  FILE *file = fopen (path, mode);
+  free (path);
+  *error = file != NULL ? HOSTCALL_OK : HOSTCALL_FILE_ERROR;
+  return file;
+}
+
+static Byte
+service_write (CPU *cpu, Word block, void *user)
+{
+  FILE *file = channel ((HostCalls *)user, peek (cpu, block, 0));
+  if (file == NULL)
+    {
+      return HOSTCALL_BAD_CHANNEL;
+    }
+  Word address = peek_word (cpu, block, 1);
+  Uint32 length = peek_word (cpu, block, 3);
+  // A range running past $FFFF wraps, as the 6502 would
+  Uint32 first = length < MAX_MEMORY - address ? length
+                                                : MAX_MEMORY - address;
+  if (fwrite (&cpu->Memory[address], 1, first, file) != first
+      || fwrite (cpu->Memory, 1, length - first, file) != length - first)
+    {
+      return HOSTCALL_FILE_ERROR;
+    }
+  fflush (file);
+  return HOSTCALL_OK;
+}
+
+static Byte
+service_open (CPU *cpu, Word block, void *user)
+{
+  HostCalls *calls = (HostCalls *)user;
+  int number = 2;
+  while (number < HOSTCALL_MAX_CHANNELS && calls->channels[number] != NULL)
+    {
+      number++;
+    }
+  if (number == HOSTCALL_MAX_CHANNELS)
+    {
+      return HOSTCALL_BAD_CHANNEL;
+    }
+
+  Byte error;
+  FILE *file = open_file (cpu, calls, block,
+                          peek (cpu, block, 3) != 0 ? "ab" : "wb", &error);
+  if (file == NULL)
+    {
+      return error;
+    }
+  calls->channels[number] = file;
+  poke (cpu, block + 4, number);
+  return HOSTCALL_OK;
+}
+
+static Byte
+service_close (CPU *cpu, Word block, void *user)
+{
+  HostCalls *calls = (HostCalls *)user;
+  Byte number = peek (cpu, block, 0);
+  if (number < 2 || channel (calls, number) == NULL)
+    {
+      return HOSTCALL_BAD_CHANNEL;
+    }
+  bool closed = fclose (calls->channels[number]) == 0;
+  calls->channels[number] = NULL;
+  return closed ? HOSTCALL_OK : HOSTCALL_FILE_ERROR;
+}
+
+static Byte
+service_read_file (CPU *cpu, Word block, void *user)
+{
+  Byte error;
+  FILE *file = open_file (cpu, (HostCalls *)user, block, "rb", &error);
+  if (file == NULL)
+    {
+      return error;
+    }
+  Word address = peek_word (cpu, block, 3);
+  Uint32 capacity = peek_word (cpu, block, 5);
+  if (capacity > MAX_MEMORY - address)
+    {
+      capacity = MAX_MEMORY - address;
+    }
+
+  Uint32 length = 0;
+  int c;
+  while (length < capacity && (c = fgetc (file)) != EOF)
+    {
+      poke (cpu, address + length++, (Byte)c);
+    }
+  bool failed = ferror (file);
+  fclose (file);
+  poke (cpu, block + 7, length & 0xFF);
+  poke (cpu, block + 8, length >> 8);
+  return failed ? HOSTCALL_FILE_ERROR : HOSTCALL_OK;
+}
+
+static Byte
+service_time (CPU *cpu, Word block, void *user)
+{
+  struct timespec now;
+  clock_gettime (CLOCK_REALTIME, &now);
+  Uint64 micros = (Uint64)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+  for (int i = 0; i < 8; i++)
+    {
+      poke (cpu, block + i, micros >> (8 * i));
+    }
+  return HOSTCALL_OK;
+}
+
+static Byte
+service_exit (CPU *cpu, Word block, void *user)
+{
+  HostCalls *calls = (HostCalls *)user;
+  calls->status = peek (cpu, block, 0);
+  calls->exited = true;
+  return HOSTCALL_OK;
+}
+
+bool
+hostcall_install_standard (HostCalls *calls, const char *directory)
+{
+  char *copy = NULL;
+  if (directory != NULL && (copy = strdup (directory)) == NULL)
+    {
+      return false;
+    }
+  free (calls->directory);
+  calls->directory = copy;
+  hostcall_register (calls, HOSTCALL_WRITE, service_write, calls);
+  hostcall_register (calls, HOSTCALL_OPEN, service_open, calls);
+  hostcall_register (calls, HOSTCALL_CLOSE, service_close, calls);
+  hostcall_register (calls, HOSTCALL_READ_FILE, service_read_file, calls);
+  hostcall_register (calls, HOSTCALL_TIME, service_time, calls);
+  hostcall_register (calls, HOSTCALL_EXIT, service_exit, calls);
+  return true;
+}
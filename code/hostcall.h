@@ -0,0 +1,103 @@
+#ifndef HOSTCALL_H_
+#define HOSTCALL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* hostcall.h
+ * Paravirtual host calls.  One opcode the core leaves unimplemented (a NULL
+ * slot in opcode_table) becomes a call into native services, so test
+ * programs can do I/O and report results without emulating screen memory
+ * or serial buses.
+ *
+ * The service number is A, or, with immediate set, a byte following the
+ * opcode.  X/Y point to the service's parameter block.  On return A is 0
+ * with carry clear, or an error code with carry set; other results go back
+ * into the block.  A call costs 2 cycles, 3 with the immediate byte.
+ *
+ * hostcall_install_standard() registers the services below.  Channels 0
+ * and 1 are standard output and error; OPEN adds more.  Files are opened in
+ * one host directory: names holding a path separator or starting with a
+ * dot are refused.  EXIT records the status and leaves PC on the host call,
+ * so the program halts in place as on a JAM: until hostcall_clear_exit(),
+ * the call spends its cycles and does nothing else.
+ *
+ * Only built into the core when ACE64_HOSTCALL is defined
+ * (cmake -DACE64_HOSTCALL=ON); tables are per CPU instance.  A JSR cache
+ * recording that reaches a host call is abandoned.
+ */
+#include "cpu.h"
+#include <stdio.h>
+
+#define HOSTCALL_DEFAULT_OPCODE 0xFF
+#define HOSTCALL_MAX_CHANNELS 8
+
+// Standard services and their parameter blocks
+#define HOSTCALL_WRITE 0x00     // +0 channel, +1 address, +3 length
+#define HOSTCALL_OPEN 0x01      // +0 name, +2 name length, +3 append;
+                                // returns +4 channel
+#define HOSTCALL_CLOSE 0x02     // +0 channel
+#define HOSTCALL_READ_FILE 0x03 // +0 name, +2 name length, +3 address,
+                                // +5 capacity; returns +7 length read
+#define HOSTCALL_TIME 0x04      // Returns +0 microseconds since 1970, 8 bytes
+#define HOSTCALL_EXIT 0x05      // +0 status
+
+// Error codes
+#define HOSTCALL_OK 0
+#define HOSTCALL_NO_SERVICE 1
+#define HOSTCALL_BAD_CHANNEL 2
+#define HOSTCALL_BAD_NAME 3
+#define HOSTCALL_FILE_ERROR 4
+
+// Does the service's work and returns HOSTCALL_OK or an error code.
+typedef Byte (*HostService) (CPU *cpu, Word block, void *user);
+
+typedef struct
+{
+  HostService service;
+  void *user;
+} HostServiceEntry;
+
+struct HostCalls
+{
+  Byte opcode;
+  bool immediate; // The service number follows the opcode
+  HostServiceEntry services[256];
+  FILE *channels[HOSTCALL_MAX_CHANNELS]; // 0 and 1 are not closed
+  char *directory; // Files are opened here; NULL refuses file access
+  bool exited;
+  Byte status; // Set by EXIT
+  Uint64 calls;
+};
+
+// Returns NULL if opcode is implemented by the core, or on allocation
+// failure.
+HostCalls *hostcall_create (Byte opcode, bool immediate);
+void hostcall_destroy (HostCalls *calls);
+
+#ifdef ACE64_HOSTCALL
+// Starts serving host calls with calls; NULL stops.
+void hostcall_attach (CPU *cpu, HostCalls *calls);
+#endif
+
+// Lets host calls run again after an EXIT.
+void hostcall_clear_exit (HostCalls *calls);
+
+// Replaces the service registered as number.
+void hostcall_register (HostCalls *calls, Byte number, HostService service,
+                        void *user);
+
+// Registers WRITE, OPEN, CLOSE, READ_FILE, TIME and EXIT, with files in
+// directory (copied, replacing any earlier one; NULL refuses file access).
+// Returns false on allocation failure.
+bool hostcall_install_standard (HostCalls *calls, const char *directory);
+
+// execute() calls this after fetching calls->opcode.
+void hostcall_run (CPU *cpu, HostCalls *calls, Sint32 *cycles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,706 @@
+#include "jobserver.h"
+#include "run.h"
+#include "support.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#define READ_BUFFER_SIZE 65536 // Pipelined requests arrive in bulk
+
+typedef struct Connection Connection;
+
+struct Connection
+{
+  JobServer *server;
+  int fd;
+  pthread_mutex_t writeLock; // Keeps responses whole
+
+  pthread_mutex_t lock; // Guards inFlight
+  pthread_cond_t finished;
+  int inFlight;
+
+  Connection *next;
+
+  Byte buffer[READ_BUFFER_SIZE];
+  size_t start;
+  size_t end;
+};
+
+typedef struct Job
+{
+  struct Job *next;
+  Connection *connection;
+  Byte *request; // The request after its size field
+  Uint32 size;
+} Job;
+
+typedef struct
+{
+  JobServer *server;
+  pthread_t thread;
+  CPU *cpu;
+  RunStops *stops;
+  Byte *response;
+  size_t responseCapacity;
+} Worker;
+
+struct JobServer
+{
+  int threads;
+  int clientLimit;
+  CPU *bases[JOBSERVER_MAX_BASES];
+  int baseCount;
+
+  pthread_mutex_t lock;        // Guards the queue, connections and listener
+  pthread_cond_t queued;       // A job was queued, or the queue closed
+  pthread_cond_t disconnected; // A connection went away
+  Job *head;
+  Job *tail;
+  bool closing; // No more jobs will be queued
+  Connection *connections;
+  int connectionCount;
+  int listener;
+
+  atomic_bool stopping;
+  atomic_uint_fast64_t jobs;
+};
+
+typedef struct
+{
+  const Byte *next;
+  const Byte *end;
+  bool ok; // Nothing was taken past the end
+} Cursor;
+
+static const Byte *
+take (Cursor *in, size_t length)
+{
+  if (!in->ok || (size_t)(in->end - in->next) < length)
+    {
+      in->ok = false;
+      return NULL;
+    }
+  const Byte *bytes = in->next;
+  in->next += length;
+  return bytes;
+}
+
+static Uint64
+take_number (Cursor *in, int length)
+{
+  const Byte *bytes = take (in, length);
+  Uint64 value = 0;
+  for (int i = length - 1; bytes != NULL && i >= 0; i--)
+    {
+      value = value << 8 | bytes[i];
+    }
+  return value;
+}
+
+static Byte *
+put_number (Byte *out, Uint64 value, int length)
+{
+  for (int i = 0; i < length; i++)
+    {
+      *out++ = (Byte)(value >> (8 * i));
+    }
+  return out;
+}
+
+JobServer *
+jobserver_create (const JobServerOptions *options)
+{
+  JobServer *server = (JobServer *)calloc (1, sizeof (JobServer));
+  if (server == NULL)
+    {
+      return NULL;
+    }
+
+  server->threads = support_thread_count (options->threads);
+  server->clientLimit = options->clientLimit > 0
+                            ? options->clientLimit
+                            : JOBSERVER_DEFAULT_CLIENT_LIMIT;
+  server->listener = -1;
+  pthread_mutex_init (&server->lock, NULL);
+  pthread_cond_init (&server->queued, NULL);
+  pthread_cond_init (&server->disconnected, NULL);
+  return server;
+}
+
+void
+jobserver_destroy (JobServer *server)
+{
+  if (server == NULL)
+    {
+      return;
+    }
+  for (int b = 0; b < server->baseCount; b++)
+    {
+      free (server->bases[b]);
+    }
+  pthread_cond_destroy (&server->queued);
+  pthread_cond_destroy (&server->disconnected);
+  pthread_mutex_destroy (&server->lock);
+  free (server);
+}
+
+int
+jobserver_add_base (JobServer *server, const CPU *cpu)
+{
+  if (server->baseCount == JOBSERVER_MAX_BASES)
+    {
+      return -1;
+    }
+  CPU *base = (CPU *)malloc (sizeof (CPU));
+  if (base == NULL)
+    {
+      return -1;
+    }
+
+  // Keep the machine state but none of the attachments.
+  reset (base);
+  memcpy (base->Memory, cpu->Memory, sizeof (base->Memory));
+  base->PC = cpu->PC;
+  base->SP = cpu->SP;
+  base->A = cpu->A;
+  base->X = cpu->X;
+  base->Y = cpu->Y;
+  base->P = cpu->P;
+
+  server->bases[server->baseCount] = base;
+  return server->baseCount++;
+}
+
+int
+jobserver_listen (const char *path)
+{
+  struct sockaddr_un local;
+  struct stat existing;
+  memset (&local, 0, sizeof (local));
+  local.sun_family = AF_UNIX;
+  if (strlen (path) >= sizeof (local.sun_path))
+    {
+      errno = ENAMETOOLONG;
+      return -1;
+    }
+  strcpy (local.sun_path, path);
+
+  // Replace a stale socket, but never any other kind of file.
+  if (stat (path, &existing) == 0 && S_ISSOCK (existing.st_mode))
+    {
+      unlink (path);
+    }
+  int fd = socket (AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0)
+    {
+      return -1;
+    }
+  if (bind (fd, (struct sockaddr *)&local, sizeof (local)) < 0
+      || listen (fd, SOMAXCONN) < 0)
+    {
+      int saved = errno;
+      close (fd);
+      errno = saved;
+      return -1;
+    }
+  return fd;
+}
+
+static void
+queue_push (JobServer *server, Job *job)
+{
+  job->next = NULL;
+  pthread_mutex_lock (&server->lock);
+  if (server->tail != NULL)
+    server->tail->next = job;
+  else
+    server->head = job;
+  server->tail = job;
+  pthread_cond_signal (&server->queued);
+  pthread_mutex_unlock (&server->lock);
+}
+
+// Returns the next job, or NULL once the queue is closed and empty.
+static Job *
+queue_pop (JobServer *server)
+{
+  pthread_mutex_lock (&server->lock);
+  while (server->head == NULL && !server->closing)
+    {
+      pthread_cond_wait (&server->queued, &server->lock);
+    }
+  Job *job = server->head;
+  if (job != NULL)
+    {
+      server->head = job->next;
+      if (server->head == NULL)
+        {
+          server->tail = NULL;
+        }
+    }
+  pthread_mutex_unlock (&server->lock);
+  return job;
+}
+
+// Reads exactly length bytes through the connection's buffer.
+static bool
+connection_read (Connection *connection, Byte *to, size_t length)
+{
+  while (length > 0)
+    {
+      if (connection->start == connection->end)
+        {
+          ssize_t got = read (connection->fd, connection->buffer,
+                              sizeof (connection->buffer));
+          if (got < 0 && errno == EINTR)
+            {
+              continue;
+            }
+          if (got <= 0)
+            {
+              return false;
+            }
+          connection->start = 0;
+          connection->end = (size_t)got;
+        }
+
+      size_t count = connection->end - connection->start;
+      if (count > length)
+        {
+          count = length;
+        }
+      memcpy (to, connection->buffer + connection->start, count);
+      connection->start += count;
+      to += count;
+      length -= count;
+    }
+  return true;
+}
+
+static bool
+send_all (int fd, const Byte *bytes, size_t length)
+{
+  while (length > 0)
+    {
+      ssize_t sent = send (fd, bytes, length, MSG_NOSIGNAL);
+      if (sent < 0 && errno == EINTR)
+        {
+          continue;
+        }
+      if (sent <= 0)
+        {
+          return false;
+        }
+      bytes += sent;
+      length -= (size_t)sent;
+    }
+  return true;
+}
+
+static void *
+connection_reader (void *argument)
+{
+  Connection *connection = (Connection *)argument;
+  JobServer *server = connection->server;
+
+  for (;;)
+    {
+      Byte header[4];
+      if (!connection_read (connection, header, sizeof (header)))
+        {
+          break;
+        }
+      Cursor in = { header, header + sizeof (header), true };
+      Uint32 size = (Uint32)take_number (&in, 4);
+      if (size < 4 || size > JOBSERVER_MAX_REQUEST)
+        {
+          break;
+        }
+
+      Job *job = (Job *)malloc (sizeof (Job));
+      Byte *request = (Byte *)malloc (size);
+      if (job == NULL || request == NULL
+          || !connection_read (connection, request, size))
+        {
+          free (job);
+          free (request);
+          break;
+        }
+      job->connection = connection;
+      job->request = request;
+      job->size = size;
+
+      pthread_mutex_lock (&connection->lock);
+      while (connection->inFlight >= server->clientLimit)
+        {
+          pthread_cond_wait (&connection->finished, &connection->lock);
+        }
+      connection->inFlight++;
+      pthread_mutex_unlock (&connection->lock);
+      queue_push (server, job);
+    }
+
+  // Let the queued jobs answer before the connection goes.
+  pthread_mutex_lock (&connection->lock);
+  while (connection->inFlight > 0)
+    {
+      pthread_cond_wait (&connection->finished, &connection->lock);
+    }
+  pthread_mutex_unlock (&connection->lock);
+
+  pthread_mutex_lock (&server->lock);
+  Connection **link = &server->connections;
+  while (*link != connection)
+    {
+      link = &(*link)->next;
+    }
+  *link = connection->next;
+  server->connectionCount--;
+  pthread_cond_broadcast (&server->disconnected);
+  pthread_mutex_unlock (&server->lock);
+
+  close (connection->fd);
+  pthread_cond_destroy (&connection->finished);
+  pthread_mutex_destroy (&connection->lock);
+  pthread_mutex_destroy (&connection->writeLock);
+  free (connection);
+  return NULL;
+}
+
+// Parses the request into the worker's CPU and stops.  Returns its status;
+// on success *dumps points at the dump list, already validated.
+static JobServerStatus
+prepare_job (Worker *worker, Cursor *in, const Byte **dumps, int *dumpCount)
+{
+  JobServer *server = worker->server;
+  CPU *cpu = worker->cpu;
+  RunStops *stops = worker->stops;
+  JobServerStatus status = JOBSERVER_OK;
+
+  Byte base = (Byte)take_number (in, 1);
+  Byte flags = (Byte)take_number (in, 1);
+  const Byte *registers = take (in, 7);
+  Uint64 maxCycles = take_number (in, 8);
+  Uint64 maxInstructions = take_number (in, 8);
+  const Byte *counts = take (in, 4);
+  if (!in->ok)
+    {
+      return JOBSERVER_MALFORMED;
+    }
+  if (base >= server->baseCount)
+    {
+      return JOBSERVER_NO_BASE;
+    }
+
+  memcpy (cpu, server->bases[base], sizeof (CPU));
+  if (flags & JOBSERVER_SET_REGISTERS)
+    {
+      cpu->PC = get_word_address (registers[0], registers[1]);
+      cpu->A = registers[2];
+      cpu->X = registers[3];
+      cpu->Y = registers[4];
+      cpu->P = registers[5];
+      cpu->SP = registers[6];
+    }
+
+  run_stops_init (stops);
+  stops->brk = (flags & JOBSERVER_STOP_BRK) != 0;
+  stops->selfLoop = (flags & JOBSERVER_STOP_SELF_LOOP) != 0;
+  stops->illegal = (flags & JOBSERVER_STOP_ILLEGAL) != 0;
+  stops->maxCycles = maxCycles;
+  stops->maxInstructions = maxInstructions;
+  for (int i = 0; i < counts[0]; i++)
+    {
+      Word address = (Word)take_number (in, 2);
+      if (in->ok && !run_stop_at (stops, address))
+        {
+          status = JOBSERVER_BAD_STOP;
+        }
+    }
+  for (int i = 0; i < counts[1]; i++)
+    {
+      Word address = (Word)take_number (in, 2);
+      if (in->ok && !run_stop_on_write (stops, address))
+        {
+          status = JOBSERVER_BAD_STOP;
+        }
+    }
+
+  for (int i = 0; i < counts[2]; i++)
+    {
+      Word address = (Word)take_number (in, 2);
+      Word length = (Word)take_number (in, 2);
+      const Byte *bytes = take (in, length);
+      if (bytes == NULL || address + length > MAX_MEMORY)
+        {
+          return JOBSERVER_MALFORMED;
+        }
+      memcpy (&cpu->Memory[address], bytes, length);
+    }
+
+  *dumps = in->next;
+  *dumpCount = counts[3];
+  for (int i = 0; i < counts[3]; i++)
+    {
+      Word address = (Word)take_number (in, 2);
+      Word length = (Word)take_number (in, 2);
+      if (address + length > MAX_MEMORY)
+        {
+          in->ok = false;
+        }
+    }
+  if (!in->ok || in->next != in->end)
+    {
+      return JOBSERVER_MALFORMED;
+    }
+  return status;
+}
+
+static bool
+worker_reserve (Worker *worker, size_t size)
+{
+  if (size <= worker->responseCapacity)
+    {
+      return true;
+    }
+  Byte *response = (Byte *)realloc (worker->response, size);
+  if (response == NULL)
+    {
+      return false;
+    }
+  worker->response = response;
+  worker->responseCapacity = size;
+  return true;
+}
+
+// Runs the job and sends its response.
+static void
+worker_run (Worker *worker, const Job *job)
+{
+  Cursor in = { job->request, job->request + job->size, true };
+  Uint32 tag = (Uint32)take_number (&in, 4);
+  const Byte *dumps = NULL;
+  int dumpCount = 0;
+  RunExit result = { RUN_EXIT_NONE };
+  JobServerStatus status = prepare_job (worker, &in, &dumps, &dumpCount);
+
+  size_t dumped = 0;
+  if (status == JOBSERVER_OK)
+    {
+      result = run_until (worker->cpu, worker->stops);
+      for (int i = 0; i < dumpCount; i++)
+        {
+          dumped += get_word_address (dumps[4 * i + 2], dumps[4 * i + 3]);
+        }
+    }
+  else
+    {
+      dumpCount = 0;
+    }
+
+  size_t size = 4 + JOBSERVER_RESPONSE_FIXED + dumped;
+  if (!worker_reserve (worker, size))
+    {
+      dumped = 0;
+      dumpCount = 0;
+      size = 4 + JOBSERVER_RESPONSE_FIXED;
+    }
+
+  const CPU *cpu = worker->cpu;
+  bool ran = status == JOBSERVER_OK;
+  Byte *out = worker->response;
+  out = put_number (out, size - 4, 4);
+  out = put_number (out, tag, 4);
+  out = put_number (out, status, 1);
+  out = put_number (out, result.reason, 1);
+  out = put_number (out, ran ? cpu->PC : 0, 2);
+  out = put_number (out, ran ? cpu->A : 0, 1);
+  out = put_number (out, ran ? cpu->X : 0, 1);
+  out = put_number (out, ran ? cpu->Y : 0, 1);
+  out = put_number (out, ran ? cpu->P : 0, 1);
+  out = put_number (out, ran ? cpu->SP : 0, 1);
+  out = put_number (out, result.address, 2);
+  out = put_number (out, result.value, 1);
+  out = put_number (out, result.instructions, 8);
+  out = put_number (out, result.cycles, 8);
+  for (int i = 0; i < dumpCount; i++)
+    {
+      Word address = get_word_address (dumps[4 * i], dumps[4 * i + 1]);
+      Word length = get_word_address (dumps[4 * i + 2], dumps[4 * i + 3]);
+      memcpy (out, &cpu->Memory[address], length);
+      out += length;
+    }
+
+  atomic_fetch_add (&worker->server->jobs, 1);
+  Connection *connection = job->connection;
+  pthread_mutex_lock (&connection->writeLock);
+  send_all (connection->fd, worker->response, size);
+  pthread_mutex_unlock (&connection->writeLock);
+}
+
+static void *
+worker_main (void *argument)
+{
+  Worker *worker = (Worker *)argument;
+  JobServer *server = worker->server;
+  Job *job;
+
+  while ((job = queue_pop (server)) != NULL)
+    {
+      worker_run (worker, job);
+
+      Connection *connection = job->connection;
+      free (job->request);
+      free (job);
+      pthread_mutex_lock (&connection->lock);
+      connection->inFlight--;
+      pthread_cond_signal (&connection->finished);
+      pthread_mutex_unlock (&connection->lock);
+    }
+  return NULL;
+}
+
+static void
+free_workers (Worker *workers, int count)
+{
+  for (int w = 0; w < count; w++)
+    {
+      free (workers[w].cpu);
+      free (workers[w].stops);
+      free (workers[w].response);
+    }
+  free (workers);
+}
+
+static void
+accept_clients (JobServer *server, int listener)
+{
+  while (!atomic_load (&server->stopping))
+    {
+      int fd = accept (listener, NULL, NULL);
+      if (fd < 0)
+        {
+          if (errno == EINTR || errno == ECONNABORTED)
+            {
+              continue;
+            }
+          break;
+        }
+
+      Connection *connection = (Connection *)calloc (1, sizeof (Connection));
+      if (connection == NULL)
+        {
+          close (fd);
+          continue;
+        }
+      connection->server = server;
+      connection->fd = fd;
+      pthread_mutex_init (&connection->writeLock, NULL);
+      pthread_mutex_init (&connection->lock, NULL);
+      pthread_cond_init (&connection->finished, NULL);
+
+      pthread_mutex_lock (&server->lock);
+      connection->next = server->connections;
+      server->connections = connection;
+      server->connectionCount++;
+      pthread_mutex_unlock (&server->lock);
+
+      pthread_attr_t attributes;
+      pthread_t reader;
+      pthread_attr_init (&attributes);
+      pthread_attr_setdetachstate (&attributes, PTHREAD_CREATE_DETACHED);
+      if (pthread_create (&reader, &attributes, connection_reader, connection)
+          != 0)
+        {
+          // The reader finds the socket shut and tidies up at once.
+          shutdown (fd, SHUT_RDWR);
+          connection_reader (connection);
+        }
+      pthread_attr_destroy (&attributes);
+    }
+}
+
+bool
+jobserver_serve (JobServer *server, int listener)
+{
+  Worker *workers = (Worker *)calloc (server->threads, sizeof (Worker));
+  if (workers == NULL)
+    {
+      return false;
+    }
+  for (int w = 0; w < server->threads; w++)
+    {
+      workers[w].server = server;
+      workers[w].cpu = (CPU *)malloc (sizeof (CPU));
+      workers[w].stops = (RunStops *)malloc (sizeof (RunStops));
+      if (workers[w].cpu == NULL || workers[w].stops == NULL)
+        {
+          free_workers (workers, server->threads);
+          return false;
+        }
+    }
+
+  pthread_mutex_lock (&server->lock);
+  server->closing = false;
+  server->listener = listener;
+  pthread_mutex_unlock (&server->lock);
+
+  int started = 0;
+  while (started < server->threads
+         && pthread_create (&workers[started].thread, NULL, worker_main,
+                            &workers[started])
+                == 0)
+    {
+      started++;
+    }
+  if (started > 0)
+    {
+      accept_clients (server, listener);
+    }
+
+  // Stop reading from every client, then wait for their last responses.
+  pthread_mutex_lock (&server->lock);
+  server->listener = -1;
+  for (Connection *c = server->connections; c != NULL; c = c->next)
+    {
+      shutdown (c->fd, SHUT_RD);
+    }
+  while (server->connectionCount > 0)
+    {
+      pthread_cond_wait (&server->disconnected, &server->lock);
+    }
+  server->closing = true;
+  pthread_cond_broadcast (&server->queued);
+  pthread_mutex_unlock (&server->lock);
+
+  for (int w = 0; w < started; w++)
+    {
+      pthread_join (workers[w].thread, NULL);
+    }
+  free_workers (workers, server->threads);
+  return started > 0;
+}
+
+void
+jobserver_stop (JobServer *server)
+{
+  atomic_store (&server->stopping, true);
+  pthread_mutex_lock (&server->lock);
+  if (server->listener >= 0)
+    {
+      shutdown (server->listener, SHUT_RDWR);
+    }
+  pthread_mutex_unlock (&server->lock);
+}
+
+Uint64
+jobserver_jobs (const JobServer *server)
+{
+  return atomic_load (&server->jobs);
+}
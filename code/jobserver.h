@@ -0,0 +1,107 @@
+#ifndef JOBSERVER_H_
+#define JOBSERVER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* jobserver.h
+ * A long-running job server: it keeps base snapshots (machines with their
+ * ROMs loaded and booted) in memory, and runs jobs sent over a Unix socket
+ * against copies of them, so a short job pays for a 64K copy instead of a
+ * process start and a boot.
+ *
+ * Each connection has a reader thread that frames requests and queues
+ * them; a pool of workers runs the jobs and writes each response as soon
+ * as its job finishes.  Clients may pipeline: send many requests without
+ * waiting, and match responses to them by tag, since responses come back
+ * in completion order.  A client with clientLimit jobs in flight is not
+ * read from until one of them finishes.
+ *
+ * Wire format, little-endian.  A request is
+ *
+ *   u32 size                 Bytes that follow
+ *   u32 tag                  Echoed in the response
+ *   u8  base                 Snapshot index
+ *   u8  flags                JOBSERVER_* below
+ *   u16 pc, u8 a, x, y, p, sp
+ *                            Used with JOBSERVER_SET_REGISTERS
+ *   u64 cycle limit          0 for none
+ *   u64 instruction limit    0 for none
+ *   u8  stops, writes, patches, dumps
+ *   u16 stop address         x stops
+ *   u16 sentinel address     x writes (needs ACE64_WATCHPOINTS)
+ *   u16 address, u16 length, length bytes
+ *                            x patches: stored before the run
+ *   u16 address, u16 length  x dumps: returned after the run
+ *
+ * and a response is
+ *
+ *   u32 size, u32 tag
+ *   u8  status               JOBSERVER_OK or an error
+ *   u8  exit reason          RunExitReason (run.h)
+ *   u16 pc, u8 a, x, y, p, sp
+ *   u16 exit address, u8 exit value
+ *   u64 instructions, u64 cycles
+ *   the dumped bytes, in request order
+ *
+ * A response with an error status carries no dumps.  A request larger
+ * than JOBSERVER_MAX_REQUEST closes the connection.
+ */
+#include "cpu.h"
+
+#define JOBSERVER_MAX_BASES 16
+#define JOBSERVER_MAX_REQUEST (1 << 20)
+#define JOBSERVER_DEFAULT_CLIENT_LIMIT 64
+#define JOBSERVER_REQUEST_FIXED 33  // After the size field
+#define JOBSERVER_RESPONSE_FIXED 32 // After the size field
+
+// Request flags
+#define JOBSERVER_STOP_BRK 0x01
+#define JOBSERVER_STOP_SELF_LOOP 0x02
+#define JOBSERVER_STOP_ILLEGAL 0x04
+#define JOBSERVER_SET_REGISTERS 0x08
+
+typedef enum
+{
+  JOBSERVER_OK,
+  JOBSERVER_MALFORMED, // The request does not parse
+  JOBSERVER_NO_BASE,   // No snapshot with that index
+  JOBSERVER_BAD_STOP,  // Too many stops, or sentinels without watchpoints
+} JobServerStatus;
+
+typedef struct JobServer JobServer;
+
+typedef struct
+{
+  int threads;     // Workers; 0: one per online processor
+  int clientLimit; // Jobs in flight per client; 0: the default
+} JobServerOptions;
+
+JobServer *jobserver_create (const JobServerOptions *options);
+void jobserver_destroy (JobServer *server);
+
+// Copies cpu as the next base snapshot, with nothing attached.  Returns
+// its index, or -1 if there is no room.  Bases are added before serving.
+int jobserver_add_base (JobServer *server, const CPU *cpu);
+
+// Listens on a Unix socket at path, replacing a stale socket there.
+// Returns the listening socket, or -1 with errno set.
+int jobserver_listen (const char *path);
+
+// Accepts clients until jobserver_stop(), then closes their connections
+// once their jobs have finished and returns.  Returns false if the workers
+// could not start.
+bool jobserver_serve (JobServer *server, int listener);
+
+// Makes jobserver_serve() return; callable from any thread.
+void jobserver_stop (JobServer *server);
+
+// Jobs run so far.
+Uint64 jobserver_jobs (const JobServer *server);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
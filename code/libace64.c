@@ -0,0 +1,271 @@
+#include "libace64.h"
+#include "cpu.h"
+#include "run.h"
+#include "support.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct ace64_machine
+{
+  CPU cpu;
+  RunStops stops;
+};
+
+_Static_assert (ACE64_MEMORY_SIZE == MAX_MEMORY, "memory size");
+_Static_assert (ACE64_EXIT_HOST == RUN_EXIT_HOST
+                    && ACE64_EXIT_ILLEGAL == RUN_EXIT_ILLEGAL
+                    && ACE64_EXIT_INSTRUCTIONS == RUN_EXIT_INSTRUCTIONS
+                    && ACE64_EXIT_CYCLES == RUN_EXIT_CYCLES
+                    && ACE64_EXIT_SELF_LOOP == RUN_EXIT_SELF_LOOP
+                    && ACE64_EXIT_WRITE == RUN_EXIT_WRITE
+                    && ACE64_EXIT_PC == RUN_EXIT_PC
+                    && ACE64_EXIT_BRK == RUN_EXIT_BRK
+                    && ACE64_EXIT_NONE == RUN_EXIT_NONE,
+                "exit reasons");
+_Static_assert (sizeof (ace64_registers) == 8, "ace64_registers layout");
+_Static_assert (sizeof (ace64_exit) == 32, "ace64_exit layout");
+
+typedef struct
+{
+  ace64_machine *const *machines;
+  size_t count;
+  Uint64 maxCycles;
+  ace64_exit *exits;
+  _Atomic size_t next;
+} Batch;
+
+uint32_t
+ace64_abi_version (void)
+{
+  return ACE64_ABI_VERSION;
+}
+
+ace64_machine *
+ace64_create (void)
+{
+  ace64_machine *machine = (ace64_machine *)malloc (sizeof (ace64_machine));
+  if (machine == NULL)
+    {
+      return NULL;
+    }
+  run_stops_init (&machine->stops);
+  ace64_reset (machine);
+  return machine;
+}
+
+void
+ace64_destroy (ace64_machine *machine)
+{
+  free (machine);
+}
+
+void
+ace64_reset (ace64_machine *machine)
+{
+  reset (&machine->cpu);
+  machine->stops.resumeArmed = false;
+}
+
+uint8_t *
+ace64_memory (ace64_machine *machine, size_t *length)
+{
+  if (length != NULL)
+    {
+      *length = sizeof (machine->cpu.Memory);
+    }
+  return machine->cpu.Memory;
+}
+
+static bool
+ranges_valid (const ace64_range *ranges, size_t count)
+{
+  if (ranges == NULL && count > 0)
+    {
+      return false;
+    }
+  for (size_t i = 0; i < count; i++)
+    {
+      if ((Uint32)ranges[i].address + ranges[i].length > MAX_MEMORY
+          || (ranges[i].bytes == NULL && ranges[i].length > 0))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+int
+ace64_load (ace64_machine *machine, const ace64_range *ranges, size_t count)
+{
+  if (!ranges_valid (ranges, count))
+    {
+      return -1;
+    }
+  for (size_t i = 0; i < count; i++)
+    {
+      memcpy (&machine->cpu.Memory[ranges[i].address], ranges[i].bytes,
+              ranges[i].length);
+    }
+  return 0;
+}
+
+int
+ace64_dump (const ace64_machine *machine, const ace64_range *ranges,
+            size_t count)
+{
+  if (!ranges_valid (ranges, count))
+    {
+      return -1;
+    }
+  for (size_t i = 0; i < count; i++)
+    {
+      memcpy (ranges[i].bytes, &machine->cpu.Memory[ranges[i].address],
+              ranges[i].length);
+    }
+  return 0;
+}
+
+void
+ace64_get_registers (const ace64_machine *machine,
+                     ace64_registers *registers)
+{
+  registers->pc = machine->cpu.PC;
+  registers->sp = machine->cpu.SP;
+  registers->p = machine->cpu.P;
+  registers->a = machine->cpu.A;
+  registers->x = machine->cpu.X;
+  registers->y = machine->cpu.Y;
+  registers->reserved = 0;
+}
+
+void
+ace64_set_registers (ace64_machine *machine,
+                     const ace64_registers *registers)
+{
+  machine->cpu.PC = registers->pc;
+  machine->cpu.SP = registers->sp;
+  machine->cpu.P = registers->p;
+  machine->cpu.A = registers->a;
+  machine->cpu.X = registers->x;
+  machine->cpu.Y = registers->y;
+}
+
+void
+ace64_set_stops (ace64_machine *machine, uint32_t flags)
+{
+  machine->stops.brk = (flags & ACE64_STOP_BRK) != 0;
+  machine->stops.selfLoop = (flags & ACE64_STOP_SELF_LOOP) != 0;
+  machine->stops.illegal = (flags & ACE64_STOP_ILLEGAL) != 0;
+}
+
+int
+ace64_stop_at (ace64_machine *machine, uint16_t address)
+{
+  return run_stop_at (&machine->stops, address) ? 0 : -1;
+}
+
+int
+ace64_stop_on_write (ace64_machine *machine, uint16_t address)
+{
+  return run_stop_on_write (&machine->stops, address) ? 0 : -1;
+}
+
+void
+ace64_clear_stops (ace64_machine *machine)
+{
+  breakpoints_init (&machine->stops.breakpoints);
+  machine->stops.watching = false;
+}
+
+static void
+run_machine (ace64_machine *machine, Uint64 maxCycles, ace64_exit *exit)
+{
+  machine->stops.maxCycles = maxCycles;
+  RunExit result = run_until (&machine->cpu, &machine->stops);
+
+  memset (exit, 0, sizeof (*exit));
+  exit->reason = result.reason;
+  exit->pc = result.pc;
+  exit->address = result.address;
+  exit->value = result.value;
+  exit->instructions = result.instructions;
+  exit->cycles = result.cycles;
+}
+
+int
+ace64_run (ace64_machine *machine, uint64_t maxCycles, ace64_exit *exit)
+{
+  if (machine == NULL || exit == NULL)
+    {
+      return -1;
+    }
+  run_machine (machine, maxCycles, exit);
+  return 0;
+}
+
+static void *
+batch_worker (void *argument)
+{
+  Batch *batch = (Batch *)argument;
+  for (;;)
+    {
+      size_t i = atomic_fetch_add (&batch->next, 1);
+      if (i >= batch->count)
+        {
+          return NULL;
+        }
+      run_machine (batch->machines[i], batch->maxCycles, &batch->exits[i]);
+    }
+}
+
+int
+ace64_run_batch (ace64_machine *const *machines, size_t count,
+                 uint64_t maxCycles, ace64_exit *exits, int threads)
+{
+  if ((machines == NULL || exits == NULL) && count > 0)
+    {
+      return -1;
+    }
+  for (size_t i = 0; i < count; i++)
+    {
+      if (machines[i] == NULL)
+        {
+          return -1;
+        }
+    }
+
+  Batch batch;
+  batch.machines = machines;
+  batch.count = count;
+  batch.maxCycles = maxCycles;
+  batch.exits = exits;
+  atomic_init (&batch.next, 0);
+
+  int threadCount = support_thread_count (threads);
+  if ((size_t)threadCount > count)
+    {
+      threadCount = count > 0 ? (int)count : 1;
+    }
+
+  // The calling thread works too, so one thread starts none.
+  pthread_t *pool = NULL;
+  int started = 0;
+  if (threadCount > 1)
+    {
+      pool = (pthread_t *)calloc (threadCount - 1, sizeof (pthread_t));
+    }
+  while (pool != NULL && started < threadCount - 1
+         && pthread_create (&pool[started], NULL, batch_worker, &batch) == 0)
+    {
+      started++;
+    }
+  batch_worker (&batch);
+  for (int t = 0; t < started; t++)
+    {
+      pthread_join (pool[t], NULL);
+    }
+  free (pool);
+  return 0;
+}
@@ -0,0 +1,121 @@
+#ifndef LIBACE64_H_
+#define LIBACE64_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* libace64.h
+ * The stable C interface of libace64.so.  Machines are opaque handles, and
+ * everything crossing the interface is a fixed-width integer or one of the
+ * fixed-layout structs below, so bindings from other languages need no
+ * knowledge of struct CPU or of the build's feature options.  Only the
+ * ace64_* symbols are exported, under the ACE64_1 symbol version; later
+ * versions only add functions.
+ *
+ * Memory is shared, not copied: ace64_memory() returns a pointer to the
+ * machine's 64K, valid until ace64_destroy(), which callers may read and
+ * write between runs.  ace64_run_batch() runs many machines in one call,
+ * on a pool of threads, so a caller pays one crossing per batch rather
+ * than one per machine or per instruction.
+ *
+ * Functions returning int return 0 on success and -1 on bad arguments.
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#define ACE64_ABI_VERSION 1
+#define ACE64_MEMORY_SIZE 65536
+
+// Exit reasons; the values of RunExitReason (run.h)
+#define ACE64_EXIT_NONE 0
+#define ACE64_EXIT_BRK 1
+#define ACE64_EXIT_PC 2
+#define ACE64_EXIT_WRITE 3
+#define ACE64_EXIT_SELF_LOOP 4
+#define ACE64_EXIT_CYCLES 5
+#define ACE64_EXIT_INSTRUCTIONS 6
+#define ACE64_EXIT_ILLEGAL 7
+#define ACE64_EXIT_HOST 8
+
+// Stop flags for ace64_set_stops()
+#define ACE64_STOP_BRK 0x01
+#define ACE64_STOP_SELF_LOOP 0x02
+#define ACE64_STOP_ILLEGAL 0x04
+
+typedef struct ace64_machine ace64_machine;
+
+typedef struct
+{
+  uint16_t pc;
+  uint8_t sp;
+  uint8_t p;
+  uint8_t a;
+  uint8_t x;
+  uint8_t y;
+  uint8_t reserved;
+} ace64_registers;
+
+typedef struct
+{
+  uint32_t reason; // ACE64_EXIT_*
+  uint16_t pc;
+  uint16_t address; // The stop, sentinel or self-loop address
+  uint8_t value;    // The opcode, the byte written, or the EXIT status
+  uint8_t reserved[7];
+  uint64_t instructions;
+  uint64_t cycles;
+} ace64_exit;
+
+typedef struct
+{
+  uint16_t address;
+  uint16_t reserved;
+  uint32_t length; // address + length may not pass the end of memory
+  void *bytes;
+} ace64_range;
+
+uint32_t ace64_abi_version (void);
+
+// A machine in the reset state, stopping on BRK, self-loops and
+// unimplemented opcodes.  Memory is zero but for the processor port:
+// $00 = $FF, $01 = $07.  NULL if memory ran out.
+ace64_machine *ace64_create (void);
+void ace64_destroy (ace64_machine *machine);
+// Back to the state ace64_create() returns; the stops are kept.
+void ace64_reset (ace64_machine *machine);
+
+uint8_t *ace64_memory (ace64_machine *machine, size_t *length);
+int ace64_load (ace64_machine *machine, const ace64_range *ranges,
+                size_t count);
+int ace64_dump (const ace64_machine *machine, const ace64_range *ranges,
+                size_t count);
+
+void ace64_get_registers (const ace64_machine *machine,
+                          ace64_registers *registers);
+void ace64_set_registers (ace64_machine *machine,
+                          const ace64_registers *registers);
+
+void ace64_set_stops (ace64_machine *machine, uint32_t flags);
+int ace64_stop_at (ace64_machine *machine, uint16_t address);
+// Fails unless the library was built with ACE64_WATCHPOINTS.
+int ace64_stop_on_write (ace64_machine *machine, uint16_t address);
+// Removes the stop and sentinel addresses; keeps the flags.
+void ace64_clear_stops (ace64_machine *machine);
+
+// Runs until a stop condition holds or at least maxCycles (0: no limit)
+// have passed.  A run that stopped before an instruction executes it when
+// run again.
+int ace64_run (ace64_machine *machine, uint64_t maxCycles, ace64_exit *exit);
+
+// Runs each of count machines as ace64_run() would, on up to threads
+// threads (0: one per online processor), and stores exits[i] for
+// machines[i].  A machine may appear only once in a batch.
+int ace64_run_batch (ace64_machine *const *machines, size_t count,
+                     uint64_t maxCycles, ace64_exit *exits, int threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
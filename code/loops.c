@@ -0,0 +1,427 @@
+#include "loops.h"
+#include "opcodes.h"
+#include <string.h>
+
+typedef enum
+{
+  OPERAND_NONE,
+  OPERAND_LOAD,
+  OPERAND_STORE,
+  OPERAND_COMPARE,
+} OperandClass;
+
+// One indexed memory operand of the loop body.
+typedef struct
+{
+  bool indexX;
+  bool indirect;  // (zp),Y: base is the zero-page pointer
+  bool store;     // Stores always take the page-crossing cycle
+  Word base;
+  Word address;   // Before indexing, once the pointer is resolved
+  Byte length;
+  Sint32 cycles;  // Without the page-crossing cycle of loads
+} LoopOperand;
+
+typedef struct
+{
+  LoopKind kind;
+  LoopOperand load;
+  LoopOperand compare;
+  LoopOperand stores[LOOPS_MAX_STORES];
+  int storeCount;
+
+  bool indexX;
+  int step;
+  bool compareIndex; // CPX/CPY #limit before the back branch
+  Byte limit;        // Index value that ends the loop: the operand or 0
+  Word end;          // First byte after the back branch
+
+  Sint32 cycles; // One iteration that branches back, without page crossings
+} Loop;
+
+#ifdef ACE64_LOOPS
+void
+loops_attach (CPU *cpu, Loops *loops)
+{
+  cpu->loops = loops;
+}
+#endif
+
+void
+loops_clear (Loops *loops)
+{
+  memset (loops, 0, sizeof (*loops));
+}
+
+static OperandClass
+decode_operand (const CPU *cpu, Word pc, LoopOperand *operand)
+{
+  OperandClass class;
+  Byte opcode = cpu->Memory[pc];
+  switch (opcode)
+    {
+    case INS_LDA_ABX:
+    case INS_LDA_ABY:
+    case INS_LDA_IDY:
+      class = OPERAND_LOAD;
+      break;
+    case INS_STA_ABX:
+    case INS_STA_ABY:
+    case INS_STA_IDY:
+      class = OPERAND_STORE;
+      break;
+    case INS_CMP_ABX:
+    case INS_CMP_ABY:
+    case INS_CMP_IDY:
+      class = OPERAND_COMPARE;
+      break;
+    default:
+      return OPERAND_NONE;
+    }
+
+  operand->indexX
+      = opcode == INS_LDA_ABX || opcode == INS_STA_ABX || opcode == INS_CMP_ABX;
+  operand->indirect
+      = opcode == INS_LDA_IDY || opcode == INS_STA_IDY || opcode == INS_CMP_IDY;
+  operand->store = class == OPERAND_STORE;
+  if (operand->indirect)
+    {
+      operand->base = cpu->Memory[(Word)(pc + 1)];
+      operand->length = 2;
+      operand->cycles = operand->store ? 6 : 5;
+    }
+  else
+    {
+      operand->base = get_word_address (cpu->Memory[(Word)(pc + 1)],
+                                        cpu->Memory[(Word)(pc + 2)]);
+      operand->length = 3;
+      operand->cycles = operand->store ? 5 : 4;
+    }
+  return class;
+}
+
+static bool
+decode (const CPU *cpu, Loop *loop)
+{
+  Word pc = cpu->PC;
+  LoopOperand operand;
+  OperandClass class = decode_operand (cpu, pc, &operand);
+
+  loop->kind = LOOP_FILL;
+  loop->storeCount = 0;
+  loop->cycles = 0;
+  if (class == OPERAND_LOAD)
+    {
+      loop->load = operand;
+      loop->cycles += operand.cycles;
+      pc += operand.length;
+      class = decode_operand (cpu, pc, &operand);
+      loop->kind = LOOP_COPY;
+    }
+  if (loop->kind == LOOP_COPY && class == OPERAND_COMPARE)
+    {
+      loop->kind = LOOP_COMPARE;
+      loop->compare = operand;
+      loop->cycles += operand.cycles;
+      pc += operand.length;
+      if (cpu->Memory[pc] != INS_BNE)
+        {
+          return false;
+        }
+      pc += 2;
+      loop->cycles += 2; // Not taken while the bytes match
+    }
+  else
+    {
+      while (class == OPERAND_STORE && loop->storeCount < LOOPS_MAX_STORES)
+        {
+          loop->stores[loop->storeCount++] = operand;
+          loop->cycles += operand.cycles;
+          pc += operand.length;
+          class = decode_operand (cpu, pc, &operand);
+        }
+      if (loop->storeCount == 0)
+        {
+          return false;
+        }
+    }
+
+  switch (cpu->Memory[pc])
+    {
+    case INS_INX:
+    case INS_DEX:
+      loop->indexX = true;
+      break;
+    case INS_INY:
+    case INS_DEY:
+      loop->indexX = false;
+      break;
+    default:
+      return false;
+    }
+  loop->step = cpu->Memory[pc] == INS_INX || cpu->Memory[pc] == INS_INY ? 1
+                                                                         : -1;
+  loop->cycles += 2;
+  pc++;
+
+  loop->compareIndex
+      = cpu->Memory[pc] == (loop->indexX ? INS_CPX_IM : INS_CPY_IM);
+  loop->limit = 0;
+  if (loop->compareIndex)
+    {
+      loop->limit = cpu->Memory[(Word)(pc + 1)];
+      loop->cycles += 2;
+      pc += 2;
+    }
+
+  Word head = cpu->PC;
+  if (cpu->Memory[pc] != INS_BNE
+      || (Word)(pc + 2 + (SByte)cpu->Memory[(Word)(pc + 1)]) != head)
+    {
+      return false;
+    }
+  loop->end = pc + 2;
+  loop->cycles += 3 + ((loop->end & 0xFF00) != (head & 0xFF00));
+
+  bool sameIndex = true;
+  if (loop->kind != LOOP_FILL)
+    {
+      sameIndex = loop->load.indexX == loop->indexX;
+    }
+  if (loop->kind == LOOP_COMPARE)
+    {
+      sameIndex = sameIndex && loop->compare.indexX == loop->indexX;
+    }
+  for (int i = 0; i < loop->storeCount; i++)
+    {
+      sameIndex = sameIndex && loop->stores[i].indexX == loop->indexX;
+    }
+  return sameIndex && loop->end > head; // The body must not wrap at $FFFF
+}
+
+static bool
+overlaps (Uint32 first, Uint32 last, Uint32 otherFirst, Uint32 otherLast)
+{
+  return first <= otherLast && otherFirst <= last;
+}
+
+// Resolves the operand's address and checks the addresses it touches for
+// indexes low..high.
+static bool
+resolve (const CPU *cpu, const Loop *loop, LoopOperand *operand, Byte low,
+         Byte high)
+{
+  operand->address = operand->base;
+  if (operand->indirect)
+    {
+      operand->address
+          = get_word_address (cpu->Memory[operand->base],
+                              cpu->Memory[(operand->base + 1) & 0xFF]);
+    }
+
+  Uint32 first = (Uint32)operand->address + low;
+  Uint32 last = (Uint32)operand->address + high;
+  if (last >= MAX_MEMORY || first <= LOOPS_PORT_LAST
+      || overlaps (first, last, LOOPS_IO_FIRST, LOOPS_IO_LAST))
+    {
+      return false;
+    }
+  if (!operand->store)
+    {
+      return true;
+    }
+
+  // A store must not change the loop's code or any (zp),Y pointer.
+  bool safe = !overlaps (first, last, cpu->PC, loop->end - 1);
+  const LoopOperand *indirect[2 + LOOPS_MAX_STORES];
+  int count = 0;
+  if (loop->kind != LOOP_FILL)
+    {
+      indirect[count++] = &loop->load;
+    }
+  if (loop->kind == LOOP_COMPARE)
+    {
+      indirect[count++] = &loop->compare;
+    }
+  for (int i = 0; i < loop->storeCount; i++)
+    {
+      indirect[count++] = &loop->stores[i];
+    }
+  for (int i = 0; i < count; i++)
+    {
+      if (indirect[i]->indirect)
+        {
+          Word pointer = indirect[i]->base;
+          safe = safe && !overlaps (first, last, pointer, pointer)
+                 && !overlaps (first, last, (pointer + 1) & 0xFF,
+                               (pointer + 1) & 0xFF);
+        }
+    }
+  return safe;
+}
+
+// Page-crossing cycles of a load or compare over indexes low..high.
+static Sint32
+crossings (const LoopOperand *operand, Byte low, Byte high)
+{
+  Uint32 first = 0x100 - (operand->address & 0xFF);
+  if (operand->store || high < first)
+    {
+      return 0;
+    }
+  return high - (low > first ? low : first) + 1;
+}
+
+// Copies the run of a copy loop, index by index in loop order when the
+// source and the stores overlap.
+static void
+copy (CPU *cpu, const Loop *loop, Byte index, Uint32 run, Byte low,
+      Byte high)
+{
+  bool disjoint = true;
+  for (int i = 0; i <= loop->storeCount; i++)
+    {
+      const LoopOperand *a = i == 0 ? &loop->load : &loop->stores[i - 1];
+      for (int j = i + 1; j <= loop->storeCount; j++)
+        {
+          const LoopOperand *b = &loop->stores[j - 1];
+          disjoint = disjoint
+                     && !overlaps (a->address + low, a->address + high,
+                                   b->address + low, b->address + high);
+        }
+    }
+
+  if (disjoint)
+    {
+      for (int i = 0; i < loop->storeCount; i++)
+        {
+          memcpy (&cpu->Memory[loop->stores[i].address + low],
+                  &cpu->Memory[loop->load.address + low], run);
+        }
+      return;
+    }
+
+  for (Uint32 k = 0; k < run; k++)
+    {
+      Byte i = index + (int)k * loop->step;
+      Byte value = cpu->Memory[loop->load.address + i];
+      for (int s = 0; s < loop->storeCount; s++)
+        {
+          cpu->Memory[loop->stores[s].address + i] = value;
+        }
+    }
+}
+
+Sint32
+loops_run (CPU *cpu, Loops *loops)
+{
+  Loop loop;
+  if (!decode (cpu, &loop))
+    {
+      return 0;
+    }
+
+  // Iterations left, the last included.  The interpreter runs the last so
+  // that the loop exits with exactly its flags; runs also stop before the
+  // index wraps, so each operand covers one contiguous range.
+  Byte index = loop.indexX ? cpu->X : cpu->Y;
+  Uint32 count = (Byte)((loop.limit - index) * loop.step);
+  Uint32 run = (count == 0 ? 256 : count) - 1;
+  Uint32 contiguous = loop.step > 0 ? 256 - index : (Uint32)index + 1;
+  if (run > contiguous)
+    {
+      run = contiguous;
+    }
+  if (run == 0)
+    {
+      return 0;
+    }
+
+  Byte low = loop.step > 0 ? index : index - (run - 1);
+  Byte high = low + (run - 1);
+  bool safe = true;
+  if (loop.kind != LOOP_FILL)
+    {
+      safe = resolve (cpu, &loop, &loop.load, low, high);
+    }
+  if (loop.kind == LOOP_COMPARE)
+    {
+      safe = safe && resolve (cpu, &loop, &loop.compare, low, high);
+    }
+  for (int i = 0; i < loop.storeCount; i++)
+    {
+      safe = safe && resolve (cpu, &loop, &loop.stores[i], low, high);
+    }
+  if (!safe)
+    {
+      loops->refused++;
+      return 0;
+    }
+
+  if (loop.kind == LOOP_COMPARE)
+    {
+      // Stop at the first mismatch; the interpreter takes that exit.
+      for (Uint32 k = 0; k < run; k++)
+        {
+          Byte i = index + (int)k * loop.step;
+          if (cpu->Memory[loop.load.address + i]
+              != cpu->Memory[loop.compare.address + i])
+            {
+              run = k;
+              break;
+            }
+        }
+      if (run == 0)
+        {
+          return 0;
+        }
+      low = loop.step > 0 ? index : index - (run - 1);
+      high = low + (run - 1);
+    }
+
+  Byte last = index + (int)(run - 1) * loop.step;
+  Sint32 cycles = loop.cycles * (Sint32)run;
+  switch (loop.kind)
+    {
+    case LOOP_FILL:
+      for (int i = 0; i < loop.storeCount; i++)
+        {
+          memset (&cpu->Memory[loop.stores[i].address + low], cpu->A, run);
+        }
+      break;
+    case LOOP_COPY:
+      copy (cpu, &loop, index, run, low, high);
+      cycles += crossings (&loop.load, low, high);
+      cpu->A = cpu->Memory[loop.stores[0].address + last];
+      break;
+    case LOOP_COMPARE:
+      cycles += crossings (&loop.load, low, high)
+                + crossings (&loop.compare, low, high);
+      cpu->A = cpu->Memory[loop.load.address + last];
+      set_flag (&cpu->P, FLAG_CARRY); // The last CMP was equal
+      break;
+    default:
+      break;
+    }
+
+  // Registers and flags as the back branch leaves them.
+  Byte next = index + (int)run * loop.step;
+  if (loop.indexX)
+    {
+      cpu->X = next;
+    }
+  else
+    {
+      cpu->Y = next;
+    }
+  set_status_flag (&cpu->P, next);
+  if (loop.compareIndex)
+    {
+      perform_cmp_logic (cpu, next, loop.limit);
+    }
+
+  loops->runs[loop.kind]++;
+  loops->iterations += run;
+  loops->cycles += cycles;
+  return cycles;
+}
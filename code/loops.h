@@ -0,0 +1,74 @@
+#ifndef LOOPS_H_
+#define LOOPS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* loops.h
+ * Native acceleration of fill, copy and compare loops.  At a loop head the
+ * core recognizes the canonical forms
+ *
+ *   fill:     STA m,I (up to four)              ; step ; [CPI #n] ; BNE head
+ *   copy:     LDA m,I ; STA m,I (up to four)    ; step ; [CPI #n] ; BNE head
+ *   compare:  LDA m,I ; CMP m,I ; BNE exit      ; step ; [CPI #n] ; BNE head
+ *
+ * where m,I is abs,X, abs,Y or (zp),Y, step is INX, DEX, INY or DEY on the
+ * same index register I and CPI is CPX or CPY.  Every iteration but the last
+ * (or the first mismatch of a compare) is run as one memset, memcpy or
+ * scan, with the cycles the interpreter would have counted, page-crossing
+ * cycles included; the loop is left at its head with the registers and
+ * flags of that point, and the interpreter runs the last iteration.
+ *
+ * Loops that would read or write the I/O area ($D000-$DFFF) or the
+ * processor port ($00-$01), store into their own code or into the pointer
+ * of a (zp),Y operand, or whose index wraps are run, or partly run, by the
+ * interpreter instead.  Overlapping copies are run byte by byte in loop
+ * order, so they propagate exactly as on the CPU.
+ *
+ * Only built into the core when ACE64_LOOPS is defined (cmake
+ * -DACE64_LOOPS=ON); execute() then runs loops natively while a Loops is
+ * attached and nothing else is watching individual accesses (trace,
+ * profile, heatmap, watchpoints, last writer, code map, state hash, a JSR
+ * cache recording, taint).  An accelerated run is one execute() step.
+ */
+#include "cpu.h"
+
+#define LOOPS_MAX_STORES 4
+#define LOOPS_IO_FIRST 0xD000
+#define LOOPS_IO_LAST 0xDFFF
+#define LOOPS_PORT_LAST 0x0001
+
+typedef enum
+{
+  LOOP_FILL,
+  LOOP_COPY,
+  LOOP_COMPARE,
+  LOOP_KINDS
+} LoopKind;
+
+struct Loops
+{
+  Uint64 runs[LOOP_KINDS]; // Native runs by kind
+  Uint64 iterations;       // Iterations run natively
+  Uint64 cycles;           // Cycles of those iterations
+  Uint64 refused;          // Loops left to the interpreter for safety
+};
+
+// Runs the loop at PC natively if there is one, returning its cycles, or 0
+// to execute the instruction normally.
+Sint32 loops_run (CPU *cpu, Loops *loops);
+
+#ifdef ACE64_LOOPS
+// Starts accelerating loops, counting into loops (which is not cleared);
+// NULL stops.
+void loops_attach (CPU *cpu, Loops *loops);
+#endif
+
+void loops_clear (Loops *loops);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,352 @@
+#ifndef MACHINE_HPP_
+#define MACHINE_HPP_
+
+/* machine.hpp
+ * ace64::Machine, a C++ owner of one CPU for tests and C++ tools.  It is
+ * move-only: a CPU is 64K and more, so copies happen only through clone(),
+ * never by accident in an argument list.  Memory moves in ranges through a
+ * Span, registers compare as an 8-byte RegisterState, and diff() reports
+ * which ranges of memory two machines disagree on, comparing 16 bytes at a
+ * time with SSE2 where the target has it.
+ *
+ * Header-only, so the core and libace64.so stay C.  The project builds as
+ * C++17, which has no std::span; Span converts from anything with data()
+ * and size(), std::span included.
+ */
+#include "cpu.h"
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace ace64
+{
+
+template <typename T> class Span
+{
+public:
+  constexpr Span () noexcept : pointer (nullptr), count (0) {}
+  constexpr Span (T *data, std::size_t size) noexcept
+      : pointer (data), count (size)
+  {
+  }
+  template <std::size_t N>
+  constexpr Span (T (&array)[N]) noexcept : pointer (array), count (N)
+  {
+  }
+  template <typename Container,
+            typename = std::enable_if_t<std::is_convertible_v<
+                decltype (std::declval<Container &> ().data ()), T *> > >
+  constexpr Span (Container &container) noexcept
+      : pointer (container.data ()), count (container.size ())
+  {
+  }
+  template <typename U,
+            typename = std::enable_if_t<std::is_convertible_v<U *, T *> > >
+  constexpr Span (Span<U> other) noexcept
+      : pointer (other.data ()), count (other.size ())
+  {
+  }
+
+  constexpr T *
+  data () const noexcept
+  {
+    return pointer;
+  }
+  constexpr std::size_t
+  size () const noexcept
+  {
+    return count;
+  }
+  constexpr bool
+  empty () const noexcept
+  {
+    return count == 0;
+  }
+  constexpr T &
+  operator[] (std::size_t i) const noexcept
+  {
+    return pointer[i];
+  }
+  constexpr T *
+  begin () const noexcept
+  {
+    return pointer;
+  }
+  constexpr T *
+  end () const noexcept
+  {
+    return pointer + count;
+  }
+  constexpr Span
+  subspan (std::size_t offset, std::size_t length) const noexcept
+  {
+    return Span (pointer + offset, length);
+  }
+
+private:
+  T *pointer;
+  std::size_t count;
+};
+
+struct RegisterState
+{
+  Word pc;
+  Byte sp, p, a, x, y;
+
+  static RegisterState
+  of (const CPU &cpu) noexcept
+  {
+    return { cpu.PC, cpu.SP, cpu.P, cpu.A, cpu.X, cpu.Y };
+  }
+
+  void
+  apply (CPU &cpu) const noexcept
+  {
+    cpu.PC = pc;
+    cpu.SP = sp;
+    cpu.P = p;
+    cpu.A = a;
+    cpu.X = x;
+    cpu.Y = y;
+  }
+
+  friend bool
+  operator== (const RegisterState &l, const RegisterState &r) noexcept
+  {
+    return l.pc == r.pc && l.sp == r.sp && l.p == r.p && l.a == r.a
+           && l.x == r.x && l.y == r.y;
+  }
+  friend bool
+  operator!= (const RegisterState &l, const RegisterState &r) noexcept
+  {
+    return !(l == r);
+  }
+};
+
+struct MemoryRange
+{
+  Uint32 address;
+  Uint32 length;
+
+  friend bool
+  operator== (const MemoryRange &l, const MemoryRange &r) noexcept
+  {
+    return l.address == r.address && l.length == r.length;
+  }
+};
+
+namespace detail
+{
+
+inline void
+add_changed (std::vector<MemoryRange> &ranges, Uint32 address, Uint32 length)
+{
+  if (!ranges.empty ()
+      && ranges.back ().address + ranges.back ().length == address)
+    {
+      ranges.back ().length += length;
+    }
+  else
+    {
+      ranges.push_back ({ address, length });
+    }
+}
+
+// Bit i of the result is set when before[i] != after[i], for 16 bytes.
+inline unsigned
+changed_mask (const Byte *before, const Byte *after) noexcept
+{
+#ifdef __SSE2__
+  __m128i l = _mm_loadu_si128 ((const __m128i *)before);
+  __m128i r = _mm_loadu_si128 ((const __m128i *)after);
+  return ~(unsigned)_mm_movemask_epi8 (_mm_cmpeq_epi8 (l, r)) & 0xFFFFu;
+#else
+  Uint64 l[2], r[2];
+  std::memcpy (l, before, 16);
+  std::memcpy (r, after, 16);
+  if (l[0] == r[0] && l[1] == r[1])
+    {
+      return 0;
+    }
+  unsigned mask = 0;
+  for (unsigned i = 0; i < 16; i++)
+    {
+      mask |= (unsigned)(before[i] != after[i]) << i;
+    }
+  return mask;
+#endif
+}
+
+} // namespace detail
+
+// The ranges where two images of length bytes differ, in address order,
+// with adjacent changed bytes merged.
+inline std::vector<MemoryRange>
+diff_memory (const Byte *before, const Byte *after, std::size_t length)
+{
+  std::vector<MemoryRange> ranges;
+  std::size_t i = 0;
+  for (; i + 16 <= length; i += 16)
+    {
+      unsigned mask = detail::changed_mask (before + i, after + i);
+      if (mask == 0xFFFFu)
+        {
+          detail::add_changed (ranges, (Uint32)i, 16);
+          continue;
+        }
+      while (mask != 0)
+        {
+          unsigned first = (unsigned)__builtin_ctz (mask);
+          unsigned run = (unsigned)__builtin_ctz (~(mask >> first));
+          detail::add_changed (ranges, (Uint32)(i + first), run);
+          mask &= ~(((1u << run) - 1) << first);
+        }
+    }
+  for (; i < length; i++)
+    {
+      if (before[i] != after[i])
+        {
+          detail::add_changed (ranges, (Uint32)i, 1);
+        }
+    }
+  return ranges;
+}
+
+class Machine
+{
+public:
+  // As after reset(), which also initializes memory.
+  Machine () : cpuState (allocate ()) { reset (cpuState); }
+
+  Machine (const Machine &) = delete;
+  Machine &operator= (const Machine &) = delete;
+
+  Machine (Machine &&other) noexcept : cpuState (other.cpuState)
+  {
+    other.cpuState = nullptr;
+  }
+
+  Machine &
+  operator= (Machine &&other) noexcept
+  {
+    std::swap (cpuState, other.cpuState);
+    return *this;
+  }
+
+  ~Machine () { release (cpuState); }
+
+  // A deep copy: the whole CPU, attachment pointers included.
+  Machine
+  clone () const
+  {
+    Machine copy (allocate ());
+    std::memcpy (copy.cpuState, cpuState, sizeof (CPU));
+    return copy;
+  }
+
+  // For the C API; invalid once the machine is moved from.
+  CPU &
+  cpu () noexcept
+  {
+    return *cpuState;
+  }
+  const CPU &
+  cpu () const noexcept
+  {
+    return *cpuState;
+  }
+
+  RegisterState
+  registers () const noexcept
+  {
+    return RegisterState::of (*cpuState);
+  }
+  void
+  set_registers (const RegisterState &state) noexcept
+  {
+    state.apply (*cpuState);
+  }
+
+  Span<Byte>
+  memory () noexcept
+  {
+    return Span<Byte> (cpuState->Memory, MAX_MEMORY);
+  }
+  Span<const Byte>
+  memory () const noexcept
+  {
+    return Span<const Byte> (cpuState->Memory, MAX_MEMORY);
+  }
+
+  // Copies bytes to memory at address.  False, copying nothing, if the
+  // range passes the end of memory.
+  bool
+  load (Word address, Span<const Byte> bytes) noexcept
+  {
+    if (address + bytes.size () > MAX_MEMORY)
+      {
+        return false;
+      }
+    std::memcpy (&cpuState->Memory[address], bytes.data (), bytes.size ());
+    return true;
+  }
+
+  // Fills out from memory at address; false under the same condition.
+  bool
+  store (Word address, Span<Byte> out) const noexcept
+  {
+    if (address + out.size () > MAX_MEMORY)
+      {
+        return false;
+      }
+    std::memcpy (out.data (), &cpuState->Memory[address], out.size ());
+    return true;
+  }
+
+  Sint32
+  step () noexcept
+  {
+    return execute (cpuState);
+  }
+
+  std::vector<MemoryRange>
+  diff (const Machine &other) const
+  {
+    return diff_memory (cpuState->Memory, other.cpuState->Memory,
+                        MAX_MEMORY);
+  }
+
+private:
+  static constexpr std::align_val_t alignment{ 64 };
+
+  explicit Machine (CPU *state) noexcept : cpuState (state) {}
+
+  static CPU *
+  allocate ()
+  {
+    return static_cast<CPU *> (::operator new (sizeof (CPU), alignment));
+  }
+
+  static void
+  release (CPU *state) noexcept
+  {
+    if (state != nullptr)
+      {
+        ::operator delete (state, alignment);
+      }
+  }
+
+  CPU *cpuState;
+};
+
+} // namespace ace64
+
+#endif
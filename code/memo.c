@@ -0,0 +1,132 @@
+#include "memo.h"
+#include <string.h>
+
+#ifdef ACE64_MEMO
+void
+memo_attach (CPU *cpu, Memo *memo)
+{
+  cpu->memo = memo;
+}
+#endif
+
+void
+memo_clear (Memo *memo)
+{
+  memset (memo, 0, sizeof (*memo));
+  memo->generation = 1;
+}
+
+static MemoEntry *
+entry_for (Memo *memo, const CPU *cpu)
+{
+  Uint32 key = (Uint32)cpu->PC ^ (Uint32)cpu->A << 16 ^ (Uint32)cpu->X << 8
+               ^ (Uint32)cpu->Y << 24 ^ (Uint32)cpu->P << 4
+               ^ (Uint32)cpu->SP << 12;
+  return &memo->entries[(key * 2654435761u) >> 22]; // 10 bits: MEMO_ENTRIES
+}
+
+static bool
+entry_matches (const MemoEntry *entry, const CPU *cpu)
+{
+  return entry->callPC == cpu->PC && entry->A == cpu->A && entry->X == cpu->X
+         && entry->Y == cpu->Y && entry->P == cpu->P && entry->SP == cpu->SP;
+}
+
+static Sint32
+replay (CPU *cpu, const MemoEntry *entry)
+{
+  for (Uint32 i = 0; i < entry->readCount; i++)
+    {
+      if (cpu->Memory[entry->readAddresses[i]] != entry->readValues[i])
+        {
+          return 0;
+        }
+    }
+
+  for (Uint32 i = 0; i < entry->writeCount; i++)
+    {
+      cpu->Memory[entry->writeAddresses[i]] = entry->writeValues[i];
+    }
+  cpu->PC = entry->outPC;
+  cpu->A = entry->outA;
+  cpu->X = entry->outX;
+  cpu->Y = entry->outY;
+  cpu->P = entry->outP;
+  cpu->SP = entry->outSP;
+  return entry->cycles;
+}
+
+Sint32
+memo_call (CPU *cpu, Memo *memo)
+{
+  MemoEntry *entry = entry_for (memo, cpu);
+  if (entry->state != MEMO_EMPTY && entry_matches (entry, cpu))
+    {
+      if (entry->state == MEMO_UNCACHEABLE)
+        {
+          return 0;
+        }
+      Sint32 cycles = replay (cpu, entry);
+      if (cycles != 0)
+        {
+          memo->hits++;
+          memo->cyclesReplayed += cycles;
+          return cycles;
+        }
+      memo->invalidated++;
+    }
+
+  // Record this call into the entry, evicting what was there.
+  if (++memo->generation == 0)
+    {
+      memset (memo->readStamps, 0, sizeof (memo->readStamps));
+      memset (memo->writeStamps, 0, sizeof (memo->writeStamps));
+      memo->generation = 1;
+    }
+  entry->state = MEMO_EMPTY;
+  entry->callPC = cpu->PC;
+  entry->A = cpu->A;
+  entry->X = cpu->X;
+  entry->Y = cpu->Y;
+  entry->P = cpu->P;
+  entry->SP = cpu->SP;
+  entry->readCount = 0;
+  entry->writeCount = 0;
+
+  memo->record = entry;
+  memo->returnPC = cpu->PC + 3;
+  memo->returnSP = cpu->SP;
+  memo->steps = 0;
+  memo->cycles = 0;
+  memo->overflowed = false;
+  return 0;
+}
+
+void
+memo_finish (CPU *cpu, Memo *memo)
+{
+  MemoEntry *entry = memo->record;
+  for (Uint32 i = 0; i < entry->writeCount; i++)
+    {
+      entry->writeValues[i] = cpu->Memory[entry->writeAddresses[i]];
+    }
+  entry->outPC = cpu->PC;
+  entry->outA = cpu->A;
+  entry->outX = cpu->X;
+  entry->outY = cpu->Y;
+  entry->outP = cpu->P;
+  entry->outSP = cpu->SP;
+  entry->cycles = memo->cycles;
+  entry->state = MEMO_CACHED;
+
+  memo->record = NULL;
+  memo->recorded++;
+}
+
+void
+memo_abort (Memo *memo)
+{
+  memo->record->state = MEMO_UNCACHEABLE;
+  memo->record = NULL;
+  memo->aborted++;
+}
@@ -0,0 +1,177 @@
+#ifndef MEMO_H_
+#define MEMO_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* memo.h
+ * JSR result cache.  The first time a subroutine is called from a given
+ * call site with given registers, the call (from the JSR to the matching
+ * return) is recorded: every address it reads before writing, with the
+ * value read, every address it writes, with the value left there, the
+ * final registers and the cycle count.  A later call with the same key
+ * whose recorded reads all still hold their values is replayed: the writes
+ * and registers are applied and execute() returns the call's cycles as
+ * one step.  Opcode fetches are reads, so patched code or changed data
+ * simply fail the check and the call is recorded again.
+ *
+ * The key is (call site, A, X, Y, P, SP) rather than the JSR target: a
+ * routine may read its own return address, so only calls from the same
+ * site are known to behave alike.  Calls that run longer than
+ * MEMO_MAX_STEPS instructions, or read or write more than MEMO_MAX_READS or
+ * MEMO_MAX_WRITES addresses, are marked uncacheable for that key.
+ *
+ * Only built into the core when ACE64_MEMO is defined (cmake
+ * -DACE64_MEMO=ON).  A replay stores to memory directly, so calls are
+ * neither recorded nor replayed while a trace, profile, heatmap,
+ * watchpoint, last-writer table, code map, state hash or taint map is
+ * attached; they run instruction by instruction instead.
+ */
+#include "cpu.h"
+#include <stddef.h>
+
+#define MEMO_ENTRIES 1024 // Direct-mapped by key
+#define MEMO_MAX_READS 256
+#define MEMO_MAX_WRITES 64
+#define MEMO_MAX_STEPS 10000
+
+typedef enum
+{
+  MEMO_EMPTY,
+  MEMO_CACHED,
+  MEMO_UNCACHEABLE,
+} MemoEntryState;
+
+typedef struct
+{
+  // Key
+  Word callPC;
+  Byte A, X, Y, P, SP;
+  Byte state; // MemoEntryState
+
+  Word readCount;
+  Word writeCount;
+  Word readAddresses[MEMO_MAX_READS];
+  Byte readValues[MEMO_MAX_READS];
+  Word writeAddresses[MEMO_MAX_WRITES];
+  Byte writeValues[MEMO_MAX_WRITES];
+
+  // Registers after the call, and its length
+  Word outPC;
+  Byte outA, outX, outY, outP, outSP;
+  Sint32 cycles;
+} MemoEntry;
+
+struct Memo
+{
+  MemoEntry entries[MEMO_ENTRIES];
+
+  // The recording in progress, if any.  An address has been read or written
+  // during it if its stamp equals generation.
+  MemoEntry *record;
+  Uint32 generation;
+  Uint32 readStamps[MAX_MEMORY];
+  Uint32 writeStamps[MAX_MEMORY];
+  Word returnPC;
+  Byte returnSP;
+  Uint32 steps;
+  Sint32 cycles;
+  bool overflowed; // The read or write set is full
+
+  Uint64 hits;
+  Uint64 recorded;    // Calls recorded into the cache
+  Uint64 invalidated; // Hits on the key whose reads no longer matched
+  Uint64 aborted;     // Recordings that exceeded the limits
+  Uint64 cyclesReplayed;
+};
+
+Sint32 memo_call (CPU *cpu, Memo *memo);
+void memo_finish (CPU *cpu, Memo *memo);
+void memo_abort (Memo *memo);
+
+// execute() calls these while a cache is attached.  memo_begin() returns
+// the cycles of a replayed call, or 0 to execute the instruction normally.
+static inline Sint32
+memo_begin (CPU *cpu, Memo *memo)
+{
+  if (memo->record != NULL || cpu->Memory[cpu->PC] != INS_JSR_ABS)
+    {
+      return 0;
+    }
+  return memo_call (cpu, memo);
+}
+
+static inline void
+memo_end (CPU *cpu, Memo *memo, Sint32 cycles)
+{
+  if (memo->record == NULL)
+    {
+      return;
+    }
+  memo->cycles += cycles;
+  if (memo->overflowed || ++memo->steps >= MEMO_MAX_STEPS)
+    {
+      memo_abort (memo);
+    }
+  else if (cpu->PC == memo->returnPC && cpu->SP == memo->returnSP)
+    {
+      memo_finish (cpu, memo);
+    }
+}
+
+// Record one access of the call being recorded.  Reads of addresses the
+// call has already read or written are ignored.  These stay free of calls
+// so that the accessors need no stack frame when no cache is attached; a
+// full set is flagged and aborted by memo_end().
+static inline void
+memo_read (Memo *memo, Word address, Byte value)
+{
+  if (memo->readStamps[address] == memo->generation
+      || memo->writeStamps[address] == memo->generation)
+    {
+      return;
+    }
+  memo->readStamps[address] = memo->generation;
+
+  MemoEntry *record = memo->record;
+  if (record->readCount == MEMO_MAX_READS)
+    {
+      memo->overflowed = true;
+      return;
+    }
+  record->readAddresses[record->readCount] = address;
+  record->readValues[record->readCount] = value;
+  record->readCount++;
+}
+
+static inline void
+memo_write (Memo *memo, Word address)
+{
+  if (memo->writeStamps[address] == memo->generation)
+    {
+      return;
+    }
+  memo->writeStamps[address] = memo->generation;
+
+  MemoEntry *record = memo->record;
+  if (record->writeCount == MEMO_MAX_WRITES)
+    {
+      memo->overflowed = true;
+      return;
+    }
+  record->writeAddresses[record->writeCount++] = address;
+}
+
+#ifdef ACE64_MEMO
+// Starts using memo (which is not cleared); NULL stops.
+void memo_attach (CPU *cpu, Memo *memo);
+#endif
+
+void memo_clear (Memo *memo);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
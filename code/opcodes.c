@@ -334,7 +334,12 @@ perform_adc_decimal (CPU *cpu, Byte value)
 
   Word binarySum = (Word)startA + (Word)value + (Word)carry;
 
-  if ((~(startA ^ value) & (startA ^ (Byte)binarySum)) & 0x80)
+  // On the NMOS part N and V reflect the sum after the low nibble has been
+  // adjusted but before the high nibble is, while Z follows the binary sum.
+  int adjustedSum = (SByte)(startA & 0xF0) + (SByte)(value & 0xF0)
+                    + (intermediateCarry << 4) + (lo & 0x0F);
+
+  if (adjustedSum < -128 || adjustedSum > 127)
     {
       set_flag (&cpu->P, FLAG_OVERFLOW);
     }
@@ -343,15 +348,6 @@ perform_adc_decimal (CPU *cpu, Byte value)
       clear_flag (&cpu->P, FLAG_OVERFLOW);
     }
 
-  if (binarySum & 0x80)
-    {
-      set_flag (&cpu->P, FLAG_NEGATIVE);
-    }
-  else
-    {
-      clear_flag (&cpu->P, FLAG_NEGATIVE);
-    }
-
   if (hi > 0x09)
     {
       hi += 0x06;
@@ -368,7 +364,16 @@ perform_adc_decimal (CPU *cpu, Byte value)
 
   cpu->A = ((hi << 4) | (lo & 0x0F)) & 0xFF;
 
-  set_status_flag (&cpu->P, binarySum);
+  set_status_flag (&cpu->P, (Byte)binarySum);
+
+  if (adjustedSum & 0x80)
+    {
+      set_flag (&cpu->P, FLAG_NEGATIVE);
+    }
+  else
+    {
+      clear_flag (&cpu->P, FLAG_NEGATIVE);
+    }
 }
 
 void
@@ -402,7 +407,7 @@ perform_sbc_decimal (CPU *cpu, Byte value)
       clear_flag (&cpu->P, FLAG_CARRY);
     }
 
-  if ((~(cpu->A ^ value) & (cpu->A ^ (Byte)binarySum)) & 0x80)
+  if (((cpu->A ^ value) & (cpu->A ^ (Byte)binarySum)) & 0x80)
     {
       set_flag (&cpu->P, FLAG_OVERFLOW);
     }
@@ -413,7 +418,8 @@ perform_sbc_decimal (CPU *cpu, Byte value)
 
   cpu->A = ((hiA << 4) | (loA & 0x0F)) & 0xFF;
 
-  set_status_flag (&cpu->P, cpu->A);
+  // NMOS SBC sets N and Z from the binary difference, not the BCD result.
+  set_status_flag (&cpu->P, (Byte)binarySum);
 }
 
 void execute_branch(CPU *cpu, Sint32 *cycles, bool condition) {
@@ -34,6 +34,7 @@ Byte perform_ror_logic (CPU *cpu, Byte value);
 Byte perform_eor_logic (CPU *cpu, Byte value);
 Byte perform_ora_logic (CPU *cpu, Byte value);
 void perform_bit_logic (CPU *cpu, Byte value);
+void perform_cmp_logic (CPU *cpu, Byte registerValue, Byte readValue);
 
 // Math functions
 void perform_adc_binary (CPU *cpu, Byte value);
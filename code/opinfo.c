@@ -0,0 +1,167 @@
+#include "opinfo.h"
+#include <stdio.h>
+
+const OpcodeInfo opcode_info[256] = {
+  /* $00 */
+  { "BRK", MODE_IMP }, { "ORA", MODE_IDX }, { "JAM", MODE_IMP }, { "SLO", MODE_IDX },
+  { "NOP", MODE_ZP }, { "ORA", MODE_ZP }, { "ASL", MODE_ZP }, { "SLO", MODE_ZP },
+  { "PHP", MODE_IMP }, { "ORA", MODE_IMM }, { "ASL", MODE_ACC }, { "ANC", MODE_IMM },
+  { "NOP", MODE_ABS }, { "ORA", MODE_ABS }, { "ASL", MODE_ABS }, { "SLO", MODE_ABS },
+  /* $10 */
+  { "BPL", MODE_REL }, { "ORA", MODE_IDY }, { "JAM", MODE_IMP }, { "SLO", MODE_IDY },
+  { "NOP", MODE_ZPX }, { "ORA", MODE_ZPX }, { "ASL", MODE_ZPX }, { "SLO", MODE_ZPX },
+  { "CLC", MODE_IMP }, { "ORA", MODE_ABY }, { "NOP", MODE_IMP }, { "SLO", MODE_ABY },
+  { "NOP", MODE_ABX }, { "ORA", MODE_ABX }, { "ASL", MODE_ABX }, { "SLO", MODE_ABX },
+  /* $20 */
+  { "JSR", MODE_ABS }, { "AND", MODE_IDX }, { "JAM", MODE_IMP }, { "RLA", MODE_IDX },
+  { "BIT", MODE_ZP }, { "AND", MODE_ZP }, { "ROL", MODE_ZP }, { "RLA", MODE_ZP },
+  { "PLP", MODE_IMP }, { "AND", MODE_IMM }, { "ROL", MODE_ACC }, { "ANC", MODE_IMM },
+  { "BIT", MODE_ABS }, { "AND", MODE_ABS }, { "ROL", MODE_ABS }, { "RLA", MODE_ABS },
+  /* $30 */
+  { "BMI", MODE_REL }, { "AND", MODE_IDY }, { "JAM", MODE_IMP }, { "RLA", MODE_IDY },
+  { "NOP", MODE_ZPX }, { "AND", MODE_ZPX }, { "ROL", MODE_ZPX }, { "RLA", MODE_ZPX },
+  { "SEC", MODE_IMP }, { "AND", MODE_ABY }, { "NOP", MODE_IMP }, { "RLA", MODE_ABY },
+  { "NOP", MODE_ABX }, { "AND", MODE_ABX }, { "ROL", MODE_ABX }, { "RLA", MODE_ABX },
+  /* $40 */
+  { "RTI", MODE_IMP }, { "EOR", MODE_IDX }, { "JAM", MODE_IMP }, { "SRE", MODE_IDX },
+  { "NOP", MODE_ZP }, { "EOR", MODE_ZP }, { "LSR", MODE_ZP }, { "SRE", MODE_ZP },
+  { "PHA", MODE_IMP }, { "EOR", MODE_IMM }, { "LSR", MODE_ACC }, { "ALR", MODE_IMM },
+  { "JMP", MODE_ABS }, { "EOR", MODE_ABS }, { "LSR", MODE_ABS }, { "SRE", MODE_ABS },
+  /* $50 */
+  { "BVC", MODE_REL }, { "EOR", MODE_IDY }, { "JAM", MODE_IMP }, { "SRE", MODE_IDY },
+  { "NOP", MODE_ZPX }, { "EOR", MODE_ZPX }, { "LSR", MODE_ZPX }, { "SRE", MODE_ZPX },
+  { "CLI", MODE_IMP }, { "EOR", MODE_ABY }, { "NOP", MODE_IMP }, { "SRE", MODE_ABY },
+  { "NOP", MODE_ABX }, { "EOR", MODE_ABX }, { "LSR", MODE_ABX }, { "SRE", MODE_ABX },
+  /* $60 */
+  { "RTS", MODE_IMP }, { "ADC", MODE_IDX }, { "JAM", MODE_IMP }, { "RRA", MODE_IDX },
+  { "NOP", MODE_ZP }, { "ADC", MODE_ZP }, { "ROR", MODE_ZP }, { "RRA", MODE_ZP },
+  { "PLA", MODE_IMP }, { "ADC", MODE_IMM }, { "ROR", MODE_ACC }, { "ARR", MODE_IMM },
+  { "JMP", MODE_IND }, { "ADC", MODE_ABS }, { "ROR", MODE_ABS }, { "RRA", MODE_ABS },
+  /* $70 */
+  { "BVS", MODE_REL }, { "ADC", MODE_IDY }, { "JAM", MODE_IMP }, { "RRA", MODE_IDY },
+  { "NOP", MODE_ZPX }, { "ADC", MODE_ZPX }, { "ROR", MODE_ZPX }, { "RRA", MODE_ZPX },
+  { "SEI", MODE_IMP }, { "ADC", MODE_ABY }, { "NOP", MODE_IMP }, { "RRA", MODE_ABY },
+  { "NOP", MODE_ABX }, { "ADC", MODE_ABX }, { "ROR", MODE_ABX }, { "RRA", MODE_ABX },
+  /* $80 */
+  { "NOP", MODE_IMM }, { "STA", MODE_IDX }, { "NOP", MODE_IMM }, { "SAX", MODE_IDX },
+  { "STY", MODE_ZP }, { "STA", MODE_ZP }, { "STX", MODE_ZP }, { "SAX", MODE_ZP },
+  { "DEY", MODE_IMP }, { "NOP", MODE_IMM }, { "TXA", MODE_IMP }, { "ANE", MODE_IMM },
+  { "STY", MODE_ABS }, { "STA", MODE_ABS }, { "STX", MODE_ABS }, { "SAX", MODE_ABS },
+  /* $90 */
+  { "BCC", MODE_REL }, { "STA", MODE_IDY }, { "JAM", MODE_IMP }, { "SHA", MODE_IDY },
+  { "STY", MODE_ZPX }, { "STA", MODE_ZPX }, { "STX", MODE_ZPY }, { "SAX", MODE_ZPY },
+  { "TYA", MODE_IMP }, { "STA", MODE_ABY }, { "TXS", MODE_IMP }, { "TAS", MODE_ABY },
+  { "SHY", MODE_ABX }, { "STA", MODE_ABX }, { "SHX", MODE_ABY }, { "SHA", MODE_ABY },
+  /* $A0 */
+  { "LDY", MODE_IMM }, { "LDA", MODE_IDX }, { "LDX", MODE_IMM }, { "LAX", MODE_IDX },
+  { "LDY", MODE_ZP }, { "LDA", MODE_ZP }, { "LDX", MODE_ZP }, { "LAX", MODE_ZP },
+  { "TAY", MODE_IMP }, { "LDA", MODE_IMM }, { "TAX", MODE_IMP }, { "LAX", MODE_IMM },
+  { "LDY", MODE_ABS }, { "LDA", MODE_ABS }, { "LDX", MODE_ABS }, { "LAX", MODE_ABS },
+  /* $B0 */
+  { "BCS", MODE_REL }, { "LDA", MODE_IDY }, { "JAM", MODE_IMP }, { "LAX", MODE_IDY },
+  { "LDY", MODE_ZPX }, { "LDA", MODE_ZPX }, { "LDX", MODE_ZPY }, { "LAX", MODE_ZPY },
+  { "CLV", MODE_IMP }, { "LDA", MODE_ABY }, { "TSX", MODE_IMP }, { "LAS", MODE_ABY },
+  { "LDY", MODE_ABX }, { "LDA", MODE_ABX }, { "LDX", MODE_ABY }, { "LAX", MODE_ABY },
+  /* $C0 */
+  { "CPY", MODE_IMM }, { "CMP", MODE_IDX }, { "NOP", MODE_IMM }, { "DCP", MODE_IDX },
+  { "CPY", MODE_ZP }, { "CMP", MODE_ZP }, { "DEC", MODE_ZP }, { "DCP", MODE_ZP },
+  { "INY", MODE_IMP }, { "CMP", MODE_IMM }, { "DEX", MODE_IMP }, { "SBX", MODE_IMM },
+  { "CPY", MODE_ABS }, { "CMP", MODE_ABS }, { "DEC", MODE_ABS }, { "DCP", MODE_ABS },
+  /* $D0 */
+  { "BNE", MODE_REL }, { "CMP", MODE_IDY }, { "JAM", MODE_IMP }, { "DCP", MODE_IDY },
+  { "NOP", MODE_ZPX }, { "CMP", MODE_ZPX }, { "DEC", MODE_ZPX }, { "DCP", MODE_ZPX },
+  { "CLD", MODE_IMP }, { "CMP", MODE_ABY }, { "NOP", MODE_IMP }, { "DCP", MODE_ABY },
+  { "NOP", MODE_ABX }, { "CMP", MODE_ABX }, { "DEC", MODE_ABX }, { "DCP", MODE_ABX },
+  /* $E0 */
+  { "CPX", MODE_IMM }, { "SBC", MODE_IDX }, { "NOP", MODE_IMM }, { "ISC", MODE_IDX },
+  { "CPX", MODE_ZP }, { "SBC", MODE_ZP }, { "INC", MODE_ZP }, { "ISC", MODE_ZP },
+  { "INX", MODE_IMP }, { "SBC", MODE_IMM }, { "NOP", MODE_IMP }, { "SBC", MODE_IMM },
+  { "CPX", MODE_ABS }, { "SBC", MODE_ABS }, { "INC", MODE_ABS }, { "ISC", MODE_ABS },
+  /* $F0 */
+  { "BEQ", MODE_REL }, { "SBC", MODE_IDY }, { "JAM", MODE_IMP }, { "ISC", MODE_IDY },
+  { "NOP", MODE_ZPX }, { "SBC", MODE_ZPX }, { "INC", MODE_ZPX }, { "ISC", MODE_ZPX },
+  { "SED", MODE_IMP }, { "SBC", MODE_ABY }, { "NOP", MODE_IMP }, { "ISC", MODE_ABY },
+  { "NOP", MODE_ABX }, { "SBC", MODE_ABX }, { "INC", MODE_ABX }, { "ISC", MODE_ABX }
+};
+
+const char *
+addressing_mode_name (AddressingMode mode)
+{
+  static const char *names[] = { "imp", "acc", "imm", "zp",  "zpx",
+                                 "zpy", "abs", "abx", "aby", "ind",
+                                 "idx", "idy", "rel" };
+  return names[mode];
+}
+
+Byte
+addressing_mode_length (AddressingMode mode)
+{
+  switch (mode)
+    {
+    case MODE_IMP:
+    case MODE_ACC:
+      return 1;
+    case MODE_ABS:
+    case MODE_ABX:
+    case MODE_ABY:
+    case MODE_IND:
+      return 3;
+    default:
+      return 2;
+    }
+}
+
+Byte
+disassemble (const Byte *bytes, Word pc, char *text, size_t size)
+{
+  const OpcodeInfo *info = &opcode_info[bytes[0]];
+  Byte zp = bytes[1];
+  Word address = get_word_address (bytes[1], bytes[2]);
+  Word target = (Word)(pc + 2 + (SByte)bytes[1]);
+  const char *m = info->mnemonic;
+
+  switch (info->mode)
+    {
+    case MODE_IMP:
+      snprintf (text, size, "%s", m);
+      break;
+    case MODE_ACC:
+      snprintf (text, size, "%s A", m);
+      break;
+    case MODE_IMM:
+      snprintf (text, size, "%s #$%02X", m, zp);
+      break;
+    case MODE_ZP:
+      snprintf (text, size, "%s $%02X", m, zp);
+      break;
+    case MODE_ZPX:
+      snprintf (text, size, "%s $%02X,X", m, zp);
+      break;
+    case MODE_ZPY:
+      snprintf (text, size, "%s $%02X,Y", m, zp);
+      break;
+    case MODE_ABS:
+      snprintf (text, size, "%s $%04X", m, address);
+      break;
+    case MODE_ABX:
+      snprintf (text, size, "%s $%04X,X", m, address);
+      break;
+    case MODE_ABY:
+      snprintf (text, size, "%s $%04X,Y", m, address);
+      break;
+    case MODE_IND:
+      snprintf (text, size, "%s ($%04X)", m, address);
+      break;
+    case MODE_IDX:
+      snprintf (text, size, "%s ($%02X,X)", m, zp);
+      break;
+    case MODE_IDY:
+      snprintf (text, size, "%s ($%02X),Y", m, zp);
+      break;
+    case MODE_REL:
+      snprintf (text, size, "%s $%04X", m, target);
+      break;
+    }
+
+  return addressing_mode_length (info->mode);
+}
@@ -0,0 +1,55 @@
+#ifndef OPINFO_H_
+#define OPINFO_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* opinfo.h
+ * Static description of every opcode: mnemonic and addressing mode.  Used by
+ * tools (benchmarks, trace decoding) that need to know the shape of an
+ * instruction without executing it.
+ */
+#include "cpu.h"
+#include <stddef.h>
+
+typedef enum
+{
+  MODE_IMP, // Implied
+  MODE_ACC, // Accumulator
+  MODE_IMM, // Immediate
+  MODE_ZP,  // Zero Page
+  MODE_ZPX, // Zero Page,X
+  MODE_ZPY, // Zero Page,Y
+  MODE_ABS, // Absolute
+  MODE_ABX, // Absolute,X
+  MODE_ABY, // Absolute,Y
+  MODE_IND, // (Indirect) - JMP only
+  MODE_IDX, // (Indirect,X)
+  MODE_IDY, // (Indirect),Y
+  MODE_REL  // Relative - branches
+} AddressingMode;
+
+typedef struct
+{
+  const char *mnemonic;
+  AddressingMode mode;
+} OpcodeInfo;
+
+// Describes the opcode as the NMOS 6502 decodes it.  Illegal opcodes carry
+// their common names even where the core only implements them as NOPs.
+extern const OpcodeInfo opcode_info[256];
+
+const char *addressing_mode_name (AddressingMode mode);
+Byte addressing_mode_length (AddressingMode mode);
+
+// Formats the instruction at bytes (opcode plus up to two operand bytes) as
+// assembly, e.g. "LDA ($42),Y".  pc is the instruction's address, needed to
+// resolve branch targets.  Returns the instruction length in bytes.
+Byte disassemble (const Byte *bytes, Word pc, char *text, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
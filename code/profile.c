@@ -0,0 +1,271 @@
+#include "profile.h"
+#include "opcodes.h"
+#include "opinfo.h"
+#include <string.h>
+
+// Returns true if the indexed operand at PC will land on another page than
+// its base address.  Evaluated before the handler runs, so it reads the same
+// bytes the addressing helpers in opcodes.c are about to fetch.
+static bool
+operand_crosses_page (const CPU *cpu, AddressingMode mode)
+{
+  Word base;
+  Byte index;
+
+  switch (mode)
+    {
+    case MODE_ABX:
+    case MODE_ABY:
+      base = get_word_address (cpu->Memory[cpu->PC],
+                               cpu->Memory[(Word)(cpu->PC + 1)]);
+      index = mode == MODE_ABX ? cpu->X : cpu->Y;
+      break;
+    case MODE_IDY:
+      {
+        Byte pointer = cpu->Memory[cpu->PC];
+        base = get_word_address (cpu->Memory[pointer],
+                                 cpu->Memory[(pointer + 1) & 0xFF]);
+        index = cpu->Y;
+        break;
+      }
+    default:
+      return false;
+    }
+
+  return (base & 0xFF00) != ((Word)(base + index) & 0xFF00);
+}
+
+static void
+profile_instruction (CPU *cpu, Sint32 *cycles, Byte opcode)
+{
+  OpcodeFunction handler = opcode_table[opcode];
+  if (handler == NULL)
+    {
+      printf ("Operation not handled");
+      return;
+    }
+
+  OpcodeCounters *counters = &cpu->profile->opcodes[opcode];
+  AddressingMode mode = opcode_info[opcode].mode;
+
+  // The core decodes the multi-byte NOPs as single-byte NOPs, so there is no
+  // operand to index.
+  bool crossed = handler != ins_nop && operand_crosses_page (cpu, mode);
+  Sint32 before = *cycles;
+
+  handler (cpu, cycles);
+
+  if (mode == MODE_REL)
+    {
+      // Not taken: operand fetch only.  Taken: +1, page crossed: +1 more.
+      Sint32 spent = *cycles - before;
+      counters->branchesTaken += spent >= 2;
+      crossed = spent >= 3;
+    }
+
+  // execute() starts each instruction's count at zero, so *cycles is the
+  // whole instruction including the opcode fetch.
+  Sint32 bucket = *cycles < PROFILE_CYCLE_BUCKETS ? *cycles
+                                                  : PROFILE_CYCLE_BUCKETS - 1;
+  counters->executions++;
+  counters->cycles += *cycles;
+  counters->pageCrossings += crossed;
+  counters->cycleHistogram[bucket]++;
+}
+
+// One wrapper per opcode so the instrumented table has the same shape as the
+// plain one and execute() needs no special case.
+#define PROFILED(op)                                                          \
+  static void profiled_##op (CPU *cpu, Sint32 *cycles)                       \
+  {                                                                           \
+    profile_instruction (cpu, cycles, 0x##op);                                \
+  }
+
+#define PROFILED_ROW(hi)                                                      \
+  PROFILED (hi##0)                                                            \
+  PROFILED (hi##1)                                                            \
+  PROFILED (hi##2)                                                            \
+  PROFILED (hi##3)                                                            \
+  PROFILED (hi##4)                                                            \
+  PROFILED (hi##5)                                                            \
+  PROFILED (hi##6)                                                            \
+  PROFILED (hi##7)                                                            \
+  PROFILED (hi##8)                                                            \
+  PROFILED (hi##9)                                                            \
+  PROFILED (hi##A)                                                            \
+  PROFILED (hi##B)                                                            \
+  PROFILED (hi##C)                                                            \
+  PROFILED (hi##D)                                                            \
+  PROFILED (hi##E)                                                            \
+  PROFILED (hi##F)
+
+PROFILED_ROW (0)
+PROFILED_ROW (1)
+PROFILED_ROW (2)
+PROFILED_ROW (3)
+PROFILED_ROW (4)
+PROFILED_ROW (5)
+PROFILED_ROW (6)
+PROFILED_ROW (7)
+PROFILED_ROW (8)
+PROFILED_ROW (9)
+PROFILED_ROW (A)
+PROFILED_ROW (B)
+PROFILED_ROW (C)
+PROFILED_ROW (D)
+PROFILED_ROW (E)
+PROFILED_ROW (F)
+
+#define PROFILED_ENTRIES(hi)                                                  \
+  profiled_##hi##0, profiled_##hi##1, profiled_##hi##2, profiled_##hi##3,     \
+      profiled_##hi##4, profiled_##hi##5, profiled_##hi##6, profiled_##hi##7, \
+      profiled_##hi##8, profiled_##hi##9, profiled_##hi##A, profiled_##hi##B, \
+      profiled_##hi##C, profiled_##hi##D, profiled_##hi##E, profiled_##hi##F
+
+static const OpcodeFunction profiled_table[256] = {
+  PROFILED_ENTRIES (0), PROFILED_ENTRIES (1), PROFILED_ENTRIES (2),
+  PROFILED_ENTRIES (3), PROFILED_ENTRIES (4), PROFILED_ENTRIES (5),
+  PROFILED_ENTRIES (6), PROFILED_ENTRIES (7), PROFILED_ENTRIES (8),
+  PROFILED_ENTRIES (9), PROFILED_ENTRIES (A), PROFILED_ENTRIES (B),
+  PROFILED_ENTRIES (C), PROFILED_ENTRIES (D), PROFILED_ENTRIES (E),
+  PROFILED_ENTRIES (F)
+};
+
+void
+profile_attach (CPU *cpu, OpcodeProfile *profile)
+{
+  cpu->profile = profile;
+  cpu->dispatch = profiled_table;
+}
+
+void
+profile_detach (CPU *cpu)
+{
+  cpu->dispatch = opcode_table;
+  cpu->profile = NULL;
+}
+
+void
+profile_clear (OpcodeProfile *profile)
+{
+  memset (profile, 0, sizeof (*profile));
+}
+
+void
+profile_merge (OpcodeProfile *into, const OpcodeProfile *from)
+{
+  for (int op = 0; op < 256; op++)
+    {
+      OpcodeCounters *to = &into->opcodes[op];
+      const OpcodeCounters *add = &from->opcodes[op];
+
+      to->executions += add->executions;
+      to->cycles += add->cycles;
+      to->pageCrossings += add->pageCrossings;
+      to->branchesTaken += add->branchesTaken;
+      for (int b = 0; b < PROFILE_CYCLE_BUCKETS; b++)
+        {
+          to->cycleHistogram[b] += add->cycleHistogram[b];
+        }
+    }
+}
+
+Uint64
+profile_total_executions (const OpcodeProfile *profile)
+{
+  Uint64 total = 0;
+  for (int op = 0; op < 256; op++)
+    {
+      total += profile->opcodes[op].executions;
+    }
+  return total;
+}
+
+Uint64
+profile_total_cycles (const OpcodeProfile *profile)
+{
+  Uint64 total = 0;
+  for (int op = 0; op < 256; op++)
+    {
+      total += profile->opcodes[op].cycles;
+    }
+  return total;
+}
+
+bool
+profile_write_csv (const OpcodeProfile *profile, FILE *file)
+{
+  fprintf (file, "opcode,mnemonic,mode,executions,cycles,page_crossings,"
+                 "branches_taken");
+  for (int b = 0; b < PROFILE_CYCLE_BUCKETS; b++)
+    {
+      fprintf (file, ",cycles_%d", b);
+    }
+  fprintf (file, "\n");
+
+  for (int op = 0; op < 256; op++)
+    {
+      const OpcodeCounters *c = &profile->opcodes[op];
+      if (c->executions == 0)
+        {
+          continue;
+        }
+
+      fprintf (file, "%02X,%s,%s,%llu,%llu,%llu,%llu", op,
+               opcode_info[op].mnemonic,
+               addressing_mode_name (opcode_info[op].mode),
+               (unsigned long long)c->executions,
+               (unsigned long long)c->cycles,
+               (unsigned long long)c->pageCrossings,
+               (unsigned long long)c->branchesTaken);
+      for (int b = 0; b < PROFILE_CYCLE_BUCKETS; b++)
+        {
+          fprintf (file, ",%llu", (unsigned long long)c->cycleHistogram[b]);
+        }
+      fprintf (file, "\n");
+    }
+
+  return ferror (file) == 0;
+}
+
+bool
+profile_write_json (const OpcodeProfile *profile, FILE *file)
+{
+  bool first = true;
+
+  fprintf (file, "{\n  \"executions\": %llu,\n  \"cycles\": %llu,\n"
+                 "  \"opcodes\": [\n",
+           (unsigned long long)profile_total_executions (profile),
+           (unsigned long long)profile_total_cycles (profile));
+
+  for (int op = 0; op < 256; op++)
+    {
+      const OpcodeCounters *c = &profile->opcodes[op];
+      if (c->executions == 0)
+        {
+          continue;
+        }
+
+      fprintf (file,
+               "%s    {\"opcode\": \"%02X\", \"mnemonic\": \"%s\", "
+               "\"mode\": \"%s\", \"executions\": %llu, \"cycles\": %llu, "
+               "\"page_crossings\": %llu, \"branches_taken\": %llu, "
+               "\"cycle_histogram\": [",
+               first ? "" : ",\n", op, opcode_info[op].mnemonic,
+               addressing_mode_name (opcode_info[op].mode),
+               (unsigned long long)c->executions,
+               (unsigned long long)c->cycles,
+               (unsigned long long)c->pageCrossings,
+               (unsigned long long)c->branchesTaken);
+      for (int b = 0; b < PROFILE_CYCLE_BUCKETS; b++)
+        {
+          fprintf (file, "%s%llu", b ? ", " : "",
+                   (unsigned long long)c->cycleHistogram[b]);
+        }
+      fprintf (file, "]}");
+      first = false;
+    }
+
+  fprintf (file, "\n  ]\n}\n");
+  return ferror (file) == 0;
+}
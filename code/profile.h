@@ -0,0 +1,64 @@
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* profile.h
+ * Per-opcode execution profile.  Attaching a profile swaps the CPU's dispatch
+ * table for an instrumented copy that wraps every handler; detaching swaps the
+ * plain table back, so an unprofiled CPU runs exactly the normal code path.
+ */
+#include "cpu.h"
+#include <stdio.h>
+
+// Instruction lengths in cycles are bucketed 0..7; the last bucket also
+// collects anything longer.
+#define PROFILE_CYCLE_BUCKETS 8
+
+typedef struct
+{
+  Uint64 executions;
+  Uint64 cycles;
+
+  // Indexed reads/writes (abs,X  abs,Y  (zp),Y) whose effective address
+  // landed on a different page than the base address.
+  Uint64 pageCrossings;
+
+  // Relative branches only: how many were taken.  Branch page crossings are
+  // counted in pageCrossings.
+  Uint64 branchesTaken;
+
+  Uint64 cycleHistogram[PROFILE_CYCLE_BUCKETS];
+} OpcodeCounters;
+
+struct OpcodeProfile
+{
+  OpcodeCounters opcodes[256];
+};
+
+// Starts counting into profile (which is not cleared) on this CPU only.
+void profile_attach (CPU *cpu, OpcodeProfile *profile);
+
+// Restores the plain dispatch table.
+void profile_detach (CPU *cpu);
+
+void profile_clear (OpcodeProfile *profile);
+
+// Adds every counter in from into into.  Profiles filled by different
+// threads are combined this way once the threads are done.
+void profile_merge (OpcodeProfile *into, const OpcodeProfile *from);
+
+Uint64 profile_total_executions (const OpcodeProfile *profile);
+Uint64 profile_total_cycles (const OpcodeProfile *profile);
+
+// Both writers emit one record per opcode that executed at least once.
+bool profile_write_csv (const OpcodeProfile *profile, FILE *file);
+bool profile_write_json (const OpcodeProfile *profile, FILE *file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
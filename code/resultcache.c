@@ -0,0 +1,265 @@
+#include "resultcache.h"
+#include "statehash.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef ACE64_BUILD_ID
+#define ACE64_BUILD_ID "unversioned " __DATE__ " " __TIME__
+#endif
+
+#define CACHE_MAGIC "ACE64RC1"
+#define LOCK_STRIPES 64 // Sets share locks by index
+
+typedef struct
+{
+  char magic[8];
+  Uint64 setCount;
+  _Atomic Uint64 clock; // Bumped on every hit and store
+} FileHeader;
+
+typedef struct
+{
+  Uint64 key[2];
+  Uint64 lastUsed;
+  Uint32 length;
+  _Atomic Uint32 check; // 0 while empty or being written
+  char payload[RESULTCACHE_MAX_PAYLOAD];
+} Slot;
+
+_Static_assert (sizeof (Slot) == RESULTCACHE_SLOT_SIZE, "slots fill a line");
+
+struct ResultCache
+{
+  Byte *map;
+  size_t mapSize;
+  FileHeader *header;
+  Slot *slots;
+  Uint64 setCount;
+  pthread_mutex_t locks[LOCK_STRIPES];
+};
+
+void
+resultcache_key_init (ResultKey *key)
+{
+  key->lanes[0] = 0x6A09E667F3BCC908ULL;
+  key->lanes[1] = 0xBB67AE8584CAA73BULL;
+  key->length = 0;
+}
+
+static void
+key_mix (ResultKey *key, Uint64 word)
+{
+  key->lanes[0] = statehash_mix (key->lanes[0] ^ word);
+  key->lanes[1] = statehash_mix (key->lanes[1] + word) ^ key->lanes[0];
+}
+
+void
+resultcache_key_add (ResultKey *key, const void *bytes, size_t length)
+{
+  const Byte *in = (const Byte *)bytes;
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8)
+    {
+      Uint64 word;
+      memcpy (&word, in + i, 8);
+      key_mix (key, word);
+    }
+
+  Uint64 tail = 0;
+  for (size_t shift = 0; i < length; i++, shift += 8)
+    {
+      tail |= (Uint64)in[i] << shift;
+    }
+  key->length += length;
+  key_mix (key, tail ^ key->length << 3);
+}
+
+const char *
+resultcache_build_id (void)
+{
+  return ACE64_BUILD_ID;
+}
+
+static Uint32
+slot_check (const Uint64 *key, const char *payload, Uint32 length)
+{
+  ResultKey sum;
+  resultcache_key_init (&sum);
+  resultcache_key_add (&sum, key, 2 * sizeof (Uint64));
+  resultcache_key_add (&sum, payload, length);
+  Uint32 check = (Uint32)sum.lanes[0];
+  return check != 0 ? check : 1;
+}
+
+ResultCache *
+resultcache_open (const char *path, size_t capacity)
+{
+  Uint64 setCount = capacity / (RESULTCACHE_SLOT_SIZE * RESULTCACHE_WAYS);
+  if (setCount == 0)
+    {
+      setCount = 1;
+    }
+  size_t mapSize = RESULTCACHE_SLOT_SIZE
+                   + setCount * RESULTCACHE_WAYS * RESULTCACHE_SLOT_SIZE;
+
+  ResultCache *cache = (ResultCache *)calloc (1, sizeof (ResultCache));
+  int fd = open (path, O_RDWR | O_CREAT, 0644);
+  if (cache == NULL || fd < 0)
+    {
+      free (cache);
+      if (fd >= 0)
+        close (fd);
+      return NULL;
+    }
+
+  // Only one process sets the file up; the lock goes with the descriptor.
+  flock (fd, LOCK_EX);
+  struct stat info;
+  bool fresh = fstat (fd, &info) != 0 || (size_t)info.st_size != mapSize;
+  if (fresh && (ftruncate (fd, 0) != 0 || ftruncate (fd, mapSize) != 0))
+    {
+      int saved = errno;
+      close (fd);
+      free (cache);
+      errno = saved;
+      return NULL;
+    }
+  void *map
+      = mmap (NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED)
+    {
+      int saved = errno;
+      close (fd);
+      free (cache);
+      errno = saved;
+      return NULL;
+    }
+
+  cache->map = (Byte *)map;
+  cache->mapSize = mapSize;
+  cache->header = (FileHeader *)map;
+  cache->slots = (Slot *)(cache->map + RESULTCACHE_SLOT_SIZE);
+  cache->setCount = setCount;
+  if (fresh || memcmp (cache->header->magic, CACHE_MAGIC, 8) != 0
+      || cache->header->setCount != setCount)
+    {
+      memset (map, 0, mapSize);
+      cache->header->setCount = setCount;
+      memcpy (cache->header->magic, CACHE_MAGIC, 8);
+    }
+  close (fd); // Also drops the lock; the mapping stays
+
+  for (int s = 0; s < LOCK_STRIPES; s++)
+    {
+      pthread_mutex_init (&cache->locks[s], NULL);
+    }
+  return cache;
+}
+
+void
+resultcache_close (ResultCache *cache)
+{
+  if (cache == NULL)
+    {
+      return;
+    }
+  munmap (cache->map, cache->mapSize);
+  for (int s = 0; s < LOCK_STRIPES; s++)
+    {
+      pthread_mutex_destroy (&cache->locks[s]);
+    }
+  free (cache);
+}
+
+static Slot *
+find_set (ResultCache *cache, const ResultKey *key, pthread_mutex_t **lock)
+{
+  Uint64 set = key->lanes[0] % cache->setCount;
+  *lock = &cache->locks[set % LOCK_STRIPES];
+  return &cache->slots[set * RESULTCACHE_WAYS];
+}
+
+long
+resultcache_lookup (ResultCache *cache, const ResultKey *key,
+                    char *payload, size_t size)
+{
+  pthread_mutex_t *lock;
+  Slot *set = find_set (cache, key, &lock);
+  long found = -1;
+
+  pthread_mutex_lock (lock);
+  for (int way = 0; way < RESULTCACHE_WAYS && found < 0; way++)
+    {
+      Slot *slot = &set[way];
+      Uint32 check = atomic_load (&slot->check);
+      Uint32 length = slot->length;
+      if (check == 0 || slot->key[0] != key->lanes[0]
+          || slot->key[1] != key->lanes[1] || length > size
+          || length > RESULTCACHE_MAX_PAYLOAD)
+        {
+          continue;
+        }
+
+      memcpy (payload, slot->payload, length);
+      if (slot_check (slot->key, payload, length) == check
+          && atomic_load (&slot->check) == check)
+        {
+          slot->lastUsed = atomic_fetch_add (&cache->header->clock, 1) + 1;
+          found = length;
+        }
+    }
+  pthread_mutex_unlock (lock);
+  return found;
+}
+
+bool
+resultcache_store (ResultCache *cache, const ResultKey *key,
+                   const char *payload, size_t length)
+{
+  if (length > RESULTCACHE_MAX_PAYLOAD)
+    {
+      return false;
+    }
+
+  pthread_mutex_t *lock;
+  Slot *set = find_set (cache, key, &lock);
+  pthread_mutex_lock (lock);
+
+  // The slot already holding the key, else an empty one, else the LRU one.
+  Slot *victim = &set[0];
+  for (int way = 0; way < RESULTCACHE_WAYS; way++)
+    {
+      Slot *slot = &set[way];
+      if (slot->key[0] == key->lanes[0] && slot->key[1] == key->lanes[1])
+        {
+          victim = slot;
+          break;
+        }
+      if (atomic_load (&victim->check) != 0
+          && (atomic_load (&slot->check) == 0
+              || slot->lastUsed < victim->lastUsed))
+        {
+          victim = slot;
+        }
+    }
+
+  atomic_store (&victim->check, 0);
+  victim->key[0] = key->lanes[0];
+  victim->key[1] = key->lanes[1];
+  victim->length = (Uint32)length;
+  memcpy (victim->payload, payload, length);
+  victim->lastUsed = atomic_fetch_add (&cache->header->clock, 1) + 1;
+  atomic_store (&victim->check,
+                slot_check (victim->key, payload, (Uint32)length));
+
+  pthread_mutex_unlock (lock);
+  return true;
+}
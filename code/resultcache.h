@@ -0,0 +1,66 @@
+#ifndef RESULTCACHE_H_
+#define RESULTCACHE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* resultcache.h
+ * On-disk cache of run results, keyed by a 128-bit content hash.  The core
+ * is deterministic, so a job whose image, initial state, stop conditions
+ * and emulator build all hash alike has the same result; the batch runner
+ * (batch.h) looks it up before running and stores it after.
+ *
+ * The store is a file of fixed-size slots mapped into memory and shared by
+ * every process that opens it.  A key hashes to a set of
+ * RESULTCACHE_WAYS slots; a store fills an empty slot of the set or
+ * replaces its least recently used one, so the file never grows past the
+ * capacity it was created with.  Threads of one process lock the set;
+ * processes do not lock each other out, but every slot carries a checksum
+ * that is written last, so a slot caught half-written reads as a miss.
+ *
+ * resultcache_build_id() names the emulator build and belongs in every
+ * key.  CMake sets it to a digest of the core sources, so cached results
+ * never outlive a change to the emulator.
+ */
+#include "cpu.h"
+#include <stddef.h>
+
+#define RESULTCACHE_SLOT_SIZE 512
+#define RESULTCACHE_WAYS 8
+#define RESULTCACHE_MAX_PAYLOAD (RESULTCACHE_SLOT_SIZE - 32)
+
+typedef struct ResultCache ResultCache;
+
+typedef struct
+{
+  Uint64 lanes[2];
+  Uint64 length;
+} ResultKey;
+
+void resultcache_key_init (ResultKey *key);
+void resultcache_key_add (ResultKey *key, const void *bytes, size_t length);
+
+const char *resultcache_build_id (void);
+
+// Opens the cache file at path, creating it with room for about capacity
+// bytes of slots.  An existing file of another capacity, or one that is not
+// a cache, is emptied and resized.  Returns NULL with errno set on failure.
+ResultCache *resultcache_open (const char *path, size_t capacity);
+void resultcache_close (ResultCache *cache);
+
+// Copies the payload cached under key into payload (at most size bytes) and
+// returns its length, or returns -1 on a miss.
+long resultcache_lookup (ResultCache *cache, const ResultKey *key,
+                         char *payload, size_t size);
+
+// Caches length bytes of payload under key.  Payloads longer than
+// RESULTCACHE_MAX_PAYLOAD are not cached; returns false for them.
+bool resultcache_store (ResultCache *cache, const ResultKey *key,
+                        const char *payload, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,189 @@
+#include "run.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ACE64_HOSTCALL
+#include "hostcall.h"
+#endif
+
+// Opcode table flags
+#define STOP_BRK 1
+#define STOP_ILLEGAL 2
+
+void
+run_stops_init (RunStops *stops)
+{
+  stops->brk = true;
+  stops->selfLoop = true;
+  stops->illegal = true;
+  stops->maxCycles = 0;
+  stops->maxInstructions = 0;
+  breakpoints_init (&stops->breakpoints);
+  stops->watching = false;
+  stops->resumeArmed = false;
+  stops->resumePC = 0;
+}
+
+bool
+run_stop_at (RunStops *stops, Word address)
+{
+  return breakpoints_add (&stops->breakpoints, BREAK_EXECUTE, address,
+                          address, NULL)
+         > 0;
+}
+
+bool
+run_stop_on_write (RunStops *stops, Word address)
+{
+  if (breakpoints_add (&stops->breakpoints, BREAK_WRITE, address, address,
+                       NULL)
+      < 0)
+    {
+      return false;
+    }
+  stops->watching = true;
+  return true;
+}
+
+static void
+build_opcode_stops (const CPU *cpu, const RunStops *stops, Byte *opcodes)
+{
+  for (int opcode = 0; opcode < 256; opcode++)
+    {
+      opcodes[opcode] = stops->illegal && !is_opcode_implemented (opcode)
+                            ? STOP_ILLEGAL
+                            : 0;
+    }
+#ifdef ACE64_HOSTCALL
+  if (cpu->hostcalls != NULL)
+    {
+      opcodes[cpu->hostcalls->opcode] = 0;
+    }
+#endif
+  if (stops->brk)
+    {
+      opcodes[INS_BRK] = STOP_BRK;
+    }
+}
+
+// Whether an instruction that left PC unchanged jumped to itself.  Native
+// loop runs and traps can also end where they began, at an instruction
+// that is neither a JMP nor a branch.
+static bool
+jumped_to_itself (const CPU *cpu, Word pc, Byte opcode)
+{
+  if (opcode == INS_JMP_ABS || opcode == INS_JMP_IND)
+    {
+      return true;
+    }
+  return (opcode & 0x1F) == 0x10 && cpu->Memory[(Word)(pc + 1)] == 0xFE;
+}
+
+static bool
+has_stop_addresses (const Breakpoints *breakpoints)
+{
+  for (int i = 0; i < breakpoints->count; i++)
+    {
+      if (breakpoints->entries[i].kind == BREAK_EXECUTE)
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
+RunExit
+run_until (CPU *cpu, RunStops *stops)
+{
+  RunExit result = { RUN_EXIT_NONE };
+  Breakpoints *breakpoints = &stops->breakpoints;
+  const Uint64 *stopBits = breakpoints->bits[BREAK_EXECUTE];
+  Uint64 maxCycles = stops->maxCycles != 0 ? stops->maxCycles : UINT64_MAX;
+  Uint64 maxInstructions
+      = stops->maxInstructions != 0 ? stops->maxInstructions : UINT64_MAX;
+  Byte opcodes[256];
+  build_opcode_stops (cpu, stops, opcodes);
+
+  breakpoints->hit.triggered = false;
+#ifdef ACE64_WATCHPOINTS
+  cpu->breakpoints = stops->watching ? breakpoints : NULL;
+#endif
+  cpu->stepping
+      = stops->maxInstructions != 0 || has_stop_addresses (breakpoints);
+  bool resume = stops->resumeArmed && stops->resumePC == cpu->PC;
+  stops->resumeArmed = false;
+
+  for (;;)
+    {
+      Word pc = cpu->PC;
+      Byte opcode = cpu->Memory[pc];
+      if ((opcodes[opcode] != 0 || breakpoints_test (stopBits, pc))
+          && !resume)
+        {
+          result.reason = breakpoints_test (stopBits, pc) ? RUN_EXIT_PC
+                        : opcodes[opcode] == STOP_BRK  ? RUN_EXIT_BRK
+                                                       : RUN_EXIT_ILLEGAL;
+          result.address = pc;
+          result.value = opcode;
+          stops->resumeArmed = true;
+          stops->resumePC = pc;
+          break;
+        }
+      resume = false;
+
+      breakpoints->instructionPC = pc;
+      result.cycles += execute (cpu);
+      result.instructions++;
+
+#ifdef ACE64_HOSTCALL
+      if (cpu->hostcalls != NULL && cpu->hostcalls->exited)
+        {
+          result.reason = RUN_EXIT_HOST;
+          result.address = pc;
+          result.value = cpu->hostcalls->status;
+          break;
+        }
+#endif
+      if (breakpoints->hit.triggered)
+        {
+          result.reason = RUN_EXIT_WRITE;
+          result.address = breakpoints->hit.address;
+          result.value = breakpoints->hit.value;
+          break;
+        }
+      if (cpu->PC == pc && stops->selfLoop
+          && jumped_to_itself (cpu, pc, opcode))
+        {
+          result.reason = RUN_EXIT_SELF_LOOP;
+          result.address = pc;
+          break;
+        }
+      if (result.cycles >= maxCycles)
+        {
+          result.reason = RUN_EXIT_CYCLES;
+          break;
+        }
+      if (result.instructions >= maxInstructions)
+        {
+          result.reason = RUN_EXIT_INSTRUCTIONS;
+          break;
+        }
+    }
+
+#ifdef ACE64_WATCHPOINTS
+  cpu->breakpoints = NULL;
+#endif
+  cpu->stepping = false;
+  result.pc = cpu->PC;
+  return result;
+}
+
+const char *
+run_exit_name (RunExitReason reason)
+{
+  static const char *names[RUN_EXIT_REASONS] = {
+    "none",      "brk",          "pc",      "write", "self-loop",
+    "cycles",    "instructions", "illegal", "host",
+  };
+  return reason < RUN_EXIT_REASONS ? names[reason] : "unknown";
+}
@@ -0,0 +1,89 @@
+#ifndef RUN_H_
+#define RUN_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* run.h
+ * Headless runs with configurable stop conditions.  run_until() executes
+ * until one of them holds and says which, where and after how much work.
+ *
+ * The conditions cost next to nothing per instruction: stop addresses are
+ * execute bits in a Breakpoints bitmap, BRK and unimplemented opcodes are
+ * flags in a 256-entry opcode table, both looked up before the instruction;
+ * afterwards, a self-loop (JMP *, or a branch to itself) is a JMP or branch
+ * that left PC unchanged, and the limits are two compares.  Sentinel
+ * writes are write watchpoints, so they need the ACE64_WATCHPOINTS hooks;
+ * with ACE64_HOSTCALL, a host call EXIT stops the run too.
+ *
+ * A run that stopped before an instruction (a stop address, BRK or an
+ * unimplemented opcode) executes that instruction when it is continued.
+ *
+ * Replayed calls (memo.h), native loops (loops.h) and traps (hle.h) run
+ * many instructions in one execute().  While stop addresses or an
+ * instruction limit are set, run_until() turns all three off, so stops
+ * inside a loop body or a callee are reached and instructions are counted
+ * exactly; a trapped routine then runs from ROM, which must be loaded.
+ * Otherwise each of them counts as one instruction, and the cycle limit
+ * may be passed by a whole call or loop.
+ */
+#include "breakpoints.h"
+#include "cpu.h"
+
+typedef enum
+{
+  RUN_EXIT_NONE,
+  RUN_EXIT_BRK,          // Before a BRK
+  RUN_EXIT_PC,           // Before the instruction at a stop address
+  RUN_EXIT_WRITE,        // After an instruction wrote a sentinel address
+  RUN_EXIT_SELF_LOOP,    // After an instruction that left PC unchanged
+  RUN_EXIT_CYCLES,       // The cycle limit was reached
+  RUN_EXIT_INSTRUCTIONS, // The instruction limit was reached
+  RUN_EXIT_ILLEGAL,      // Before an opcode the core does not implement
+  RUN_EXIT_HOST,         // A host call EXIT
+  RUN_EXIT_REASONS
+} RunExitReason;
+
+typedef struct
+{
+  RunExitReason reason;
+  Word pc;      // PC when the run stopped
+  Word address; // The stop, sentinel or self-loop address
+  Byte value;   // The opcode, the byte written, or the EXIT status
+  Uint64 instructions;
+  Uint64 cycles;
+} RunExit;
+
+typedef struct
+{
+  bool brk;
+  bool selfLoop;
+  bool illegal;
+  Uint64 maxCycles;       // 0 for no limit
+  Uint64 maxInstructions; // 0 for no limit
+  Breakpoints breakpoints; // Stop addresses and sentinels
+
+  // Run state kept by run_until().
+  bool watching;
+  bool resumeArmed;
+  Word resumePC;
+} RunStops;
+
+// Stops on BRK, self-loops and unimplemented opcodes, with no limits.
+void run_stops_init (RunStops *stops);
+
+// Returns false if the stop set is full, or, for sentinels, in a build
+// without ACE64_WATCHPOINTS.
+bool run_stop_at (RunStops *stops, Word address);
+bool run_stop_on_write (RunStops *stops, Word address);
+
+RunExit run_until (CPU *cpu, RunStops *stops);
+
+const char *run_exit_name (RunExitReason reason);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
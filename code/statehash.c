@@ -0,0 +1,168 @@
+#include "statehash.h"
+#include <stdlib.h>
+#include <string.h>
+
+static Uint64
+hash_memory (const CPU *cpu)
+{
+  Uint64 hash = 0;
+  for (Uint32 address = 0; address < MAX_MEMORY; address++)
+    {
+      hash ^= statehash_key ((Word)address, cpu->Memory[address]);
+    }
+  return hash;
+}
+
+#ifdef ACE64_STATE_HASH
+void
+statehash_attach (CPU *cpu, StateHash *hash)
+{
+  if (hash != NULL)
+    {
+      hash->memory = hash_memory (cpu);
+    }
+  cpu->stateHash = hash;
+}
+#endif
+
+Uint64
+statehash_compute (const CPU *cpu)
+{
+  return hash_memory (cpu) ^ statehash_registers (cpu);
+}
+
+Uint64
+statehash_value (const CPU *cpu)
+{
+#ifdef ACE64_STATE_HASH
+  if (cpu->stateHash != NULL)
+    {
+      return cpu->stateHash->memory ^ statehash_registers (cpu);
+    }
+#endif
+  return statehash_compute (cpu);
+}
+
+void
+statehash_poke (CPU *cpu, Word address, Byte value)
+{
+#ifdef ACE64_STATE_HASH
+  if (cpu->stateHash != NULL)
+    {
+      statehash_update (cpu->stateHash, address, cpu->Memory[address], value);
+    }
+#endif
+  cpu->Memory[address] = value;
+}
+
+bool
+stateset_init (StateSet *set, size_t capacity)
+{
+  size_t size = 16;
+  while (size < capacity * 2)
+    {
+      size *= 2;
+    }
+
+  set->slots = (Uint64 *)calloc (size, sizeof (Uint64));
+  set->capacity = set->slots != NULL ? size : 0;
+  set->count = 0;
+  set->hasZero = false;
+  return set->slots != NULL;
+}
+
+void
+stateset_free (StateSet *set)
+{
+  free (set->slots);
+  set->slots = NULL;
+  set->capacity = 0;
+  set->count = 0;
+  set->hasZero = false;
+}
+
+void
+stateset_clear (StateSet *set)
+{
+  if (set->slots != NULL)
+    {
+      memset (set->slots, 0, set->capacity * sizeof (Uint64));
+    }
+  set->count = 0;
+  set->hasZero = false;
+}
+
+// The slot holding hash, or the empty slot where it belongs.
+static Uint64 *
+find_slot (Uint64 *slots, size_t capacity, Uint64 hash)
+{
+  size_t mask = capacity - 1;
+  size_t slot = (size_t)(hash ^ (hash >> 32)) & mask;
+  while (slots[slot] != 0 && slots[slot] != hash)
+    {
+      slot = (slot + 1) & mask;
+    }
+  return &slots[slot];
+}
+
+static bool
+grow (StateSet *set)
+{
+  size_t capacity = set->capacity != 0 ? set->capacity * 2 : 16;
+  Uint64 *slots = (Uint64 *)calloc (capacity, sizeof (Uint64));
+  if (slots == NULL)
+    {
+      return false;
+    }
+
+  for (size_t i = 0; i < set->capacity; i++)
+    {
+      if (set->slots[i] != 0)
+        {
+          *find_slot (slots, capacity, set->slots[i]) = set->slots[i];
+        }
+    }
+  free (set->slots);
+  set->slots = slots;
+  set->capacity = capacity;
+  return true;
+}
+
+bool
+stateset_contains (const StateSet *set, Uint64 hash)
+{
+  if (hash == 0)
+    {
+      return set->hasZero;
+    }
+  if (set->capacity == 0)
+    {
+      return false;
+    }
+  return *find_slot (set->slots, set->capacity, hash) == hash;
+}
+
+int
+stateset_insert (StateSet *set, Uint64 hash)
+{
+  if (hash == 0)
+    {
+      bool added = !set->hasZero;
+      set->hasZero = true;
+      return added ? 1 : 0;
+    }
+
+  if ((set->count + 1) * 2 > set->capacity && !grow (set))
+    {
+      return -1;
+    }
+
+  Uint64 *slot = find_slot (set->slots, set->capacity, hash);
+  if (*slot == hash)
+    {
+      return 0;
+    }
+  *slot = hash;
+  set->count++;
+  return 1;
+}
@@ -0,0 +1,109 @@
+#ifndef STATEHASH_H_
+#define STATEHASH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* statehash.h
+ * 64-bit whole-machine state hash in the style of Zobrist hashing: the hash
+ * is the XOR of one pseudo-random key per (address, value) pair and per
+ * register value, so a write only has to XOR out the key of the old byte
+ * and XOR in the key of the new one.  The keys are computed by a 64-bit
+ * mixer rather than looked up, which keeps 64K x 256 keys out of memory and
+ * makes hashes identical across processes and runs.
+ *
+ * With ACE64_STATE_HASH defined (cmake -DACE64_STATE_HASH=ON) write_byte
+ * and write_word keep the memory part of an attached StateHash current, and
+ * statehash_value() is O(1): the registers are folded in when it is read.
+ * Without it statehash_value() hashes all of memory each time.
+ *
+ * Memory changed behind the core's back (loaders, debuggers) must go
+ * through statehash_poke(), or be followed by another statehash_attach().
+ */
+#include "cpu.h"
+#include <stddef.h>
+
+struct StateHash
+{
+  Uint64 memory; // XOR of statehash_key() over every address
+};
+
+static inline Uint64
+statehash_mix (Uint64 x)
+{
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+static inline Uint64
+statehash_key (Word address, Byte value)
+{
+  return statehash_mix ((Uint64)address << 8 | value);
+}
+
+// Keys for the registers live above the 64K addresses.
+static inline Uint64
+statehash_registers (const CPU *cpu)
+{
+  const Uint64 base = (Uint64)MAX_MEMORY << 8;
+  return statehash_mix (base | cpu->A)
+         ^ statehash_mix ((base + 0x100) | cpu->X)
+         ^ statehash_mix ((base + 0x200) | cpu->Y)
+         ^ statehash_mix ((base + 0x300) | cpu->P)
+         ^ statehash_mix ((base + 0x400) | cpu->SP)
+         ^ statehash_mix ((base + 0x500) | (cpu->PC & 0xFF))
+         ^ statehash_mix ((base + 0x600) | (cpu->PC >> 8));
+}
+
+static inline void
+statehash_update (StateHash *hash, Word address, Byte oldValue,
+                  Byte newValue)
+{
+  hash->memory ^= statehash_key (address, oldValue)
+                  ^ statehash_key (address, newValue);
+}
+
+#ifdef ACE64_STATE_HASH
+// Hashes the CPU's current memory into hash and keeps it current from then
+// on; NULL stops.
+void statehash_attach (CPU *cpu, StateHash *hash);
+#endif
+
+// Hashes memory and registers from scratch.
+Uint64 statehash_compute (const CPU *cpu);
+
+// The state hash: O(1) if a StateHash is attached, statehash_compute()
+// otherwise.
+Uint64 statehash_value (const CPU *cpu);
+
+// Stores value at address outside of execution, keeping an attached hash
+// current.
+void statehash_poke (CPU *cpu, Word address, Byte value);
+
+/* Visited set of state hashes: open addressing, doubled when half full. */
+typedef struct StateSet
+{
+  Uint64 *slots; // 0 marks an empty slot
+  size_t capacity;
+  size_t count;
+  bool hasZero; // The hash 0 is kept out of the table
+} StateSet;
+
+// Returns false if memory could not be allocated.
+bool stateset_init (StateSet *set, size_t capacity);
+void stateset_free (StateSet *set);
+void stateset_clear (StateSet *set);
+bool stateset_contains (const StateSet *set, Uint64 hash);
+
+// Adds hash.  Returns 1 if it was new, 0 if it was already present, and -1
+// if the table could not grow.
+int stateset_insert (StateSet *set, Uint64 hash);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
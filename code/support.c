@@ -0,0 +1,77 @@
+#include "support.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+bool
+support_parse_address (const char *text, Word *address)
+{
+  char *end;
+  if (*text == '$')
+    {
+      text++;
+    }
+
+  long value = strtol (text, &end, 16);
+  if (*text == '\0' || *end != '\0' || value < 0 || value > 0xFFFF)
+    {
+      return false;
+    }
+
+  *address = (Word)value;
+  return true;
+}
+
+long
+support_load_image (CPU *cpu, const char *path, Word loadAddress, bool prg)
+{
+  FILE *file = fopen (path, "rb");
+  if (file == NULL)
+    {
+      perror (path);
+      return -1;
+    }
+
+  if (prg)
+    {
+      int lo = fgetc (file);
+      int hi = fgetc (file);
+      if (lo == EOF || hi == EOF)
+        {
+          fprintf (stderr, "%s: no load address\n", path);
+          fclose (file);
+          return -1;
+        }
+      loadAddress = get_word_address (lo, hi);
+    }
+  size_t room = MAX_MEMORY - loadAddress;
+  size_t bytesRead = fread (&cpu->Memory[loadAddress], 1, room, file);
+  fclose (file);
+
+  if (bytesRead == 0)
+    {
+      fprintf (stderr, "%s: empty image\n", path);
+      return -1;
+    }
+  return loadAddress;
+}
+
+double
+support_now_seconds (void)
+{
+  struct timespec now;
+  clock_gettime (CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+int
+support_thread_count (int threads)
+{
+  if (threads > 0)
+    {
+      return threads;
+    }
+  long online = sysconf (_SC_NPROCESSORS_ONLN);
+  return online > 0 ? (int)online : 1;
+}
@@ -0,0 +1,34 @@
+#ifndef SUPPORT_H_
+#define SUPPORT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* support.h
+ * Helpers shared by the front ends, the benchmarks and the threaded
+ * runners: hexadecimal addresses as given on command lines, loading a raw
+ * or PRG image from a file, a monotonic clock and the default thread count.
+ */
+#include "cpu.h"
+
+// Parses "hhhh" or "$hhhh", up to $FFFF.
+bool support_parse_address (const char *text, Word *address);
+
+// Loads the file at path into memory at loadAddress, or, for a PRG, at the
+// address in its first two bytes.  Returns the load address, or -1 after
+// reporting the error on stderr.
+long support_load_image (CPU *cpu, const char *path, Word loadAddress,
+                         bool prg);
+
+// Seconds on the monotonic clock.
+double support_now_seconds (void);
+
+// threads if it is positive, otherwise one per online processor.
+int support_thread_count (int threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
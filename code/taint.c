@@ -0,0 +1,145 @@
+#include "taint.h"
+#include "opinfo.h"
+#include <string.h>
+
+typedef struct
+{
+  const char *mnemonic;
+  Word rule;
+} TaintMnemonic;
+
+#define TO(destination) ((Word)(TAINT_TO_##destination << TAINT_TO_SHIFT))
+
+// Instructions not listed move no tags between registers; any memory they
+// write still receives the tags of what they read.
+static const TaintMnemonic taint_mnemonics[] = {
+  { "LDA", TO (A) | TAINT_SETS_FLAGS },
+  { "LDX", TO (X) | TAINT_SETS_FLAGS },
+  { "LDY", TO (Y) | TAINT_SETS_FLAGS },
+  { "LAX", TO (AX) | TAINT_SETS_FLAGS },
+  { "STA", TAINT_FROM_A },
+  { "STX", TAINT_FROM_X },
+  { "STY", TAINT_FROM_Y },
+  { "ADC", TAINT_FROM_A | TAINT_FROM_P | TO (A) | TAINT_SETS_FLAGS },
+  { "SBC", TAINT_FROM_A | TAINT_FROM_P | TO (A) | TAINT_SETS_FLAGS },
+  { "AND", TAINT_FROM_A | TO (A) | TAINT_SETS_FLAGS },
+  { "ORA", TAINT_FROM_A | TO (A) | TAINT_SETS_FLAGS },
+  { "EOR", TAINT_FROM_A | TO (A) | TAINT_SETS_FLAGS },
+  { "CMP", TAINT_FROM_A | TAINT_SETS_FLAGS },
+  { "CPX", TAINT_FROM_X | TAINT_SETS_FLAGS },
+  { "CPY", TAINT_FROM_Y | TAINT_SETS_FLAGS },
+  { "BIT", TAINT_SETS_FLAGS },
+  { "ASL", TAINT_SETS_FLAGS },
+  { "LSR", TAINT_SETS_FLAGS },
+  { "ROL", TAINT_FROM_P | TAINT_SETS_FLAGS },
+  { "ROR", TAINT_FROM_P | TAINT_SETS_FLAGS },
+  { "INC", TAINT_SETS_FLAGS },
+  { "DEC", TAINT_SETS_FLAGS },
+  { "INX", TAINT_FROM_X | TO (X) | TAINT_SETS_FLAGS },
+  { "DEX", TAINT_FROM_X | TO (X) | TAINT_SETS_FLAGS },
+  { "INY", TAINT_FROM_Y | TO (Y) | TAINT_SETS_FLAGS },
+  { "DEY", TAINT_FROM_Y | TO (Y) | TAINT_SETS_FLAGS },
+  { "TAX", TAINT_FROM_A | TO (X) | TAINT_SETS_FLAGS },
+  { "TAY", TAINT_FROM_A | TO (Y) | TAINT_SETS_FLAGS },
+  { "TXA", TAINT_FROM_X | TO (A) | TAINT_SETS_FLAGS },
+  { "TYA", TAINT_FROM_Y | TO (A) | TAINT_SETS_FLAGS },
+  { "TSX", TAINT_FROM_SP | TO (X) | TAINT_SETS_FLAGS },
+  { "TXS", TAINT_FROM_X | TO (SP) },
+  { "PHA", TAINT_FROM_A },
+  { "PHP", TAINT_FROM_P },
+  { "PLA", TO (A) | TAINT_SETS_FLAGS },
+  { "PLP", TO (P) },
+  { "BRK", TAINT_FROM_P },
+  { "RTS", TO (PC) },
+  { "RTI", TO (PC) | TAINT_SETS_FLAGS },
+};
+
+static Word
+taint_build_rule (Byte opcode)
+{
+  const OpcodeInfo *info = &opcode_info[opcode];
+  if (opcode_table[opcode] == NULL)
+    {
+      return 0;
+    }
+  if (strcmp (info->mnemonic, "JMP") == 0)
+    {
+      return info->mode == MODE_IND ? TO (PC) : 0;
+    }
+
+  for (size_t i = 0; i < sizeof (taint_mnemonics) / sizeof (*taint_mnemonics);
+       i++)
+    {
+      if (strcmp (info->mnemonic, taint_mnemonics[i].mnemonic) == 0)
+        {
+          Word rule = taint_mnemonics[i].rule;
+          if (info->mode == MODE_ACC)
+            {
+              rule |= TAINT_FROM_A | TO (A); // Shifts of A
+            }
+          else if (info->mode == MODE_IMM
+                   && strcmp (info->mnemonic, "LAX") == 0)
+            {
+              rule |= TAINT_FROM_A; // (A | magic) & immediate
+            }
+          return rule;
+        }
+    }
+  return 0;
+}
+
+void
+taint_reset (CPU *cpu)
+{
+  taint_clear (cpu);
+  for (int opcode = 0; opcode < 256; opcode++)
+    {
+      cpu->taint.rules[opcode] = taint_build_rule ((Byte)opcode);
+    }
+}
+
+void
+taint_clear (CPU *cpu)
+{
+  TaintState *taint = &cpu->taint;
+  memset (taint->memory, 0, sizeof (taint->memory));
+  memset (taint->sources, 0, sizeof (taint->sources));
+  taint->a = taint->x = taint->y = taint->p = taint->sp = 0;
+  taint->pc = 0;
+  taint->current = 0;
+}
+
+void
+taint_mark (CPU *cpu, Word low, Word high, Byte tags)
+{
+  for (Uint32 address = low; address <= high; address++)
+    {
+      cpu->taint.memory[address] |= tags;
+    }
+}
+
+void
+taint_add_source (CPU *cpu, Word low, Word high, Byte tags)
+{
+  for (Uint32 address = low; address <= high; address++)
+    {
+      cpu->taint.sources[address] |= tags;
+    }
+}
+
+Byte
+taint_range (const CPU *cpu, Word low, Word high)
+{
+  Byte tags = 0;
+  for (Uint32 address = low; address <= high; address++)
+    {
+      tags |= cpu->taint.memory[address];
+    }
+  return tags;
+}
+
+Word
+taint_rule (const CPU *cpu, Byte opcode)
+{
+  return cpu->taint.rules[opcode];
+}
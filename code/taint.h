@@ -0,0 +1,138 @@
+#ifndef TAINT_H_
+#define TAINT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* taint.h
+ * Taint tracking.  Every memory byte and register carries an 8-bit tag
+ * mask; tags flow from what an instruction reads to what it writes.  This
+ * only exists in the ACE64_TAINT instantiation of the core
+ * (ace64_taint_core); the ordinary core has no tags and no hooks.
+ *
+ * Propagation is per instruction: the tags of the instruction's source
+ * registers and of every byte it reads through read_byte/read_word are
+ * ORed together, stored into every byte it writes, and given to its
+ * destination register and, if it sets flags, to P.  So LDA copies a
+ * byte's tags to A, ADC merges A, the operand and P, and PHA/PLA carry tags
+ * through the stack.  Operand bytes fetched through PC carry no tags, so
+ * immediates are clean; a zero-page pointer read by (zp),Y and (zp,X)
+ * modes does taint the data loaded through it.  P has one tag for all
+ * flags.
+ *
+ * Sources are tags placed on memory (taint_mark, e.g. a file-loaded range)
+ * or attached to addresses so that every read of them is tagged
+ * (taint_add_source, e.g. an input device register).
+ */
+#include "cpu.h"
+
+#ifndef ACE64_TAINT
+#error "taint.h needs the ACE64_TAINT instantiation of the core"
+#endif
+
+// Rule bits: source registers, destination register and flag update.
+#define TAINT_FROM_A 0x0001
+#define TAINT_FROM_X 0x0002
+#define TAINT_FROM_Y 0x0004
+#define TAINT_FROM_P 0x0008
+#define TAINT_FROM_SP 0x0010
+#define TAINT_SETS_FLAGS 0x0020
+#define TAINT_TO_SHIFT 8
+
+typedef enum
+{
+  TAINT_TO_NONE,
+  TAINT_TO_A,
+  TAINT_TO_X,
+  TAINT_TO_Y,
+  TAINT_TO_P,
+  TAINT_TO_SP,
+  TAINT_TO_PC,
+  TAINT_TO_AX // LAX
+} TaintDestination;
+
+// Called by reset(): clears all tags and sources.
+void taint_reset (CPU *cpu);
+
+// Clears memory and register tags and all sources.
+void taint_clear (CPU *cpu);
+
+// ORs tags into the bytes in [low, high].
+void taint_mark (CPU *cpu, Word low, Word high, Byte tags);
+
+// Every later read of an address in [low, high] carries tags.
+void taint_add_source (CPU *cpu, Word low, Word high, Byte tags);
+
+// OR of the tags of the bytes in [low, high].
+Byte taint_range (const CPU *cpu, Word low, Word high);
+
+// The propagation rule execute() applies for an opcode.
+Word taint_rule (const CPU *cpu, Byte opcode);
+
+static inline Word
+taint_begin (CPU *cpu, Byte opcode)
+{
+  TaintState *taint = &cpu->taint;
+  Word rule = taint->rules[opcode];
+  Byte tags = 0;
+
+  if (rule & TAINT_FROM_A)
+    tags |= taint->a;
+  if (rule & TAINT_FROM_X)
+    tags |= taint->x;
+  if (rule & TAINT_FROM_Y)
+    tags |= taint->y;
+  if (rule & TAINT_FROM_P)
+    tags |= taint->p;
+  if (rule & TAINT_FROM_SP)
+    tags |= taint->sp;
+
+  taint->current = tags;
+  return rule;
+}
+
+static inline void
+taint_end (CPU *cpu, Word rule)
+{
+  TaintState *taint = &cpu->taint;
+  Byte tags = taint->current;
+
+  switch ((TaintDestination)(rule >> TAINT_TO_SHIFT))
+    {
+    case TAINT_TO_A:
+      taint->a = tags;
+      break;
+    case TAINT_TO_X:
+      taint->x = tags;
+      break;
+    case TAINT_TO_Y:
+      taint->y = tags;
+      break;
+    case TAINT_TO_P:
+      taint->p = tags;
+      break;
+    case TAINT_TO_SP:
+      taint->sp = tags;
+      break;
+    case TAINT_TO_PC:
+      taint->pc = tags;
+      break;
+    case TAINT_TO_AX:
+      taint->a = tags;
+      taint->x = tags;
+      break;
+    default:
+      break;
+    }
+  if (rule & TAINT_SETS_FLAGS)
+    {
+      taint->p = tags;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,233 @@
+#include "trace.h"
+#include "trace_ring.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TRACE_MAGIC "A64T"
+#define TRACE_VERSION 1
+#define TRACE_RECORD_SIZE 16
+
+_Static_assert (sizeof (TraceRecord) == TRACE_RECORD_SIZE,
+                "TraceRecord must stay packed");
+
+Trace *
+trace_create (Uint32 capacity)
+{
+  Uint32 rounded = 1;
+  while (rounded < capacity && rounded < 0x80000000u)
+    {
+      rounded <<= 1;
+    }
+
+  Trace *trace = (Trace *)calloc (1, sizeof (Trace));
+  if (trace == NULL)
+    {
+      return NULL;
+    }
+  trace->records = (TraceRecord *)calloc (rounded, sizeof (TraceRecord));
+  if (trace->records == NULL)
+    {
+      free (trace);
+      return NULL;
+    }
+  trace->mask = rounded - 1;
+  return trace;
+}
+
+void
+trace_destroy (Trace *trace)
+{
+  if (trace != NULL)
+    {
+      free (trace->records);
+      free (trace);
+    }
+}
+
+Uint32
+trace_capacity (const Trace *trace)
+{
+  return trace->mask + 1;
+}
+
+Uint64
+trace_count (const Trace *trace)
+{
+  return atomic_load_explicit (&((Trace *)trace)->head, memory_order_acquire);
+}
+
+void
+trace_clear (Trace *trace)
+{
+  atomic_store_explicit (&trace->claimed, 0, memory_order_relaxed);
+  atomic_store_explicit (&trace->head, 0, memory_order_release);
+  trace->cycles = 0;
+}
+
+void
+trace_attach (CPU *cpu, Trace *trace)
+{
+  cpu->trace = trace;
+}
+
+Uint32
+trace_snapshot (const Trace *trace, TraceRecord *records, Uint32 max,
+                Uint64 *firstSequence)
+{
+  Trace *t = (Trace *)trace;
+  Uint64 capacity = (Uint64)t->mask + 1;
+  Uint64 head = atomic_load_explicit (&t->head, memory_order_acquire);
+
+  Uint64 count = head < capacity ? head : capacity;
+  count = count < max ? count : max;
+  Uint64 first = head - count;
+
+  for (Uint64 i = 0; i < count; i++)
+    {
+      records[i] = t->records[(first + i) & t->mask];
+    }
+
+  // Anything the writer may have started overwriting during the copy is
+  // dropped from the front.
+  atomic_thread_fence (memory_order_acquire);
+  Uint64 claimed = atomic_load_explicit (&t->claimed, memory_order_relaxed);
+  Uint64 oldestIntact = claimed > capacity ? claimed - capacity : 0;
+  if (oldestIntact > first)
+    {
+      Uint64 torn = oldestIntact - first;
+      torn = torn < count ? torn : count;
+      memmove (records, records + torn,
+               (count - torn) * sizeof (TraceRecord));
+      count -= torn;
+      first += torn;
+    }
+
+  *firstSequence = first;
+  return (Uint32)count;
+}
+
+static void
+put_uint32 (Byte *out, Uint32 value)
+{
+  out[0] = value & 0xFF;
+  out[1] = (value >> 8) & 0xFF;
+  out[2] = (value >> 16) & 0xFF;
+  out[3] = (value >> 24) & 0xFF;
+}
+
+static Uint32
+get_uint32 (const Byte *in)
+{
+  return (Uint32)in[0] | (Uint32)in[1] << 8 | (Uint32)in[2] << 16
+         | (Uint32)in[3] << 24;
+}
+
+static void
+encode_record (const TraceRecord *record, Byte *out)
+{
+  put_uint32 (out, record->cycle);
+  out[4] = record->pc & 0xFF;
+  out[5] = record->pc >> 8;
+  out[6] = record->opcode;
+  out[7] = record->operands[0];
+  out[8] = record->operands[1];
+  out[9] = record->a;
+  out[10] = record->x;
+  out[11] = record->y;
+  out[12] = record->p;
+  out[13] = record->sp;
+  out[14] = record->cycles;
+  out[15] = record->reserved;
+}
+
+static void
+decode_record (const Byte *in, TraceRecord *record)
+{
+  record->cycle = get_uint32 (in);
+  record->pc = (Word)(in[4] | in[5] << 8);
+  record->opcode = in[6];
+  record->operands[0] = in[7];
+  record->operands[1] = in[8];
+  record->a = in[9];
+  record->x = in[10];
+  record->y = in[11];
+  record->p = in[12];
+  record->sp = in[13];
+  record->cycles = in[14];
+  record->reserved = in[15];
+}
+
+bool
+trace_write (const Trace *trace, Uint32 max, FILE *file)
+{
+  Uint32 room = trace_capacity (trace);
+  if (max == 0 || max > room)
+    {
+      max = room;
+    }
+
+  TraceRecord *records = (TraceRecord *)malloc (max * sizeof (TraceRecord));
+  if (records == NULL)
+    {
+      return false;
+    }
+
+  Uint64 first;
+  Uint32 count = trace_snapshot (trace, records, max, &first);
+
+  Byte header[24];
+  memcpy (header, TRACE_MAGIC, 4);
+  put_uint32 (header + 4, TRACE_VERSION);
+  put_uint32 (header + 8, TRACE_RECORD_SIZE);
+  put_uint32 (header + 12, count);
+  put_uint32 (header + 16, (Uint32)first);
+  put_uint32 (header + 20, (Uint32)(first >> 32));
+
+  bool ok = fwrite (header, sizeof (header), 1, file) == 1;
+  for (Uint32 i = 0; ok && i < count; i++)
+    {
+      Byte encoded[TRACE_RECORD_SIZE];
+      encode_record (&records[i], encoded);
+      ok = fwrite (encoded, sizeof (encoded), 1, file) == 1;
+    }
+
+  free (records);
+  return ok;
+}
+
+bool
+trace_read (FILE *file, TraceRecord **records, Uint32 *count,
+            Uint64 *firstSequence)
+{
+  Byte header[24];
+  if (fread (header, sizeof (header), 1, file) != 1
+      || memcmp (header, TRACE_MAGIC, 4) != 0
+      || get_uint32 (header + 4) != TRACE_VERSION
+      || get_uint32 (header + 8) != TRACE_RECORD_SIZE)
+    {
+      return false;
+    }
+
+  *count = get_uint32 (header + 12);
+  *firstSequence = (Uint64)get_uint32 (header + 20) << 32
+                   | get_uint32 (header + 16);
+  *records = (TraceRecord *)malloc ((size_t)*count * sizeof (TraceRecord)
+                                    + 1);
+  if (*records == NULL)
+    {
+      return false;
+    }
+
+  for (Uint32 i = 0; i < *count; i++)
+    {
+      Byte encoded[TRACE_RECORD_SIZE];
+      if (fread (encoded, sizeof (encoded), 1, file) != 1)
+        {
+          free (*records);
+          *records = NULL;
+          return false;
+        }
+      decode_record (encoded, &(*records)[i]);
+    }
+  return true;
+}
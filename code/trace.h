@@ -0,0 +1,70 @@
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* trace.h
+ * Execution trace: a fixed-size ring of packed records, one per retired
+ * instruction.  Attaching a trace to a CPU arms it; attaching NULL disarms
+ * it.  The CPU's thread is the only writer and never blocks; other threads
+ * may take snapshots or dumps at any time, and get the newest records that
+ * were not overwritten while they were being copied.
+ *
+ * Dumps are decoded offline by ace64-trace.
+ */
+#include "cpu.h"
+#include <stdio.h>
+
+// 16 bytes; the state is as it was before the instruction executed.
+typedef struct
+{
+  Uint32 cycle; // Low 32 bits of the cycle count at the start
+  Word pc;
+  Byte opcode;
+  Byte operands[2]; // The two bytes after the opcode, whether used or not
+  Byte a;
+  Byte x;
+  Byte y;
+  Byte p;
+  Byte sp;
+  Byte cycles; // Cycles the instruction took
+  Byte reserved;
+} TraceRecord;
+
+typedef struct Trace Trace;
+
+// capacity is rounded up to a power of two.  Returns NULL on failure.
+Trace *trace_create (Uint32 capacity);
+void trace_destroy (Trace *trace);
+
+Uint32 trace_capacity (const Trace *trace);
+
+// Records ever written, including those since overwritten.
+Uint64 trace_count (const Trace *trace);
+
+// Forgets all records and restarts the cycle count.  Writer thread only.
+void trace_clear (Trace *trace);
+
+void trace_attach (CPU *cpu, Trace *trace);
+
+// Copies the newest records, oldest first, into records (room for max).
+// *firstSequence receives the sequence number of records[0].
+Uint32 trace_snapshot (const Trace *trace, TraceRecord *records, Uint32 max,
+                       Uint64 *firstSequence);
+
+// Dump format, all little-endian: "A64T", Uint32 version (1), Uint32 record
+// size (16), Uint32 record count, Uint64 sequence number of the first record,
+// then the records with their fields in declaration order.
+bool trace_write (const Trace *trace, Uint32 max, FILE *file);
+
+// Reads a dump written by trace_write.  *records is malloc'd.
+bool trace_read (FILE *file, TraceRecord **records, Uint32 *count,
+                 Uint64 *firstSequence);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef TRACE_RING_H_
+#define TRACE_RING_H_
+
+/* trace_ring.h
+ * The trace ring itself, shared by trace.c and execute() so that recording
+ * an instruction inlines into the dispatch loop.  C only; everything else
+ * goes through trace.h.
+ */
+#include "trace.h"
+#include <stdatomic.h>
+
+struct Trace
+{
+  TraceRecord *records;
+  Uint32 mask;
+
+  // Sequence-lock style publication: claimed is bumped before a slot is
+  // overwritten and head after it is complete, so a reader that checks
+  // claimed after copying knows which records may have been torn.
+  _Atomic Uint64 claimed;
+  _Atomic Uint64 head;
+
+  Uint64 cycles; // Writer only
+};
+
+// trace_begin fills in the pre-instruction state of the next slot;
+// trace_end completes and publishes it.
+static inline TraceRecord *
+trace_begin (Trace *trace, const CPU *cpu)
+{
+  Uint64 head = atomic_load_explicit (&trace->head, memory_order_relaxed);
+  TraceRecord *record = &trace->records[head & trace->mask];
+
+  atomic_store_explicit (&trace->claimed, head + 1, memory_order_relaxed);
+  atomic_thread_fence (memory_order_release);
+
+  record->cycle = (Uint32)trace->cycles;
+  record->pc = cpu->PC;
+  record->opcode = cpu->Memory[cpu->PC];
+  record->operands[0] = cpu->Memory[(Word)(cpu->PC + 1)];
+  record->operands[1] = cpu->Memory[(Word)(cpu->PC + 2)];
+  record->a = cpu->A;
+  record->x = cpu->X;
+  record->y = cpu->Y;
+  record->p = cpu->P;
+  record->sp = cpu->SP;
+  return record;
+}
+
+static inline void
+trace_end (Trace *trace, TraceRecord *record, Sint32 cycles)
+{
+  Uint64 head = atomic_load_explicit (&trace->head, memory_order_relaxed);
+
+  record->cycles = (Byte)cycles;
+  record->reserved = 0;
+  trace->cycles += cycles;
+  atomic_store_explicit (&trace->head, head + 1, memory_order_release);
+}
+
+#endif
@@ -0,0 +1,36 @@
+#include "writers.h"
+#include <string.h>
+
+#ifdef ACE64_LAST_WRITER
+void
+writers_attach (CPU *cpu, LastWriters *writers)
+{
+  cpu->lastWriters = writers;
+}
+#endif
+
+void
+writers_clear (LastWriters *writers)
+{
+  memset (writers, 0, sizeof (*writers));
+}
+
+bool
+writers_query (const LastWriters *writers, Word address, Word *pc,
+               Uint64 *cycle)
+{
+  Uint64 stamp = writers->stamps[address];
+  if (stamp == 0)
+    {
+      return false;
+    }
+  if (pc != NULL)
+    {
+      *pc = (Word)(stamp & 0xFFFF);
+    }
+  if (cycle != NULL)
+    {
+      *cycle = (stamp >> 16) - 1;
+    }
+  return true;
+}
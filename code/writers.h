@@ -0,0 +1,51 @@
+#ifndef WRITERS_H_
+#define WRITERS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* writers.h
+ * Last-writer table: for every address, the PC and starting cycle of the
+ * instruction that last wrote it.  Each entry is one 64-bit stamp, so
+ * write_byte pays a single extra store; execute() prepares the stamp once
+ * per instruction.  Recording is only built into the core when
+ * ACE64_LAST_WRITER is defined (cmake -DACE64_LAST_WRITER=ON).
+ *
+ * The table keeps its own cycle count of the instructions executed while it
+ * is attached, starting from zero when it is cleared.
+ */
+#include "cpu.h"
+
+struct LastWriters
+{
+  // (cycle + 1) << 16 | pc; zero if never written.
+  Uint64 stamps[MAX_MEMORY];
+
+  // Stamp of the instruction being executed, and the cycle it started on.
+  Uint64 stamp;
+  Uint64 cycle;
+};
+
+static inline Uint64
+writers_stamp (Uint64 cycle, Word pc)
+{
+  return (cycle + 1) << 16 | pc;
+}
+
+#ifdef ACE64_LAST_WRITER
+// Starts recording into writers (which is not cleared); NULL stops.
+void writers_attach (CPU *cpu, LastWriters *writers);
+#endif
+
+void writers_clear (LastWriters *writers);
+
+// Returns false if address has not been written since the last clear.
+bool writers_query (const LastWriters *writers, Word address, Word *pc,
+                    Uint64 *cycle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,4 +1,5 @@
 #include "../code/cpu.h"
+#include "../code/machine.hpp"
 #include <gtest/gtest.h>
 // TODO: These tests need to be implemented:
 //  - TAX, TAY, TXA, TYA
@@ -22,14 +23,14 @@ public:
 };
 
 static void
-VerifyUnmodifiedFlags (CPU cpu, CPU cpuCopy)
+VerifyUnmodifiedFlags (const CPU &cpu, ace64::RegisterState before)
 {
-  EXPECT_FALSE ((cpu.P & FLAG_OVERFLOW) ^ (cpuCopy.P & FLAG_OVERFLOW));
-  EXPECT_FALSE ((cpu.P & FLAG_DECIMAL_MODE) ^ (cpuCopy.P & FLAG_DECIMAL_MODE));
+  EXPECT_FALSE ((cpu.P & FLAG_OVERFLOW) ^ (before.p & FLAG_OVERFLOW));
+  EXPECT_FALSE ((cpu.P & FLAG_DECIMAL_MODE) ^ (before.p & FLAG_DECIMAL_MODE));
   EXPECT_FALSE ((cpu.P & FLAG_INTERRUPT_DISABLE)
-                ^ (cpuCopy.P & FLAG_INTERRUPT_DISABLE));
-  EXPECT_FALSE ((cpu.P & FLAG_CARRY) ^ (cpuCopy.P & FLAG_CARRY));
-  EXPECT_FALSE ((cpu.P & FLAG_BREAK) ^ (cpuCopy.P & FLAG_BREAK));
+                ^ (before.p & FLAG_INTERRUPT_DISABLE));
+  EXPECT_FALSE ((cpu.P & FLAG_CARRY) ^ (before.p & FLAG_CARRY));
+  EXPECT_FALSE ((cpu.P & FLAG_BREAK) ^ (before.p & FLAG_BREAK));
 }
 
 TEST_F (ace64Test, StackPointerCheckOverflow)
@@ -38,7 +39,7 @@ TEST_F (ace64Test, StackPointerCheckOverflow)
   // given:
   cpu.SP = 0xFF;
   cpu.Memory[0x0101] = 0x77;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   cpu.SP += 2;
@@ -55,7 +56,7 @@ TEST_F (ace64Test, StackPointerCheckUnderflow)
   // given:
   cpu.SP = 0x00;
   cpu.Memory[0x01FE] = 0x77;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   cpu.SP -= 2;
@@ -77,7 +78,7 @@ TEST_F (ace64Test, LDAImmediate)
   // given:
   cpu.Memory[0xFFFC] = INS_LDA_IM;
   cpu.Memory[0xFFFD] = 0x77;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -97,7 +98,7 @@ TEST_F (ace64Test, LDAZeroPage)
   cpu.Memory[0xFFFC] = INS_LDA_ZP;
   cpu.Memory[0xFFFD] = 0x42;
   cpu.Memory[0x0042] = 0x37;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 3;
 
   // when:
@@ -119,7 +120,7 @@ TEST_F (ace64Test, LDAZeroPageX)
   cpu.Memory[0xFFFC] = INS_LDA_ZPX;
   cpu.Memory[0xFFFD] = 0x04;
   cpu.Memory[0x0006] = 0x37;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 4;
 
   // when:
@@ -140,7 +141,7 @@ TEST_F (ace64Test, LDAZeroPageXBoundaryCheck)
   cpu.Memory[0xFFFC] = INS_LDA_ZPX;
   cpu.Memory[0xFFFD] = 0x80;
   cpu.Memory[0x007F] = 0x37;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 4;
 
   // when:
@@ -160,7 +161,7 @@ TEST_F (ace64Test, LDAImmediateZeroValue)
   cpu.A = 0x44;
   cpu.Memory[0xFFFC] = INS_LDA_IM;
   cpu.Memory[0xFFFD] = 0x0;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -183,7 +184,7 @@ TEST_F (ace64Test, LDAAbsolute)
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   cpu.Memory[0x4480] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 4;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   //
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -204,7 +205,7 @@ TEST_F (ace64Test, LDAAbsoluteX)
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   cpu.Memory[0x4481] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 4;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -227,7 +228,7 @@ TEST_F (ace64Test, LDAAbsoluteXBoundary)
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   cpu.Memory[0x457F] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 5;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -250,7 +251,7 @@ TEST_F (ace64Test, LDAAbsoluteY)
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   cpu.Memory[0x4481] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 4;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -273,7 +274,7 @@ TEST_F (ace64Test, LDAAbsoluteYBoundary)
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   cpu.Memory[0x457F] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 5;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -297,7 +298,7 @@ TEST_F (ace64Test, LDAIndirectX)
   cpu.Memory[0x0007] = 0x80;
   cpu.Memory[0x8000] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 6;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -321,7 +322,7 @@ TEST_F (ace64Test, LDAIndirectY)
   cpu.Memory[0x0003] = 0x80;
   cpu.Memory[0x8004] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 5;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -345,7 +346,7 @@ TEST_F (ace64Test, LDAAIndirectYBoundary)
   cpu.Memory[0x0003] = 0x44;
   cpu.Memory[0x457F] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 6;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -365,7 +366,7 @@ TEST_F (ace64Test, LDXImmediate)
   // given:
   cpu.Memory[0xFFFC] = INS_LDX_IM;
   cpu.Memory[0xFFFD] = 0x77;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -385,7 +386,7 @@ TEST_F (ace64Test, LDXZeroPage)
   cpu.Memory[0xFFFC] = INS_LDX_ZP;
   cpu.Memory[0xFFFD] = 0x42;
   cpu.Memory[0x0042] = 0x37;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 3;
 
   // when:
@@ -407,7 +408,7 @@ TEST_F (ace64Test, LDXZeroPageY)
   cpu.Memory[0xFFFC] = INS_LDX_ZPY;
   cpu.Memory[0xFFFD] = 0x06;
   cpu.Memory[0x000A] = 0x37;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 4;
 
   // when:
@@ -428,7 +429,7 @@ TEST_F (ace64Test, LDXZeroPageYBoundaryCheck)
   cpu.Memory[0xFFFC] = INS_LDX_ZPY;
   cpu.Memory[0xFFFD] = 0x80;
   cpu.Memory[0x007F] = 0x37;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 4;
 
   // when:
@@ -450,7 +451,7 @@ TEST_F (ace64Test, LDXAbsolute)
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   cpu.Memory[0x4480] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 4;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   //
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -472,7 +473,7 @@ TEST_F (ace64Test, LDXAbsoluteY)
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   cpu.Memory[0x4481] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 4;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -495,7 +496,7 @@ TEST_F (ace64Test, LDXAbsoluteYBoundary)
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   cpu.Memory[0x457F] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 5;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -515,7 +516,7 @@ TEST_F (ace64Test, LDYImmediate)
   // given:
   cpu.Memory[0xFFFC] = INS_LDY_IM;
   cpu.Memory[0xFFFD] = 0x77;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -535,7 +536,7 @@ TEST_F (ace64Test, LDYZeroPage)
   cpu.Memory[0xFFFC] = INS_LDY_ZP;
   cpu.Memory[0xFFFD] = 0x42;
   cpu.Memory[0x0042] = 0x37;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 3;
 
   // when:
@@ -557,7 +558,7 @@ TEST_F (ace64Test, LDYZeroPageX)
   cpu.Memory[0xFFFC] = INS_LDY_ZPX;
   cpu.Memory[0xFFFD] = 0x06;
   cpu.Memory[0x000A] = 0x37;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 4;
 
   // when:
@@ -578,7 +579,7 @@ TEST_F (ace64Test, LDYZeroPageXBoundaryCheck)
   cpu.Memory[0xFFFC] = INS_LDY_ZPX;
   cpu.Memory[0xFFFD] = 0x80;
   cpu.Memory[0x007F] = 0x37;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 4;
 
   // when:
@@ -600,7 +601,7 @@ TEST_F (ace64Test, LDYAbsolute)
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   cpu.Memory[0x4480] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 4;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   //
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -622,7 +623,7 @@ TEST_F (ace64Test, LDYAbsoluteX)
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   cpu.Memory[0x4481] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 4;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -645,7 +646,7 @@ TEST_F (ace64Test, LDYAbsoluteXBoundary)
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   cpu.Memory[0x457F] = 0x77;
   constexpr Sint32 EXPECTED_CYCLES = 5;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -667,7 +668,7 @@ TEST_F (ace64Test, STAZPWritesARegisterToMemory)
   cpu.Memory[0xFFFD] = 0x3D;
 
   constexpr Sint32 EXPECTED_CYCLES = 3;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -688,7 +689,7 @@ TEST_F (ace64Test, STAZPXWritesARegisterToMemory)
   cpu.Memory[0xFFFD] = 0x3D;
 
   constexpr Sint32 EXPECTED_CYCLES = 4;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -709,7 +710,7 @@ TEST_F (ace64Test, STAAbsolute)
   cpu.Memory[0xFFFD] = 0x80;
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   constexpr Sint32 EXPECTED_CYCLES = 4;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -729,7 +730,7 @@ TEST_F (ace64Test, STAAbsoluteX)
   cpu.Memory[0xFFFD] = 0x80;
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   constexpr Sint32 EXPECTED_CYCLES = 5;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -750,7 +751,7 @@ TEST_F (ace64Test, STAAbsoluteXBoundary)
   cpu.Memory[0xFFFD] = 0x80;
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   constexpr Sint32 EXPECTED_CYCLES = 5;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -771,7 +772,7 @@ TEST_F (ace64Test, STAAbsoluteY)
   cpu.Memory[0xFFFD] = 0x80;
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   constexpr Sint32 EXPECTED_CYCLES = 5;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -792,7 +793,7 @@ TEST_F (ace64Test, STAAbsoluteYBoundary)
   cpu.Memory[0xFFFD] = 0x80;
   cpu.Memory[0xFFFE] = 0x44; // 0x4480
   constexpr Sint32 EXPECTED_CYCLES = 5;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -816,7 +817,7 @@ TEST_F (ace64Test, STAIndirectX)
   cpu.Memory[0x0006] = 0x00;
   cpu.Memory[0x0007] = 0x80;
   constexpr Sint32 EXPECTED_CYCLES = 6;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -838,7 +839,7 @@ TEST_F (ace64Test, STAIndirectY)
   cpu.Memory[0x0002] = 0x00; // 0x4480
   cpu.Memory[0x0003] = 0x80;
   constexpr Sint32 EXPECTED_CYCLES = 6;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -860,7 +861,7 @@ TEST_F (ace64Test, STAAIndirectYBoundary)
   cpu.Memory[0x0002] = 0x80;
   cpu.Memory[0x0003] = 0x44;
   constexpr Sint32 EXPECTED_CYCLES = 6;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -880,7 +881,7 @@ TEST_F (ace64Test, STX_ZeroPoint_Writes_X_Register_To_Memory)
   cpu.Memory[0xFFFD] = 0x3D;
 
   constexpr Sint32 EXPECTED_CYCLES = 3;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -939,7 +940,7 @@ TEST_F (ace64Test, STY_ZerPoint_Address_Contains_Value)
   cpu.Memory[0xFFFD] = 0x3D;
 
   constexpr Sint32 EXPECTED_CYCLES = 3;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -957,7 +958,7 @@ TEST_F (ace64Test, DEC_ZeroPage_Decreases_Value)
   cpu.Memory[0xFFFD] = 0x3D;
   cpu.Memory[0x003D] = 0x01;
   constexpr Sint32 EXPECTED_CYCLES = 5;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -976,7 +977,7 @@ TEST_F (ace64Test, DEC_ZeroPage_Indexed_Decreases_Value)
   cpu.Memory[0xFFFD] = 0x04;
   cpu.Memory[0x0006] = 0x01;
   constexpr Sint32 EXPECTED_CYCLES = 6;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   printf ("Status before: %b\n", cpu.P);
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -995,7 +996,7 @@ TEST_F (ace64Test, DEC_ZeroPage_ZeroValue)
   cpu.Memory[0xFFFD] = 0x04;
   cpu.Memory[0x0004] = 0x00;
   constexpr Sint32 EXPECTED_CYCLES = 5;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   // when:
   Sint32 CyclesUsed = execute (&cpu);
 
@@ -1013,7 +1014,7 @@ TEST_F (ace64Test, INC_ZeroPage_Increases_Value)
   cpu.Memory[0xFFFD] = 0x04;
   cpu.Memory[0x0004] = 0x01;
   constexpr Sint32 EXPECTED_CYCLES = 5;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -1031,7 +1032,7 @@ TEST_F (ace64Test, INC_ZeroPage_FFValue)
   cpu.Memory[0xFFFD] = 0x3D;
   cpu.Memory[0x003D] = 0xFF;
   constexpr Sint32 EXPECTED_CYCLES = 5;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   // when:
   Sint32 CyclesUsed = execute (&cpu);
 
@@ -1050,7 +1051,7 @@ TEST_F (ace64Test, INC_ZeroPage_Indexed_Increased_Value)
   cpu.Memory[0xFFFD] = 0x04;
   cpu.Memory[0x0006] = 0x01;
   constexpr Sint32 EXPECTED_CYCLES = 6;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   printf ("Status before: %b\n", cpu.P);
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -1070,7 +1071,7 @@ TEST_F (ace64Test, DEC_Absolute_Decreases_Value)
   cpu.Memory[0xFFFE] = 0x44;
   cpu.Memory[0x4480] = 0x31;
   constexpr Sint32 EXPECTED_CYCLES = 6;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -1090,7 +1091,7 @@ TEST_F (ace64Test, INC_Absolute_Decreases_Value)
   cpu.Memory[0xFFFE] = 0x44;
   cpu.Memory[0x4480] = 0x31;
   constexpr Sint32 EXPECTED_CYCLES = 6;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -1111,7 +1112,7 @@ TEST_F (ace64Test, DEC_Absolute_Indexed_Decreases_Value)
   cpu.Memory[0xFFFE] = 0x44;
   cpu.Memory[0x44B2] = 0x31;
   constexpr Sint32 EXPECTED_CYCLES = 7;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -1132,7 +1133,7 @@ TEST_F (ace64Test, INC_Absolute_Indexed_Increases_Value)
   cpu.Memory[0xFFFE] = 0x44;
   cpu.Memory[0x44B2] = 0x31;
   constexpr Sint32 EXPECTED_CYCLES = 7;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -1154,7 +1155,7 @@ TEST_F (ace64Test, JMPAbsolutePCContainsAddress)
   cpu.Memory[0x4480] = INS_LDA_ABS;
 
   constexpr Sint32 EXPECTED_CYCLES = 3;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   // when:
   Sint32 CyclesUsed = execute (&cpu);
@@ -1193,7 +1194,7 @@ TEST_F (ace64Test, TAXTestValues)
   // given:
   cpu.Memory[0xFFFC] = INS_TAX;
   cpu.A = 0x42;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -1211,7 +1212,7 @@ TEST_F (ace64Test, TAXTestZeroValue)
   // given:
   cpu.Memory[0xFFFC] = INS_TAX;
   cpu.A = 0x00;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -1229,7 +1230,7 @@ TEST_F (ace64Test, TAYTestValues)
   // given:
   cpu.Memory[0xFFFC] = INS_TAY;
   cpu.A = 0x42;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -1247,7 +1248,7 @@ TEST_F (ace64Test, TAYTestZeroValue)
   // given:
   cpu.Memory[0xFFFC] = INS_TAY;
   cpu.A = 0x00;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -1265,7 +1266,7 @@ TEST_F (ace64Test, TXATestValues)
   // given:
   cpu.Memory[0xFFFC] = INS_TXA;
   cpu.X = 0x42;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -1283,7 +1284,7 @@ TEST_F (ace64Test, TXATestZeroValue)
   // given:
   cpu.Memory[0xFFFC] = INS_TXA;
   cpu.X = 0x00;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -1301,7 +1302,7 @@ TEST_F (ace64Test, TYATestValues)
   // given:
   cpu.Memory[0xFFFC] = INS_TYA;
   cpu.Y = 0x42;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -1319,7 +1320,7 @@ TEST_F (ace64Test, TYATestZeroValue)
   // given:
   cpu.Memory[0xFFFC] = INS_TYA;
   cpu.Y = 0x00;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -1337,7 +1338,7 @@ TEST_F (ace64Test, TSXTestValues)
   // given:
   cpu.Memory[0xFFFC] = INS_TSX;
   cpu.SP = 0x7A;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -1355,7 +1356,7 @@ TEST_F (ace64Test, TSXTestZeroValue)
   // given:
   cpu.SP = 0x00;
   cpu.Memory[0xFFFC] = INS_TSX;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -1373,7 +1374,7 @@ TEST_F (ace64Test, TXSTestValues)
   // given:
   cpu.Memory[0xFFFC] = INS_TXS;
   cpu.X = 0x7A;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 2;
 
   // when:
@@ -1391,7 +1392,7 @@ TEST_F (ace64Test, PHATestStackPush)
   // given:
   cpu.Memory[0xFFFC] = INS_PHA;
   cpu.A = 0x42;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 3;
 
   // when:
@@ -1435,7 +1436,7 @@ TEST_F (ace64Test, PLATestAccumulatorLoad)
   cpu.SP = 0xFC;
   cpu.Memory[0xFFFC] = INS_PLA;
   cpu.Memory[0x01FD] = 0x88;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
   constexpr Sint32 EXPECTED_CYCLES = 3;
 
   // when:
@@ -1455,7 +1456,7 @@ TEST_F (ace64Test, PLPTestStatusLoad)
   cpu.Memory[0x01FF] = stackValue;
 
   cpu.Memory[0xFFFC] = INS_PLP;
-  CPU cpuCopy = cpu;
+  ace64::RegisterState cpuCopy = ace64::RegisterState::of (cpu);
 
   constexpr Sint32 EXPECTED_CYCLES = 3;
 
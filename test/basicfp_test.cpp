@@ -0,0 +1,331 @@
+#include "../code/basicfp.h"
+#include "../code/cpu.h"
+#include "../code/hle.h"
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+class basicfpTest : public testing::Test
+{
+public:
+  CPU cpu;
+  Hle *hle;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    memset (cpu.Memory, 0, MAX_MEMORY);
+    hle = (Hle *)malloc (sizeof (Hle));
+    hle_clear (hle);
+    cpu.PC = 0x0200;
+  }
+
+  virtual void
+  TearDown ()
+  {
+    free (hle);
+  }
+
+  static BasicFloat
+  Float (long double host)
+  {
+    BasicFloat value;
+    EXPECT_TRUE (basicfp_from_host (host, &value));
+    return value;
+  }
+
+  void
+  SetArg (long double host)
+  {
+    BasicFloat arg = Float (host);
+    cpu.Memory[BASICFP_ARG] = arg.exponent;
+    for (int i = 0; i < 4; i++)
+      {
+        cpu.Memory[BASICFP_ARG + 1 + i] = arg.mantissa >> (24 - 8 * i);
+      }
+    cpu.Memory[BASICFP_ARG_SIGN] = arg.sign;
+    cpu.Memory[BASICFP_SIGN_COMPARE]
+        = arg.sign ^ cpu.Memory[BASICFP_FAC_SIGN];
+  }
+
+  // A report as basicfp_verify() leaves it when every routine matched the
+  // ROM on ten samples of 200 cycles.
+  static BasicFpReport
+  Verified ()
+  {
+    BasicFpReport report;
+    memset (&report, 0, sizeof (report));
+    for (int i = 0; i < BASICFP_ROUTINES; i++)
+      {
+        report.samples[i] = 10;
+        report.romCycles[i] = 2000;
+      }
+    return report;
+  }
+
+  // Packs host at $033C for the memory-operand forms, pointed to by A/Y.
+  void
+  SetOperand (long double host)
+  {
+    basicfp_pack (Float (host), &cpu.Memory[0x033C]);
+    cpu.A = 0x3C;
+    cpu.Y = 0x03;
+  }
+
+  long double
+  Fac ()
+  {
+    return basicfp_to_host (basicfp_fac (&cpu));
+  }
+};
+
+TEST_F (basicfpTest, PacksKnownConstants)
+{
+  struct
+  {
+    long double host;
+    Byte packed[5];
+  } constants[] = {
+    { 1.0L, { 0x81, 0x00, 0x00, 0x00, 0x00 } },
+    { -1.0L, { 0x81, 0x80, 0x00, 0x00, 0x00 } },
+    { 0.5L, { 0x80, 0x00, 0x00, 0x00, 0x00 } },
+    { 10.0L, { 0x84, 0x20, 0x00, 0x00, 0x00 } },
+    { 3.14159265358979323846L, { 0x82, 0x49, 0x0F, 0xDA, 0xA2 } },
+  };
+
+  for (auto &constant : constants)
+    {
+      // when:
+      Byte packed[5];
+      basicfp_pack (Float (constant.host), packed);
+
+      // then:
+      EXPECT_EQ (memcmp (packed, constant.packed, 5), 0);
+    }
+}
+
+TEST_F (basicfpTest, UnpackAndPackRoundTrip)
+{
+  srand (43);
+  for (int i = 0; i < 1000; i++)
+    {
+      // given:
+      Byte packed[5];
+      for (int j = 0; j < 5; j++)
+        {
+          packed[j] = rand ();
+        }
+      packed[0] |= 1;
+
+      // when:
+      Byte repacked[5];
+      basicfp_pack (basicfp_unpack (packed), repacked);
+
+      // then:
+      EXPECT_EQ (memcmp (packed, repacked, 5), 0);
+    }
+}
+
+TEST_F (basicfpTest, FaddTrapAddsTheMemoryOperandAndReturns)
+{
+  // given:
+  BasicFpReport report = Verified ();
+  ASSERT_TRUE (basicfp_install (hle, BASICFP_FADD, &report));
+  basicfp_set_fac (&cpu, Float (1.5L));
+  SetOperand (2.25L);
+  cpu.Memory[0x01FF] = 0x02;
+  cpu.Memory[0x01FE] = 0x02;
+  cpu.SP = 0xFD;
+  cpu.PC = basicfp_entries[BASICFP_FADD];
+
+  // when:
+  Sint32 cycles = hle_run (&cpu, hle);
+
+  // then:
+  EXPECT_GT (cycles, 0);
+  EXPECT_EQ (cpu.PC, 0x0203);
+  EXPECT_EQ (cpu.SP, 0xFF);
+  EXPECT_EQ (Fac (), 3.75L);
+  EXPECT_EQ (cpu.Memory[BASICFP_ARG], 0x82); // Loaded as the ROM does
+}
+
+TEST_F (basicfpTest, FsubtSubtractsFacFromArg)
+{
+  // given:
+  basicfp_set_fac (&cpu, Float (4.0L));
+  SetArg (10.0L);
+
+  // when:
+  ASSERT_TRUE (basicfp_run (&cpu, BASICFP_FSUBT));
+
+  // then:
+  EXPECT_EQ (Fac (), 6.0L);
+}
+
+TEST_F (basicfpTest, CancellationGivesZero)
+{
+  // given:
+  basicfp_set_fac (&cpu, Float (-7.0L));
+  SetOperand (7.0L);
+
+  // when:
+  ASSERT_TRUE (basicfp_run (&cpu, BASICFP_FADD));
+
+  // then:
+  EXPECT_EQ (cpu.Memory[BASICFP_FAC], 0);
+  EXPECT_EQ (cpu.Memory[BASICFP_FAC_SIGN], 0);
+}
+
+TEST_F (basicfpTest, OneThirdRoundsUpWhenPacked)
+{
+  // given:
+  basicfp_set_fac (&cpu, Float (3.0L));
+  SetOperand (1.0L);
+
+  // when:
+  ASSERT_TRUE (basicfp_run (&cpu, BASICFP_FDIV));
+
+  // then:
+  Byte packed[5];
+  basicfp_pack (basicfp_fac (&cpu), packed);
+  Byte third[] = { 0x7F, 0x2A, 0xAA, 0xAA, 0xAB };
+  EXPECT_EQ (memcmp (packed, third, 5), 0);
+}
+
+TEST_F (basicfpTest, ArithmeticIsWithinTheRoundingByte)
+{
+  srand (4343);
+  for (int i = 0; i < 3000; i++)
+    {
+      // given:
+      long double a = ldexpl ((rand () % 200000 - 100000) / 1000.0L,
+                              rand () % 40 - 20);
+      long double b = ldexpl ((rand () % 200000 - 100000) / 1000.0L,
+                              rand () % 40 - 20);
+      if (b == 0)
+        {
+          continue;
+        }
+      BasicFpRoutine routine = (BasicFpRoutine)(BASICFP_FSUB + 2 * (i % 4));
+      basicfp_set_fac (&cpu, Float (b));
+      SetOperand (a);
+      long double x = basicfp_to_host (basicfp_unpack (&cpu.Memory[0x033C]));
+      long double y = Fac ();
+      if (routine == BASICFP_FDIV)
+        {
+          // The ROM rounds the divisor first
+          Byte divisor[5];
+          basicfp_pack (basicfp_fac (&cpu), divisor);
+          y = basicfp_to_host (basicfp_unpack (divisor));
+        }
+      long double exact = routine == BASICFP_FSUB    ? x - y
+                          : routine == BASICFP_FADD  ? x + y
+                          : routine == BASICFP_FMULT ? x * y
+                                                     : x / y;
+
+      // when:
+      ASSERT_TRUE (basicfp_run (&cpu, routine));
+
+      // then: 40 bits less truncation, and only 34 quotient bits
+      long double precision = routine == BASICFP_FDIV ? 0x1p-32L : 0x1p-36L;
+      EXPECT_NEAR (Fac (), exact, fabsl (exact) * precision)
+          << "routine " << routine << ": " << (double)x << ", " << (double)y;
+    }
+}
+
+TEST_F (basicfpTest, ErrorsAreLeftToTheRom)
+{
+  // given: overflow
+  basicfp_set_fac (&cpu, Float (1e30L));
+  SetOperand (1e30L);
+  CPU before = cpu;
+
+  // then:
+  EXPECT_FALSE (basicfp_run (&cpu, BASICFP_FMULT));
+  EXPECT_EQ (memcmp (cpu.Memory, before.Memory, MAX_MEMORY), 0);
+
+  // given: division by zero
+  cpu.Memory[BASICFP_FAC] = 0;
+
+  // then:
+  EXPECT_FALSE (basicfp_run (&cpu, BASICFP_FDIV));
+}
+
+TEST_F (basicfpTest, InstallRefusesUnverifiedRoutines)
+{
+  // given:
+  BasicFpReport report = Verified ();
+  report.samples[BASICFP_FADD] = 0;
+  report.mismatches[BASICFP_FDIV] = 1;
+
+  // then: unsampled and mismatched routines stay on the ROM path
+  EXPECT_FALSE (basicfp_install (hle, BASICFP_FADD, &report));
+  EXPECT_FALSE (basicfp_install (hle, BASICFP_FDIV, &report));
+  EXPECT_EQ (hle_find (hle, basicfp_entries[BASICFP_FADD]), nullptr);
+  EXPECT_EQ (hle_find (hle, basicfp_entries[BASICFP_FDIV]), nullptr);
+
+  // when:
+  ASSERT_TRUE (basicfp_install (hle, BASICFP_FMULT, &report));
+
+  // then: the ROM's mean cost is charged
+  const HleTrap *trap = hle_find (hle, basicfp_entries[BASICFP_FMULT]);
+  ASSERT_NE (trap, nullptr);
+  EXPECT_EQ (trap->cycles, 200);
+}
+
+TEST_F (basicfpTest, VerificationArmsNothingAgainstADifferentRom)
+{
+  // given: a "ROM" whose routines all return at once
+  Byte *rom = (Byte *)calloc (MAX_MEMORY, 1);
+  for (int i = 0; i < BASICFP_ROUTINES; i++)
+    {
+      rom[basicfp_entries[i]] = INS_RTS;
+    }
+  BasicFpReport report;
+
+  // when:
+  EXPECT_TRUE (basicfp_verify (hle, rom, 50, 1, &report));
+
+  // then:
+  for (int i = 0; i < BASICFP_ROUTINES; i++)
+    {
+      EXPECT_GT (report.samples[i], 0u) << i;
+      EXPECT_GT (report.mismatches[i], 0u) << i;
+      EXPECT_FALSE (report.armed[i]) << i;
+      EXPECT_EQ (hle_find (hle, basicfp_entries[i]), nullptr);
+    }
+  EXPECT_EQ (report.romCycles[BASICFP_FDIVT],
+             6u * report.samples[BASICFP_FDIVT]);
+  free (rom);
+}
+
+#ifdef ACE64_HLE
+TEST_F (basicfpTest, ExecuteMultipliesWithoutRom)
+{
+  // given:
+  // $0200: LDA #$3C
+  // $0202: LDY #$03
+  // $0204: JSR $BA28
+  Byte program[] = { INS_LDA_IM, 0x3C, INS_LDY_IM, 0x03, INS_JSR_ABS,
+                     0x28,       0xBA };
+  memcpy (&cpu.Memory[0x0200], program, sizeof (program));
+  basicfp_pack (Float (-2.5L), &cpu.Memory[0x033C]);
+  basicfp_set_fac (&cpu, Float (4.0L));
+  BasicFpReport report = Verified ();
+  ASSERT_TRUE (basicfp_install (hle, BASICFP_FMULT, &report));
+  hle_attach (&cpu, hle);
+
+  // when:
+  while (cpu.PC != 0x0207)
+    {
+      execute (&cpu);
+    }
+
+  // then:
+  EXPECT_EQ (Fac (), -10.0L);
+  EXPECT_EQ (hle_find (hle, basicfp_entries[BASICFP_FMULT])->calls, 1u);
+}
+#endif
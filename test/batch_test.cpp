@@ -0,0 +1,201 @@
+#include "../code/batch.h"
+#include "../code/cpu.h"
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+
+class batchTest : public testing::Test
+{
+public:
+  BatchJob job;
+  char error[128];
+  char directory[32];
+
+  virtual void
+  SetUp ()
+  {
+    strcpy (directory, "/tmp/ace64_batchXXXXXX");
+    ASSERT_NE (mkdtemp (directory), nullptr);
+  }
+
+  virtual void
+  TearDown ()
+  {
+    std::string command = std::string ("rm -rf ") + directory;
+    system (command.c_str ());
+  }
+
+  int
+  Parse (const char *line)
+  {
+    return batch_parse_job (line, strlen (line), &job, error,
+                            sizeof (error));
+  }
+
+  std::string
+  WriteFile (const char *name, const void *bytes, size_t length)
+  {
+    std::string path = std::string (directory) + "/" + name;
+    FILE *file = fopen (path.c_str (), "wb");
+    fwrite (bytes, 1, length, file);
+    fclose (file);
+    return path;
+  }
+
+  // Runs the manifest text and returns the result lines.
+  std::set<std::string>
+  Run (const std::string &manifest, int threads, BatchStats *stats)
+  {
+    std::string path
+        = WriteFile ("jobs.txt", manifest.data (), manifest.size ());
+    FILE *out = tmpfile ();
+    BatchOptions options = { threads };
+    EXPECT_TRUE (batch_run (path.c_str (), out, &options, stats));
+
+    rewind (out);
+    std::set<std::string> lines;
+    char line[1024];
+    while (fgets (line, sizeof (line), out) != NULL)
+      {
+        line[strcspn (line, "\n")] = '\0';
+        lines.insert (line);
+      }
+    fclose (out);
+    return lines;
+  }
+};
+
+TEST_F (batchTest, ParsesAJobLine)
+{
+  // when:
+  int parsed = Parse ("id=t1 image=a.bin load=C000 pc=$C010 a=7F sp=F0 "
+                      "cycles=1000 stop=C020 stop=C030 brk=0 dump=0-F");
+
+  // then:
+  ASSERT_EQ (parsed, 1) << error;
+  EXPECT_STREQ (job.id, "t1");
+  EXPECT_STREQ (job.image, "a.bin");
+  EXPECT_EQ (job.load, 0xC000);
+  EXPECT_TRUE (job.pcGiven);
+  EXPECT_EQ (job.pc, 0xC010);
+  EXPECT_EQ (job.A, 0x7F);
+  EXPECT_EQ (job.SP, 0xF0);
+  EXPECT_EQ (job.P, FLAG_UNDEFINED | FLAG_INTERRUPT_DISABLE);
+  EXPECT_EQ (job.maxCycles, 1000u);
+  EXPECT_EQ (job.stopCount, 2);
+  EXPECT_EQ (job.stops[1], 0xC030);
+  EXPECT_FALSE (job.brk);
+  EXPECT_TRUE (job.selfLoop);
+  EXPECT_EQ (job.dumpCount, 1);
+  EXPECT_EQ (job.dumps[0].high, 0x000F);
+}
+
+TEST_F (batchTest, SkipsCommentsAndRejectsBadFields)
+{
+  EXPECT_EQ (Parse ("   # a comment"), 0);
+  EXPECT_EQ (Parse (""), 0);
+  EXPECT_EQ (Parse ("load=0200"), -1);
+  EXPECT_STREQ (error, "no image");
+  EXPECT_EQ (Parse ("image=a.bin a=100"), -1);
+  EXPECT_STREQ (error, "bad value: a=100");
+  EXPECT_EQ (Parse ("image=a.bin dump=20-10"), -1);
+  EXPECT_EQ (Parse ("image=a.bin colour=blue"), -1);
+  EXPECT_EQ (Parse ("image=a.bin loose"), -1);
+}
+
+TEST_F (batchTest, RunsJobsAcrossThreads)
+{
+  // given:
+  // $0200: INX
+  // $0201: STX $10
+  // $0203: CPX #$08
+  // $0205: BNE $0200
+  // $0207: BRK
+  Byte count[] = { INS_INX, INS_STX_ZP, 0x10, INS_CPX_IM, 0x08,
+                   INS_BNE, 0xF9,       INS_BRK };
+  WriteFile ("count.bin", count, sizeof (count));
+  // A PRG at $C000: JMP $C000
+  Byte spin[] = { 0x00, 0xC0, INS_JMP_ABS, 0x00, 0xC0 };
+  WriteFile ("spin.prg", spin, sizeof (spin));
+
+  std::ostringstream manifest;
+  manifest << "# counting jobs\n";
+  for (int i = 0; i < 200; i++)
+    {
+      manifest << "id=c" << i << " image=count.bin x=" << (i % 4)
+               << " dump=10-10\n";
+    }
+  manifest << "id=spin image=spin.prg prg=1 selfloop=0 cycles=300\r\n";
+  manifest << "id=missing image=nothing.bin\n";
+  manifest << "image=count.bin bogus=1";
+
+  // when:
+  BatchStats stats;
+  std::set<std::string> lines = Run (manifest.str (), 4, &stats);
+
+  // then:
+  EXPECT_EQ (stats.jobs, 203u);
+  EXPECT_EQ (stats.failed, 2u);
+  EXPECT_EQ (lines.size (), 203u);
+  EXPECT_EQ (lines.count ("missing error cannot read image"), 1u);
+  EXPECT_EQ (lines.count ("204 error unknown field: bogus=1"), 1u);
+
+  bool sawCount = false, sawSpin = false;
+  for (const std::string &line : lines)
+    {
+      if (line.rfind ("c1 ", 0) == 0)
+        {
+          // x starts at 1: 7 passes of 4 instructions, stopped before BRK
+          sawCount = true;
+          EXPECT_NE (line.find ("c1 brk pc=0207 a=00 x=08"), std::string::npos)
+              << line;
+          EXPECT_NE (line.find ("instructions=28 "), std::string::npos);
+          EXPECT_NE (line.find (" dump=0010:08"), std::string::npos);
+        }
+      if (line.rfind ("spin ", 0) == 0)
+        {
+          sawSpin = true;
+          EXPECT_EQ (line.find ("spin cycles pc=C000"), 0u) << line;
+          EXPECT_NE (line.find ("cycles=300 "), std::string::npos);
+        }
+    }
+  EXPECT_TRUE (sawCount);
+  EXPECT_TRUE (sawSpin);
+}
+
+TEST_F (batchTest, JobsStartFromResetMemory)
+{
+  // given:
+  // $0200: LDA #$55
+  // $0202: STA $00
+  // $0204: BRK
+  Byte poke[] = { INS_LDA_IM, 0x55, INS_STA_ZP, 0x00, INS_BRK };
+  WriteFile ("poke.bin", poke, sizeof (poke));
+
+  // when: one worker, so the second job reuses the first one's CPU
+  BatchStats stats;
+  std::set<std::string> lines
+      = Run ("id=a image=poke.bin dump=0-1\n"
+             "id=b image=poke.bin pc=0204 dump=0-1\n",
+             1, &stats);
+
+  // then: the processor port as after reset()
+  ASSERT_EQ (lines.size (), 2u);
+  EXPECT_NE (lines.begin ()->find (" dump=0000:5507 "), std::string::npos)
+      << *lines.begin ();
+  EXPECT_NE (lines.rbegin ()->find (" dump=0000:FF07 "), std::string::npos)
+      << *lines.rbegin ();
+}
+
+TEST_F (batchTest, MissingManifestFails)
+{
+  BatchStats stats;
+  BatchOptions options = { 1 };
+  EXPECT_FALSE (batch_run ("/nonexistent/jobs.txt", stdout, &options,
+                           &stats));
+}
@@ -0,0 +1,178 @@
+#include "../code/breakpoints.h"
+#include "../code/cpu.h"
+#include <gtest/gtest.h>
+
+class breakpointsTest : public testing::Test
+{
+public:
+  CPU cpu;
+  Breakpoints breakpoints;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    breakpoints_init (&breakpoints);
+
+    // $0200: LDX #$00
+    // $0202: INX
+    // $0203: STX $10
+    // $0205: LDA $10
+    // $0207: JMP $0202
+    Byte program[] = { INS_LDX_IM, 0x00, INS_INX,     INS_STX_ZP, 0x10,
+                       INS_LDA_ZP, 0x10, INS_JMP_ABS, 0x02,       0x02 };
+    for (unsigned i = 0; i < sizeof (program); i++)
+      {
+        cpu.Memory[0x0200 + i] = program[i];
+      }
+    cpu.PC = 0x0200;
+  }
+};
+
+TEST_F (breakpointsTest, ConditionOperators)
+{
+  // given:
+  cpu.A = 0x40;
+  BreakCondition equal = { REGISTER_A, CONDITION_EQUAL, 0x40 };
+  BreakCondition less = { REGISTER_A, CONDITION_LESS, 0x40 };
+  BreakCondition bits = { REGISTER_VALUE, CONDITION_BITS_SET, 0x81 };
+  BreakCondition clear = { REGISTER_VALUE, CONDITION_BITS_CLEAR, 0x81 };
+
+  // then:
+  EXPECT_TRUE (breakpoints_condition_holds (&cpu, &equal, 0));
+  EXPECT_FALSE (breakpoints_condition_holds (&cpu, &less, 0));
+  EXPECT_TRUE (breakpoints_condition_holds (&cpu, &bits, 0x01));
+  EXPECT_FALSE (breakpoints_condition_holds (&cpu, &clear, 0x80));
+}
+
+TEST_F (breakpointsTest, RemovingBreakpointsClearsBitmaps)
+{
+  // given:
+  int range = breakpoints_add (&breakpoints, BREAK_EXECUTE, 0x10, 0x1F, NULL);
+  int single = breakpoints_add (&breakpoints, BREAK_EXECUTE, 0x18, 0x18, NULL);
+
+  // when:
+  bool removed = breakpoints_remove (&breakpoints, range);
+
+  // then:
+  EXPECT_TRUE (removed);
+  EXPECT_FALSE (breakpoints_test (breakpoints.bits[BREAK_EXECUTE], 0x10));
+  EXPECT_TRUE (breakpoints_test (breakpoints.bits[BREAK_EXECUTE], 0x18));
+  EXPECT_FALSE (breakpoints_remove (&breakpoints, range));
+  EXPECT_TRUE (breakpoints_remove (&breakpoints, single));
+  EXPECT_EQ (breakpoints.count, 0);
+}
+
+TEST_F (breakpointsTest, ExecuteBreakpointStopsBeforeInstruction)
+{
+  // given:
+  int id = breakpoints_add (&breakpoints, BREAK_EXECUTE, 0x0205, 0x0205,
+                            NULL);
+
+  // when:
+  Uint64 cycles;
+  Uint64 executed = breakpoints_run (&cpu, &breakpoints, 100, &cycles);
+
+  // then:
+  EXPECT_EQ (executed, 3u);
+  EXPECT_EQ (cycles, 7u);
+  EXPECT_EQ (cpu.PC, 0x0205);
+  EXPECT_EQ (cpu.A, 0x00); // LDA $10 has not run
+  EXPECT_TRUE (breakpoints.hit.triggered);
+  EXPECT_EQ (breakpoints.hit.id, id);
+  EXPECT_EQ (breakpoints.hit.kind, BREAK_EXECUTE);
+  EXPECT_EQ (breakpoints.hit.value, INS_LDA_ZP);
+}
+
+TEST_F (breakpointsTest, ResumeRunsTheInstructionUnderTheBreakpoint)
+{
+  // given:
+  breakpoints_add (&breakpoints, BREAK_EXECUTE, 0x0205, 0x0205, NULL);
+  breakpoints_run (&cpu, &breakpoints, 100, NULL);
+
+  // when:
+  breakpoints_resume (&breakpoints);
+  Uint64 executed = breakpoints_run (&cpu, &breakpoints, 100, NULL);
+
+  // then:
+  EXPECT_EQ (executed, 4u); // LDA, JMP, INX, STX
+  EXPECT_EQ (cpu.PC, 0x0205);
+  EXPECT_EQ (cpu.A, 0x01);
+  EXPECT_EQ (cpu.X, 0x02);
+}
+
+TEST_F (breakpointsTest, ConditionalBreakpointOnlyStopsWhenConditionHolds)
+{
+  // given:
+  BreakCondition condition = { REGISTER_X, CONDITION_EQUAL, 0x05 };
+  breakpoints_add (&breakpoints, BREAK_EXECUTE, 0x0203, 0x0203, &condition);
+
+  // when:
+  breakpoints_run (&cpu, &breakpoints, 1000, NULL);
+
+  // then:
+  EXPECT_TRUE (breakpoints.hit.triggered);
+  EXPECT_EQ (cpu.PC, 0x0203);
+  EXPECT_EQ (cpu.X, 0x05);
+  EXPECT_EQ (cpu.Memory[0x10], 0x04);
+}
+
+#ifdef ACE64_WATCHPOINTS
+TEST_F (breakpointsTest, RangeWriteWatchpointReportsAccess)
+{
+  // given:
+  breakpoints_add (&breakpoints, BREAK_WRITE, 0x0008, 0x0017, NULL);
+
+  // when:
+  Uint64 executed = breakpoints_run (&cpu, &breakpoints, 100, NULL);
+
+  // then:
+  EXPECT_EQ (executed, 3u); // LDX, INX, STX - the STX completes
+  EXPECT_EQ (cpu.PC, 0x0205);
+  EXPECT_EQ (breakpoints.hit.kind, BREAK_WRITE);
+  EXPECT_EQ (breakpoints.hit.address, 0x0010);
+  EXPECT_EQ (breakpoints.hit.value, 0x01);
+  EXPECT_EQ (breakpoints.hit.pc, 0x0203);
+}
+
+TEST_F (breakpointsTest, ReadWatchpointWithValueCondition)
+{
+  // given:
+  BreakCondition condition = { REGISTER_VALUE, CONDITION_GREATER_EQUAL, 3 };
+  breakpoints_add (&breakpoints, BREAK_READ, 0x0010, 0x0010, &condition);
+
+  // when:
+  breakpoints_run (&cpu, &breakpoints, 1000, NULL);
+
+  // then:
+  EXPECT_EQ (breakpoints.hit.kind, BREAK_READ);
+  EXPECT_EQ (breakpoints.hit.value, 3);
+  EXPECT_EQ (breakpoints.hit.pc, 0x0205);
+  EXPECT_EQ (cpu.A, 3);
+}
+
+TEST_F (breakpointsTest, AccessorsAreUnhookedOutsideRun)
+{
+  // given:
+  breakpoints_add (&breakpoints, BREAK_WRITE, 0x0010, 0x0010, NULL);
+  breakpoints_run (&cpu, &breakpoints, 100, NULL);
+  breakpoints_resume (&breakpoints);
+
+  // when:
+  for (int i = 0; i < 10; i++)
+    {
+      execute (&cpu);
+    }
+
+  // then:
+  EXPECT_EQ (cpu.breakpoints, nullptr);
+  EXPECT_FALSE (breakpoints.hit.triggered);
+}
+#else
+TEST_F (breakpointsTest, WatchpointsNeedWatchpointBuild)
+{
+  EXPECT_EQ (breakpoints_add (&breakpoints, BREAK_READ, 0x10, 0x10, NULL), -1);
+  EXPECT_EQ (breakpoints_add (&breakpoints, BREAK_WRITE, 0x10, 0x10, NULL), -1);
+  EXPECT_EQ (breakpoints.count, 0);
+}
+#endif
@@ -0,0 +1,147 @@
+#include "../code/codemap.h"
+#include "../code/cpu.h"
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+class codemapTest : public testing::Test
+{
+public:
+  CPU cpu;
+  CodeMap *map;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    map = (CodeMap *)malloc (sizeof (CodeMap));
+    codemap_clear (map);
+  }
+  virtual void
+  TearDown ()
+  {
+    free (map);
+  }
+
+  std::string
+  Written (bool (*write) (const CodeMap *, FILE *))
+  {
+    FILE *file = tmpfile ();
+    EXPECT_TRUE (write (map, file));
+    std::string text (ftell (file), '\0');
+    rewind (file);
+    EXPECT_EQ (fread (&text[0], 1, text.size (), file), text.size ());
+    fclose (file);
+    return text;
+  }
+};
+
+TEST_F (codemapTest, ClassifiesByAttributes)
+{
+  // when:
+  codemap_execute (map, 0x0200);
+  codemap_execute (map, 0x0201);
+  codemap_read (map, 0x0201);
+  codemap_write (map, 0x0300);
+  codemap_write (map, 0x0200);
+
+  // then:
+  EXPECT_EQ (codemap_class (map, 0x0100), CODEMAP_UNUSED);
+  EXPECT_EQ (codemap_class (map, 0x0300), CODEMAP_DATA);
+  EXPECT_EQ (codemap_class (map, 0x0201), CODEMAP_CODE_AND_DATA);
+  EXPECT_EQ (codemap_class (map, 0x0200), CODEMAP_SELF_MODIFIED);
+  EXPECT_EQ (map->codePageWrites[0x02], 1u);
+  EXPECT_EQ (map->codePageWrites[0x03], 0u);
+}
+
+TEST_F (codemapTest, WritingBeforeExecutingIsNotSelfModifying)
+{
+  // when:
+  codemap_write (map, 0x0400);
+  codemap_execute (map, 0x0400);
+
+  // then:
+  EXPECT_EQ (codemap_class (map, 0x0400), CODEMAP_CODE_AND_DATA);
+  EXPECT_EQ (map->hotspotCount, 0u);
+}
+
+TEST_F (codemapTest, HotspotsAreSortedByCount)
+{
+  // given:
+  codemap_execute (map, 0x0201);
+  codemap_execute (map, 0x0301);
+  for (int i = 0; i < 3; i++)
+    {
+      map->instructionPC = 0x0400;
+      codemap_write (map, 0x0301);
+    }
+  map->instructionPC = 0x0500;
+  codemap_write (map, 0x0201);
+
+  // when:
+  CodeMapHotspot hotspots[4];
+  Uint32 count = codemap_hotspots (map, hotspots, 4);
+
+  // then:
+  ASSERT_EQ (count, 2u);
+  EXPECT_EQ (hotspots[0].writerPC, 0x0400);
+  EXPECT_EQ (hotspots[0].address, 0x0301);
+  EXPECT_EQ (hotspots[0].count, 3u);
+  EXPECT_EQ (hotspots[1].writerPC, 0x0500);
+}
+
+TEST_F (codemapTest, MapListsRunsOfOneClass)
+{
+  // given:
+  for (Word address = 0x0200; address < 0x0210; address++)
+    {
+      codemap_execute (map, address);
+    }
+  codemap_write (map, 0x0210);
+  codemap_read (map, 0xFFFF);
+
+  // then:
+  EXPECT_EQ (Written (codemap_write_map), "$0200-$020F code\n"
+                                          "$0210-$0210 data\n"
+                                          "$FFFF-$FFFF data\n");
+}
+
+#ifdef ACE64_CODEMAP
+TEST_F (codemapTest, DetectsPatchedImmediate)
+{
+  // given:
+  // $0200: LDA #$00
+  // $0202: CLC
+  // $0203: ADC #$01
+  // $0205: STA $0201   ; patches the LDA operand
+  // $0208: JMP $0200
+  Byte program[] = { INS_LDA_IM,  0x00, INS_CLC,     INS_ADC_IM, 0x01,
+                     INS_STA_ABS, 0x01, 0x02,        INS_JMP_ABS, 0x00,
+                     0x02 };
+  for (unsigned i = 0; i < sizeof (program); i++)
+    {
+      cpu.Memory[0x0200 + i] = program[i];
+    }
+  cpu.PC = 0x0200;
+  codemap_attach (&cpu, map);
+
+  // when:
+  for (int i = 0; i < 5 * 5; i++)
+    {
+      execute (&cpu);
+    }
+
+  // then:
+  CodeMapHotspot hotspots[2];
+  ASSERT_EQ (codemap_hotspots (map, hotspots, 2), 1u);
+  EXPECT_EQ (hotspots[0].writerPC, 0x0205);
+  EXPECT_EQ (hotspots[0].address, 0x0201);
+  EXPECT_EQ (hotspots[0].count, 5u);
+  EXPECT_EQ (cpu.Memory[0x0201], 5);
+  EXPECT_EQ (codemap_class (map, 0x0201), CODEMAP_SELF_MODIFIED);
+  EXPECT_EQ (codemap_class (map, 0x0202), CODEMAP_CODE);
+  EXPECT_EQ (map->codePageWrites[0x02], 5u);
+}
+#endif
@@ -0,0 +1,191 @@
+#include "../code/cpu.h"
+#include "../code/explore.h"
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+
+class exploreTest : public testing::Test
+{
+public:
+  CPU *cpu;
+  CPU *best;
+  Byte bestInputs[8];
+  Byte alphabet[2] = { 1, 2 };
+  ExploreOptions options;
+  ExploreStats stats;
+
+  virtual void
+  SetUp ()
+  {
+    cpu = (CPU *)malloc (sizeof (CPU));
+    best = (CPU *)malloc (sizeof (CPU));
+    reset (cpu);
+
+    // A "game" that adds each input to a total, one input per frame:
+    // $0200: LDA $F0
+    // $0202: CLC
+    // $0203: ADC $10
+    // $0205: STA $10
+    // $0207: LDA #$00
+    // $0209: STA $F0
+    // $020B: JMP $0200
+    Byte program[] = { INS_LDA_ZP, 0xF0,       INS_CLC,    INS_ADC_ZP,
+                       0x10,       INS_STA_ZP, 0x10,       INS_LDA_IM,
+                       0x00,       INS_STA_ZP, 0xF0,       INS_JMP_ABS,
+                       0x00,       0x02 };
+    for (unsigned i = 0; i < sizeof (program); i++)
+      {
+        cpu->Memory[0x0200 + i] = program[i];
+      }
+    cpu->PC = 0x0200;
+
+    memset (&options, 0, sizeof (options));
+    options.threads = 1;
+    options.inputAddress = 0x00F0;
+    options.inputs = alphabet;
+    options.inputCount = 2;
+    options.stepLimit = 100;
+    options.stopAtPC = true;
+    options.stopPC = 0x0200;
+    options.maxDepth = 4;
+    options.score = Total;
+  }
+
+  virtual void
+  TearDown ()
+  {
+    free (best);
+    free (cpu);
+  }
+
+  static double
+  Total (const CPU *cpu, int depth, void *user)
+  {
+    return cpu->Memory[0x10];
+  }
+
+  static double
+  EvenTotal (const CPU *cpu, int depth, void *user)
+  {
+    return cpu->Memory[0x10] % 2 == 0 ? cpu->Memory[0x10] : -1.0;
+  }
+};
+
+TEST_F (exploreTest, BreadthFirstPrunesDuplicateStates)
+{
+  for (int threads : { 1, 4 })
+    {
+      // given:
+      options.threads = threads;
+
+      // when:
+      ASSERT_TRUE (explore_run (cpu, &options, &stats, best, bestInputs));
+
+      // then: totals 1..8 are each reached once; every other path is a
+      // duplicate
+      EXPECT_EQ (stats.expanded, 7u);
+      EXPECT_EQ (stats.children, 14u);
+      EXPECT_EQ (stats.duplicates, 6u);
+      EXPECT_TRUE (stats.found);
+      EXPECT_EQ (stats.bestScore, 8.0);
+      EXPECT_EQ (stats.bestDepth, 4);
+      EXPECT_EQ (best->Memory[0x10], 8);
+      EXPECT_EQ (best->PC, 0x0200);
+      for (int i = 0; i < 4; i++)
+        {
+          EXPECT_EQ (bestInputs[i], 2);
+        }
+      EXPECT_EQ (cpu->Memory[0x10], 0); // The root is untouched
+    }
+}
+
+TEST_F (exploreTest, ChildrenShareUnchangedChunks)
+{
+  // when:
+  ASSERT_TRUE (explore_run (cpu, &options, &stats, NULL, NULL));
+
+  // then: the root owns every chunk; each child only the one it wrote
+  EXPECT_GT (stats.peakStates, 1u);
+  EXPECT_LT (stats.peakChunks, (size_t)EXPLORE_CHUNKS + stats.peakStates);
+}
+
+TEST_F (exploreTest, DepthFirstExpandsBestChildFirst)
+{
+  // given:
+  options.order = EXPLORE_DEPTH_FIRST;
+  options.childLimit = 8; // Root, then 2, 4 and 6
+
+  // when:
+  ASSERT_TRUE (explore_run (cpu, &options, &stats, best, bestInputs));
+
+  // then:
+  EXPECT_EQ (stats.children, 8u);
+  EXPECT_EQ (stats.bestScore, 8.0);
+  EXPECT_EQ (best->Memory[0x10], 8);
+}
+
+TEST_F (exploreTest, DepthFirstVisitsEveryStateOnce)
+{
+  for (int threads : { 1, 4 })
+    {
+      // given:
+      options.order = EXPLORE_DEPTH_FIRST;
+      options.threads = threads;
+
+      // when:
+      ASSERT_TRUE (explore_run (cpu, &options, &stats, NULL, NULL));
+
+      // then:
+      EXPECT_EQ (stats.children - stats.duplicates, 8u);
+      EXPECT_EQ (stats.bestScore, 8.0);
+    }
+}
+
+TEST_F (exploreTest, BeamKeepsBestStatesOfEachLevel)
+{
+  // given:
+  options.beamWidth = 1;
+
+  // when:
+  ASSERT_TRUE (explore_run (cpu, &options, &stats, NULL, bestInputs));
+
+  // then:
+  EXPECT_EQ (stats.children, 8u);
+  EXPECT_EQ (stats.dropped, 3u);
+  EXPECT_EQ (stats.bestScore, 8.0);
+}
+
+TEST_F (exploreTest, NegativeScorePrunes)
+{
+  // given:
+  options.score = EvenTotal;
+
+  // when:
+  ASSERT_TRUE (explore_run (cpu, &options, &stats, NULL, NULL));
+
+  // then: only the all-2 path survives
+  EXPECT_EQ (stats.children, 8u);
+  EXPECT_EQ (stats.pruned, 4u);
+  EXPECT_EQ (stats.bestScore, 8.0);
+}
+
+TEST_F (exploreTest, UnimplementedOpcodeHaltsChild)
+{
+  // given:
+  cpu->Memory[0x020B] = 0xFF; // No handler: children stop instead of looping
+
+  // when:
+  ASSERT_TRUE (explore_run (cpu, &options, &stats, NULL, NULL));
+
+  // then:
+  EXPECT_EQ (stats.children, 2u);
+  EXPECT_EQ (stats.halted, 2u);
+  EXPECT_EQ (stats.expanded, 1u);
+}
+
+TEST_F (exploreTest, RejectsEmptyAlphabet)
+{
+  options.inputCount = 0;
+  EXPECT_FALSE (explore_run (cpu, &options, &stats, NULL, NULL));
+}
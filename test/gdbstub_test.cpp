@@ -0,0 +1,306 @@
+#include "../code/cpu.h"
+#include "../code/gdbstub.h"
+#include "../code/statehash.h"
+#include "../code/writers.h"
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+class gdbstubTest : public testing::Test
+{
+public:
+  CPU cpu;
+  int client;
+  int server;
+  std::thread stub;
+  GdbSessionEnd end;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+
+    // $0200: LDX #$00
+    // $0202: INX
+    // $0203: STX $10
+    // $0205: LDA $10
+    // $0207: JMP $0202
+    Byte program[] = { INS_LDX_IM, 0x00, INS_INX,     INS_STX_ZP, 0x10,
+                       INS_LDA_ZP, 0x10, INS_JMP_ABS, 0x02,       0x02 };
+    for (unsigned i = 0; i < sizeof (program); i++)
+      {
+        cpu.Memory[0x0200 + i] = program[i];
+      }
+    cpu.PC = 0x0200;
+
+    int fds[2];
+    ASSERT_EQ (socketpair (AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    client = fds[0];
+    server = fds[1];
+    stub = std::thread ([this] () { end = gdbstub_serve (&cpu, server); });
+  }
+
+  virtual void
+  TearDown ()
+  {
+    close (client);
+    if (stub.joinable ())
+      {
+        stub.join ();
+      }
+    close (server);
+  }
+
+  void
+  SendRaw (const std::string &data)
+  {
+    ASSERT_EQ (write (client, data.data (), data.size ()),
+               (ssize_t)data.size ());
+  }
+
+  // Sends a packet and returns the reply, acknowledging both ways.
+  std::string
+  Request (const std::string &payload)
+  {
+    unsigned sum = 0;
+    for (char c : payload)
+      {
+        sum += (unsigned char)c;
+      }
+    char checksum[4];
+    snprintf (checksum, sizeof (checksum), "#%02x", sum & 0xFF);
+    SendRaw ("$" + payload + checksum);
+    return Reply ();
+  }
+
+  std::string
+  Reply ()
+  {
+    std::string reply;
+    char c;
+    bool inPacket = false;
+    while (read (client, &c, 1) == 1)
+      {
+        if (!inPacket)
+          {
+            inPacket = c == '$';
+            continue;
+          }
+        if (c == '#')
+          {
+            char checksum[2];
+            read (client, checksum, 2);
+            SendRaw ("+");
+            return reply;
+          }
+        reply += c;
+      }
+    return reply;
+  }
+
+  static std::string
+  Hex (const std::string &text)
+  {
+    std::string hex;
+    char digits[3];
+    for (char c : text)
+      {
+        snprintf (digits, sizeof (digits), "%02x", (unsigned char)c);
+        hex += digits;
+      }
+    return hex;
+  }
+};
+
+TEST_F (gdbstubTest, ReadsAndWritesRegisters)
+{
+  // when:
+  std::string written = Request ("G01020330043412");
+  std::string registers = Request ("g");
+  std::string pc = Request ("p5");
+  std::string setX = Request ("P1=7f");
+
+  // then:
+  EXPECT_EQ (written, "OK");
+  EXPECT_EQ (registers, "01020330043412");
+  EXPECT_EQ (pc, "3412");
+  EXPECT_EQ (setX, "OK");
+  EXPECT_EQ (cpu.X, 0x7F);
+  EXPECT_EQ (cpu.PC, 0x1234);
+}
+
+TEST_F (gdbstubTest, ServesTheTargetDescription)
+{
+  // when: read in 0x100-byte chunks
+  std::string supported = Request ("qSupported:xmlRegisters=i386");
+  std::string description;
+  std::string chunk = "m";
+  char offset[8];
+  while (chunk[0] == 'm' && description.size () < 65536)
+    {
+      snprintf (offset, sizeof (offset), "%zx", description.size ());
+      chunk = Request (std::string ("qXfer:features:read:target.xml:")
+                       + offset + ",100");
+      ASSERT_FALSE (chunk.empty ());
+      description += chunk.substr (1);
+    }
+  std::string unknown = Request ("qXfer:features:read:other.xml:0,100");
+
+  // then:
+  EXPECT_NE (supported.find ("qXfer:features:read+"), std::string::npos);
+  EXPECT_EQ (chunk[0], 'l');
+  EXPECT_GT (description.size (), 0x100u);
+  EXPECT_EQ (description.find ("<?xml"), 0u);
+  EXPECT_NE (description.find ("<reg name=\"a\" bitsize=\"8\""),
+             std::string::npos);
+  EXPECT_NE (description.find ("<reg name=\"pc\" bitsize=\"16\""),
+             std::string::npos);
+  EXPECT_NE (description.find ("</target>"), std::string::npos);
+  EXPECT_EQ (unknown, "E00");
+}
+
+TEST_F (gdbstubTest, KillEndsTheSession)
+{
+  // when:
+  SendRaw ("$k#6b");
+  stub.join ();
+
+  // then:
+  EXPECT_EQ (end, GDB_KILLED);
+}
+
+TEST_F (gdbstubTest, ReadsAndWritesMemory)
+{
+  // when:
+  std::string written = Request ("M3000,3:a1b2c3");
+  std::string read = Request ("m2fff,5");
+
+  // then:
+  EXPECT_EQ (written, "OK");
+  EXPECT_EQ (read, "00a1b2c300");
+}
+
+TEST_F (gdbstubTest, StepExecutesOneInstruction)
+{
+  // when:
+  std::string stop = Request ("s");
+
+  // then:
+  EXPECT_EQ (stop, "S05");
+  EXPECT_EQ (cpu.PC, 0x0202);
+  EXPECT_EQ (Request ("?"), "S05");
+}
+
+TEST_F (gdbstubTest, ContinueStopsAtInsertedBreakpoint)
+{
+  // when:
+  std::string inserted = Request ("Z0,205,1");
+  std::string stop = Request ("c");
+  std::string again = Request ("c");
+  std::string removed = Request ("z0,205,1");
+
+  // then:
+  EXPECT_EQ (inserted, "OK");
+  EXPECT_EQ (stop, "S05");
+  EXPECT_EQ (again, "S05"); // Resumes past the breakpoint it stopped at
+  EXPECT_EQ (removed, "OK");
+  EXPECT_EQ (cpu.PC, 0x0205);
+  EXPECT_EQ (cpu.X, 0x02);
+}
+
+TEST_F (gdbstubTest, MonitorConditionIsEvaluatedInTheEmulator)
+{
+  // when:
+  Request ("QStartNoAckMode");
+  std::string console = Request ("qRcmd," + Hex ("break 203 if x == 40"));
+  std::string result = Reply ();
+  std::string stop = Request ("c");
+
+  // then:
+  EXPECT_EQ (console, "O" + Hex ("Breakpoint 1 at $0203.\n"));
+  EXPECT_EQ (result, "OK");
+  EXPECT_EQ (stop, "S05");
+  EXPECT_EQ (cpu.PC, 0x0203);
+  EXPECT_EQ (cpu.X, 0x40);
+}
+
+TEST_F (gdbstubTest, InterruptStopsContinue)
+{
+  // given:
+  SendRaw ("$c#63");
+
+  // when:
+  char ack;
+  ASSERT_EQ (read (client, &ack, 1), 1);
+  SendRaw ("\x03");
+  std::string stop = Reply ();
+
+  // then:
+  EXPECT_EQ (ack, '+');
+  EXPECT_EQ (stop, "S02");
+}
+
+#ifdef ACE64_WATCHPOINTS
+TEST_F (gdbstubTest, WriteWatchpointReportsAddress)
+{
+  // when:
+  std::string inserted = Request ("Z2,10,1");
+  std::string stop = Request ("c");
+
+  // then:
+  EXPECT_EQ (inserted, "OK");
+  EXPECT_EQ (stop, "T05watch:10;");
+  EXPECT_EQ (cpu.PC, 0x0205);
+}
+#else
+TEST_F (gdbstubTest, WatchpointsAreUnsupportedWithoutWatchpointBuild)
+{
+  EXPECT_EQ (Request ("Z2,10,1"), "");
+}
+#endif
+
+#ifdef ACE64_LAST_WRITER
+TEST_F (gdbstubTest, MonitorReportsLastWriter)
+{
+  // given:
+  LastWriters writers;
+  writers_clear (&writers);
+  writers_attach (&cpu, &writers);
+  Request ("Z0,205,1");
+  Request ("c");
+
+  // when:
+  std::string written = Request ("qRcmd," + Hex ("writer 10-11"));
+  std::string unwritten = Reply ();
+  std::string result = Reply ();
+
+  // then:
+  EXPECT_EQ (written, "O" + Hex ("$0010  written by $0203 at cycle 4\n"));
+  EXPECT_EQ (unwritten, "O" + Hex ("$0011  not written\n"));
+  EXPECT_EQ (result, "OK");
+  SendRaw ("$k#6b");
+  stub.join (); // Before writers goes out of scope
+}
+#endif
+
+#ifdef ACE64_STATE_HASH
+TEST_F (gdbstubTest, MemoryWritesKeepTheStateHashCurrent)
+{
+  // given:
+  StateHash hash;
+  statehash_attach (&cpu, &hash);
+
+  // when:
+  std::string written = Request ("M3000,2:a1b2");
+
+  // then:
+  EXPECT_EQ (written, "OK");
+  EXPECT_EQ (statehash_value (&cpu), statehash_compute (&cpu));
+  SendRaw ("$k#6b");
+  stub.join (); // Before hash goes out of scope
+}
+#endif
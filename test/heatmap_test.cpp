@@ -0,0 +1,147 @@
+#include "../code/cpu.h"
+#include "../code/heatmap.h"
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+class heatmapTest : public testing::Test
+{
+public:
+  CPU cpu;
+  Heatmap *heatmap;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    heatmap = new Heatmap;
+    heatmap_clear (heatmap);
+  }
+  virtual void
+  TearDown ()
+  {
+    delete heatmap;
+  }
+};
+
+TEST_F (heatmapTest, CountersSaturateInsteadOfWrapping)
+{
+  // given:
+  Uint32 counter = UINT32_MAX - 1;
+
+  // when:
+  heatmap_count (&counter);
+  heatmap_count (&counter);
+
+  // then:
+  EXPECT_EQ (counter, UINT32_MAX);
+}
+
+TEST_F (heatmapTest, PageTotalSumsOnePage)
+{
+  // given:
+  heatmap->reads[0x1200] = 3;
+  heatmap->reads[0x12FF] = 4;
+  heatmap->reads[0x1300] = 100;
+  heatmap->writes[0x1210] = UINT32_MAX;
+
+  // when:
+  Uint32 reads = heatmap_page_total (heatmap, HEATMAP_READ, 0x12);
+  Uint32 all = heatmap_page_total (heatmap, HEATMAP_ALL, 0x12);
+
+  // then:
+  EXPECT_EQ (reads, 7u);
+  EXPECT_EQ (all, UINT32_MAX);
+}
+
+TEST_F (heatmapTest, BinaryDumpRoundTrips)
+{
+  // given:
+  heatmap->reads[0x0000] = 1;
+  heatmap->writes[0x8000] = 0x01020304;
+  heatmap->executes[0xFFFF] = UINT32_MAX;
+  Heatmap *loaded = new Heatmap;
+  FILE *file = tmpfile ();
+
+  // when:
+  bool written = heatmap_write_binary (heatmap, file);
+  long size = ftell (file);
+  rewind (file);
+  bool read = heatmap_read_binary (loaded, file);
+  fclose (file);
+
+  // then:
+  EXPECT_TRUE (written);
+  EXPECT_TRUE (read);
+  EXPECT_EQ (size, 8 + 3 * 4 * MAX_MEMORY);
+  EXPECT_EQ (memcmp (loaded, heatmap, sizeof (Heatmap)), 0);
+  delete loaded;
+}
+
+TEST_F (heatmapTest, PgmIs256By256WithAddressLayout)
+{
+  // given:
+  heatmap->executes[0x0201] = 1;
+  heatmap->executes[0xFF00] = UINT32_MAX;
+  std::vector<char> buffer (70000);
+  FILE *file = fmemopen (buffer.data (), buffer.size (), "w");
+
+  // when:
+  bool written = heatmap_write_pgm (heatmap, HEATMAP_EXECUTE, file);
+  long size = ftell (file);
+  fclose (file);
+
+  // then:
+  const char header[] = "P5\n256 256\n255\n";
+  const unsigned char *pixels
+      = (const unsigned char *)buffer.data () + strlen (header);
+  EXPECT_TRUE (written);
+  EXPECT_EQ (size, (long)(strlen (header) + 65536));
+  EXPECT_EQ (memcmp (buffer.data (), header, strlen (header)), 0);
+  EXPECT_EQ (pixels[0x0200], 0);
+  EXPECT_GT (pixels[0x0201], 0);
+  EXPECT_EQ (pixels[0xFF00], 255);
+}
+
+#ifdef ACE64_HEATMAP
+TEST_F (heatmapTest, AccessorsCountReadsWritesAndExecutes)
+{
+  // given:
+  cpu.PC = 0x0200;
+  cpu.Memory[0x0200] = INS_LDA_ABS;
+  cpu.Memory[0x0201] = 0x00;
+  cpu.Memory[0x0202] = 0x40;
+  cpu.Memory[0x0203] = INS_STA_ZP;
+  cpu.Memory[0x0204] = 0x10;
+  heatmap_attach (&cpu, heatmap);
+
+  // when:
+  execute (&cpu);
+  execute (&cpu);
+
+  // then:
+  EXPECT_EQ (heatmap->executes[0x0200], 1u);
+  EXPECT_EQ (heatmap->executes[0x0202], 1u);
+  EXPECT_EQ (heatmap->executes[0x0204], 1u);
+  EXPECT_EQ (heatmap->reads[0x4000], 1u);
+  EXPECT_EQ (heatmap->writes[0x0010], 1u);
+  EXPECT_EQ (heatmap_page_total (heatmap, HEATMAP_READ, 0x02), 0u);
+}
+
+TEST_F (heatmapTest, DetachedCpuDoesNotCount)
+{
+  // given:
+  cpu.PC = 0x0200;
+  cpu.Memory[0x0200] = INS_LDA_ABS;
+  heatmap_attach (&cpu, heatmap);
+  heatmap_attach (&cpu, NULL);
+
+  // when:
+  execute (&cpu);
+
+  // then:
+  EXPECT_EQ (heatmap->executes[0x0200], 0u);
+}
+#endif
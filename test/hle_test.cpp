@@ -0,0 +1,367 @@
+#include "../code/cpu.h"
+#include "../code/hle.h"
+#include "../code/writers.h"
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+class hleTest : public testing::Test
+{
+public:
+  CPU cpu;
+  Hle *hle;
+  HleDevice device;
+  std::string output;
+  std::string keys;
+  std::string saved;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    hle = (Hle *)malloc (sizeof (Hle));
+    hle_clear (hle);
+    memset (&device, 0, sizeof (device));
+    device.output = Output;
+    device.input = Input;
+    device.load = Load;
+    device.save = Save;
+    device.user = this;
+    ASSERT_TRUE (hle_install_kernal (hle, &device));
+    cpu.PC = 0x0200;
+  }
+
+  virtual void
+  TearDown ()
+  {
+    free (hle);
+  }
+
+  static void
+  Output (Byte character, void *user)
+  {
+    ((hleTest *)user)->output += (char)character;
+  }
+
+  static int
+  Input (void *user)
+  {
+    std::string &keys = ((hleTest *)user)->keys;
+    if (keys.empty ())
+      {
+        return -1;
+      }
+    int key = (Byte)keys[0];
+    keys.erase (0, 1);
+    return key;
+  }
+
+  // One file, "DATA": three bytes for $C000.
+  static long
+  Load (const Byte *name, Byte nameLength, Byte *buffer, size_t capacity,
+        void *user)
+  {
+    if (nameLength != 4 || memcmp (name, "DATA", 4) != 0)
+      {
+        return -1;
+      }
+    Byte file[] = { 0x00, 0xC0, 0x11, 0x22, 0x33 };
+    memcpy (buffer, file, sizeof (file));
+    return sizeof (file);
+  }
+
+  static bool
+  Save (const Byte *name, Byte nameLength, const Byte *data, size_t size,
+        void *user)
+  {
+    ((hleTest *)user)->saved = std::string ((const char *)name, nameLength)
+                               + ":"
+                               + std::string ((const char *)data, size);
+    return true;
+  }
+
+  void
+  Load (Word address, const Byte *bytes, unsigned length)
+  {
+    for (unsigned i = 0; i < length; i++)
+      {
+        cpu.Memory[address + i] = bytes[i];
+      }
+  }
+
+  // Runs the trap at PC as execute() would, with a return to $0203 on the
+  // stack, and returns its cycles.
+  Sint32
+  Call (Word address)
+  {
+    cpu.Memory[0x01FF] = 0x02;
+    cpu.Memory[0x01FE] = 0x02;
+    cpu.SP = 0xFD;
+    cpu.PC = address;
+    return hle_run (&cpu, hle);
+  }
+
+  void
+  SetName (const char *name)
+  {
+    memcpy (&cpu.Memory[0x0340], name, strlen (name));
+    cpu.A = strlen (name);
+    cpu.X = 0x40;
+    cpu.Y = 0x03;
+    ASSERT_GT (Call (HLE_SETNAM), 0);
+  }
+};
+
+TEST_F (hleTest, ChroutOutputsAndReturns)
+{
+  // given:
+  cpu.A = 'A';
+  cpu.X = 0x12;
+  cpu.P |= FLAG_CARRY;
+
+  // when:
+  Sint32 cycles = Call (HLE_CHROUT);
+
+  // then:
+  EXPECT_EQ (cycles, HLE_CYCLES_CHROUT);
+  EXPECT_EQ (output, "A");
+  EXPECT_EQ (cpu.PC, 0x0203);
+  EXPECT_EQ (cpu.SP, 0xFF);
+  EXPECT_EQ (cpu.A, 'A');
+  EXPECT_EQ (cpu.X, 0x12);
+  EXPECT_FALSE (cpu.P & FLAG_CARRY);
+  EXPECT_EQ (hle_find (hle, HLE_CHROUT)->calls, 1u);
+}
+
+TEST_F (hleTest, GetinReturnsQueuedKeysThenZero)
+{
+  // given:
+  keys = "Q";
+
+  // when:
+  Call (HLE_GETIN);
+  Byte first = cpu.A;
+  Call (HLE_GETIN);
+
+  // then:
+  EXPECT_EQ (first, 'Q');
+  EXPECT_EQ (cpu.A, 0);
+  EXPECT_TRUE (cpu.P & FLAG_ZERO);
+}
+
+TEST_F (hleTest, LoadUsesTheFileAddressForSecondaryAddressOne)
+{
+  // given:
+  cpu.A = 1;
+  cpu.X = 8;
+  cpu.Y = 1;
+  Call (HLE_SETLFS);
+  SetName ("DATA");
+
+  // when:
+  cpu.A = 0;
+  Call (HLE_LOAD);
+
+  // then:
+  EXPECT_EQ (cpu.Memory[0xC000], 0x11);
+  EXPECT_EQ (cpu.Memory[0xC002], 0x33);
+  EXPECT_EQ (cpu.X, 0x03);
+  EXPECT_EQ (cpu.Y, 0xC0);
+  EXPECT_EQ (cpu.Memory[HLE_END_ADDRESS], 0x03);
+  EXPECT_EQ (cpu.Memory[HLE_END_ADDRESS + 1], 0xC0);
+  EXPECT_FALSE (cpu.P & FLAG_CARRY);
+}
+
+TEST_F (hleTest, LoadRelocatesForSecondaryAddressZero)
+{
+  // given:
+  cpu.A = 1;
+  cpu.X = 8;
+  cpu.Y = 0;
+  Call (HLE_SETLFS);
+  SetName ("DATA");
+
+  // when:
+  cpu.A = 0;
+  cpu.X = 0x00;
+  cpu.Y = 0x40;
+  Call (HLE_LOAD);
+
+  // then:
+  EXPECT_EQ (cpu.Memory[0x4000], 0x11);
+  EXPECT_EQ (cpu.Memory[0xC000], 0x00);
+  EXPECT_EQ (cpu.X, 0x03);
+  EXPECT_EQ (cpu.Y, 0x40);
+}
+
+TEST_F (hleTest, VerifyFlagsMismatchInStatus)
+{
+  // given:
+  cpu.Y = 1;
+  Call (HLE_SETLFS);
+  SetName ("DATA");
+  cpu.Memory[0xC000] = 0x11;
+
+  // when:
+  cpu.A = 1;
+  Call (HLE_LOAD);
+
+  // then: nothing is written
+  EXPECT_EQ (cpu.Memory[HLE_STATUS], 0x10);
+  EXPECT_EQ (cpu.Memory[0xC001], 0x00);
+}
+
+TEST_F (hleTest, MissingFileSetsCarry)
+{
+  // given:
+  SetName ("NOPE");
+
+  // when:
+  cpu.A = 0;
+  Call (HLE_LOAD);
+
+  // then:
+  EXPECT_TRUE (cpu.P & FLAG_CARRY);
+  EXPECT_EQ (cpu.A, HLE_FILE_NOT_FOUND);
+}
+
+TEST_F (hleTest, SaveWritesLoadAddressAndRange)
+{
+  // given:
+  SetName ("OUT");
+  Byte data[] = { 'x', 'y' };
+  Load (0x0801, data, sizeof (data));
+  cpu.Memory[0xFB] = 0x01;
+  cpu.Memory[0xFC] = 0x08;
+
+  // when:
+  cpu.A = 0xFB;
+  cpu.X = 0x03;
+  cpu.Y = 0x08;
+  Call (HLE_SAVE);
+
+  // then:
+  EXPECT_EQ (saved, std::string ("OUT:\x01\x08xy", 8));
+  EXPECT_FALSE (cpu.P & FLAG_CARRY);
+}
+
+TEST_F (hleTest, DecliningHandlerLeavesTheRoutineToRom)
+{
+  // given:
+  hle->device.output = NULL;
+
+  // when:
+  Sint32 cycles = Call (HLE_CHROUT);
+
+  // then:
+  EXPECT_EQ (cycles, 0);
+  EXPECT_EQ (cpu.PC, HLE_CHROUT);
+}
+
+TEST_F (hleTest, ExactModeAndUntrapStopTraps)
+{
+  // given:
+  hle->exact = true;
+
+  // then:
+  EXPECT_EQ (Call (HLE_CHROUT), 0);
+  hle->exact = false;
+  hle_untrap (hle, HLE_CHROUT);
+  EXPECT_EQ (Call (HLE_CHROUT), 0);
+  EXPECT_EQ (hle_find (hle, HLE_CHROUT), nullptr);
+  EXPECT_GT (Call (HLE_GETIN), 0);
+}
+
+#ifdef ACE64_HLE
+TEST_F (hleTest, ExecutePrintsWithoutRom)
+{
+  // given:
+  // $0200: LDX #$00
+  // $0202: LDA $0340,X
+  // $0205: BEQ $020D
+  // $0207: JSR $FFD2
+  // $020A: INX
+  // $020B: BNE $0202
+  Byte program[] = { INS_LDX_IM, 0x00,        INS_LDA_ABX, 0x40, 0x03,
+                     INS_BEQ,    0x06,        INS_JSR_ABS,     0xD2, 0xFF,
+                     INS_INX,    INS_BNE,     0xF5 };
+  Load (0x0200, program, sizeof (program));
+  memcpy (&cpu.Memory[0x0340], "HELLO", 6);
+  hle_attach (&cpu, hle);
+
+  // when:
+  Uint64 cycles = 0;
+  while (cpu.PC != 0x020D)
+    {
+      cycles += execute (&cpu);
+    }
+
+  // then:
+  EXPECT_EQ (output, "HELLO");
+  EXPECT_EQ (cpu.SP, 0xFF);
+  EXPECT_EQ (hle_find (hle, HLE_CHROUT)->calls, 5u);
+  EXPECT_GT (cycles, 5u * HLE_CYCLES_CHROUT);
+}
+
+TEST_F (hleTest, ExactModeRunsTheRom)
+{
+  // given: a ROM CHROUT that only returns
+  Byte program[] = { INS_JSR_ABS, 0xD2, 0xFF };
+  Load (0x0200, program, sizeof (program));
+  cpu.Memory[HLE_CHROUT] = INS_RTS;
+  hle->exact = true;
+  hle_attach (&cpu, hle);
+
+  // when:
+  Sint32 cycles = execute (&cpu) + execute (&cpu);
+
+  // then:
+  EXPECT_EQ (cpu.PC, 0x0203);
+  EXPECT_EQ (cycles, 12);
+  EXPECT_EQ (output, "");
+}
+#endif
+
+#if defined(ACE64_HLE) && defined(ACE64_LAST_WRITER)
+TEST_F (hleTest, TrapWritesAreStampedWithTheTrap)
+{
+  // given:
+  // $0200: LDA #$00
+  // $0202: JSR $FFD5 (LOAD)
+  // $0205: STA $10
+  cpu.A = 1;
+  cpu.X = 8;
+  cpu.Y = 1;
+  Call (HLE_SETLFS);
+  SetName ("DATA");
+  Byte program[] = { INS_LDA_IM, 0x00, INS_JSR_ABS, 0xD5, 0xFF,
+                     INS_STA_ZP, 0x10 };
+  Load (0x0200, program, sizeof (program));
+  cpu.PC = 0x0200;
+  cpu.SP = 0xFF;
+  LastWriters *writers = (LastWriters *)malloc (sizeof (LastWriters));
+  writers_clear (writers);
+  writers_attach (&cpu, writers);
+  hle_attach (&cpu, hle);
+
+  // when:
+  while (cpu.PC != 0x0207)
+    {
+      execute (&cpu);
+    }
+
+  // then: the trap's writes carry its address and cycle, and later
+  // instructions count its cycles
+  Word pc;
+  Uint64 cycle;
+  ASSERT_TRUE (writers_query (writers, 0xC000, &pc, &cycle));
+  EXPECT_EQ (pc, HLE_LOAD);
+  EXPECT_EQ (cycle, 8u);
+  ASSERT_TRUE (writers_query (writers, 0x0010, &pc, &cycle));
+  EXPECT_EQ (pc, 0x0205);
+  EXPECT_EQ (cycle, 8u + HLE_CYCLES_LOAD);
+  free (writers);
+}
+#endif
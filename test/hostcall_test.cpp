@@ -0,0 +1,342 @@
+#include "../code/cpu.h"
+#include "../code/hostcall.h"
+#include "../code/profile.h"
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <unistd.h>
+
+class hostcallTest : public testing::Test
+{
+public:
+  CPU cpu;
+  HostCalls *calls;
+  FILE *out;
+  char directory[32];
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    strcpy (directory, "/tmp/ace64_hostcallXXXXXX");
+    ASSERT_NE (mkdtemp (directory), nullptr);
+    calls = hostcall_create (HOSTCALL_DEFAULT_OPCODE, false);
+    ASSERT_NE (calls, nullptr);
+    ASSERT_TRUE (hostcall_install_standard (calls, directory));
+    out = tmpfile ();
+    calls->channels[0] = out;
+  }
+
+  virtual void
+  TearDown ()
+  {
+    hostcall_destroy (calls);
+    fclose (out);
+    std::string command = std::string ("rm -rf ") + directory;
+    system (command.c_str ());
+  }
+
+  void
+  Load (Word address, const Byte *bytes, unsigned length)
+  {
+    for (unsigned i = 0; i < length; i++)
+      {
+        cpu.Memory[address + i] = bytes[i];
+      }
+  }
+
+  // Runs the host call at $0200 as execute() would after fetching it, with
+  // the parameter block at $0300, and returns its cycles.
+  Sint32
+  Call (Byte service)
+  {
+    cpu.Memory[0x0200] = calls->opcode;
+    cpu.Memory[0x0201] = service;
+    cpu.A = calls->immediate ? 0x77 : service;
+    cpu.X = 0x00;
+    cpu.Y = 0x03;
+    cpu.PC = 0x0201;
+    Sint32 cycles = 1;
+    hostcall_run (&cpu, calls, &cycles);
+    return cycles;
+  }
+
+  std::string
+  Output ()
+  {
+    fflush (out);
+    rewind (out);
+    std::string text;
+    int c;
+    while ((c = fgetc (out)) != EOF)
+      {
+        text += (char)c;
+      }
+    return text;
+  }
+
+  // Puts name at $0340 and its address and length in the block.
+  void
+  SetName (const char *name)
+  {
+    memcpy (&cpu.Memory[0x0340], name, strlen (name));
+    cpu.Memory[0x0300] = 0x40;
+    cpu.Memory[0x0301] = 0x03;
+    cpu.Memory[0x0302] = strlen (name);
+  }
+};
+
+TEST_F (hostcallTest, WriteSendsBytesToChannel)
+{
+  // given:
+  memcpy (&cpu.Memory[0x1000], "PASS\n", 5);
+  Byte block[] = { 0, 0x00, 0x10, 5, 0 };
+  Load (0x0300, block, sizeof (block));
+
+  // when:
+  Sint32 cycles = Call (HOSTCALL_WRITE);
+
+  // then:
+  EXPECT_EQ (cycles, 2);
+  EXPECT_EQ (Output (), "PASS\n");
+  EXPECT_EQ (cpu.A, HOSTCALL_OK);
+  EXPECT_FALSE (cpu.P & FLAG_CARRY);
+  EXPECT_EQ (cpu.PC, 0x0201);
+  EXPECT_EQ (calls->calls, 1u);
+}
+
+TEST_F (hostcallTest, ImmediateDispatchReadsTheServiceByte)
+{
+  // given:
+  hostcall_destroy (calls);
+  calls = hostcall_create (0x03, true); // An unimplemented SLO slot
+  ASSERT_NE (calls, nullptr);
+  hostcall_install_standard (calls, NULL);
+  calls->channels[0] = out;
+  cpu.Memory[0x1000] = 'x';
+  Byte block[] = { 0, 0x00, 0x10, 1, 0 };
+  Load (0x0300, block, sizeof (block));
+
+  // when:
+  Sint32 cycles = Call (HOSTCALL_WRITE);
+
+  // then:
+  EXPECT_EQ (cycles, 3);
+  EXPECT_EQ (cpu.PC, 0x0202);
+  EXPECT_EQ (Output (), "x");
+}
+
+TEST_F (hostcallTest, ImplementedOpcodesAreRefused)
+{
+  EXPECT_EQ (hostcall_create (INS_NOP, false), nullptr);
+}
+
+TEST_F (hostcallTest, ErrorsSetCarry)
+{
+  // when:
+  Call (0x42);
+
+  // then:
+  EXPECT_EQ (cpu.A, HOSTCALL_NO_SERVICE);
+  EXPECT_TRUE (cpu.P & FLAG_CARRY);
+
+  // given:
+  cpu.Memory[0x0300] = HOSTCALL_MAX_CHANNELS;
+
+  // when:
+  Call (HOSTCALL_WRITE);
+
+  // then:
+  EXPECT_EQ (cpu.A, HOSTCALL_BAD_CHANNEL);
+}
+
+TEST_F (hostcallTest, WrittenFileReadsBack)
+{
+  // given:
+  SetName ("RESULT.BIN");
+  cpu.Memory[0x0303] = 0; // Truncate
+  Call (HOSTCALL_OPEN);
+  ASSERT_EQ (cpu.A, HOSTCALL_OK);
+  Byte channel = cpu.Memory[0x0304];
+  memcpy (&cpu.Memory[0x2000], "\x01\x02\x03", 3);
+  Byte write[] = { channel, 0x00, 0x20, 3, 0 };
+  Load (0x0300, write, sizeof (write));
+  Call (HOSTCALL_WRITE);
+  Call (HOSTCALL_CLOSE);
+
+  // when:
+  SetName ("RESULT.BIN");
+  Byte read[] = { 0x00, 0x40, 0xFF, 0x00 };
+  Load (0x0303, read, sizeof (read));
+  Call (HOSTCALL_READ_FILE);
+
+  // then:
+  EXPECT_EQ (channel, 2);
+  EXPECT_EQ (cpu.A, HOSTCALL_OK);
+  EXPECT_EQ (memcmp (&cpu.Memory[0x4000], "\x01\x02\x03", 3), 0);
+  EXPECT_EQ (cpu.Memory[0x0307], 3);
+  EXPECT_EQ (cpu.Memory[0x0308], 0);
+}
+
+TEST_F (hostcallTest, NamesLeavingTheDirectoryAreRefused)
+{
+  const char *names[] = { "../escape", "sub/file", ".hidden" };
+  for (const char *name : names)
+    {
+      // given:
+      SetName (name);
+
+      // when:
+      Call (HOSTCALL_OPEN);
+
+      // then:
+      EXPECT_EQ (cpu.A, HOSTCALL_BAD_NAME) << name;
+    }
+
+  // given: a missing file
+  SetName ("MISSING");
+
+  // when:
+  Call (HOSTCALL_READ_FILE);
+
+  // then:
+  EXPECT_EQ (cpu.A, HOSTCALL_FILE_ERROR);
+}
+
+TEST_F (hostcallTest, ReinstallingWithoutADirectoryRefusesFiles)
+{
+  // given: the fixture installed the services with a directory
+  ASSERT_TRUE (hostcall_install_standard (calls, NULL));
+  SetName ("RESULT.BIN");
+  cpu.Memory[0x0303] = 0;
+
+  // when:
+  Call (HOSTCALL_OPEN);
+
+  // then:
+  EXPECT_EQ (calls->directory, nullptr);
+  EXPECT_EQ (cpu.A, HOSTCALL_BAD_NAME);
+}
+
+TEST_F (hostcallTest, TimeIsTheHostClock)
+{
+  // when:
+  Call (HOSTCALL_TIME);
+
+  // then:
+  Uint64 micros = 0;
+  for (int i = 7; i >= 0; i--)
+    {
+      micros = micros << 8 | cpu.Memory[0x0300 + i];
+    }
+  EXPECT_LE (llabs ((long long)(micros / 1000000) - (long long)time (NULL)),
+             2);
+}
+
+TEST_F (hostcallTest, ExitRecordsStatusAndHalts)
+{
+  // given:
+  cpu.Memory[0x0300] = 3;
+
+  // when:
+  Call (HOSTCALL_EXIT);
+
+  // then:
+  EXPECT_TRUE (calls->exited);
+  EXPECT_EQ (calls->status, 3);
+  EXPECT_EQ (cpu.PC, 0x0200);
+
+  // when: run again, with X/Y at a WRITE block
+  Byte block[] = { 0, 0x40, 0x03, 2 };
+  Load (0x0300, block, sizeof (block));
+  cpu.A = HOSTCALL_WRITE;
+  cpu.PC = 0x0201;
+  Sint32 cycles = 1;
+  hostcall_run (&cpu, calls, &cycles);
+
+  // then: halted in place
+  EXPECT_EQ (cycles, 2);
+  EXPECT_EQ (cpu.PC, 0x0200);
+  EXPECT_EQ (cpu.A, HOSTCALL_WRITE);
+  EXPECT_EQ (calls->calls, 1u);
+  EXPECT_EQ (Output (), "");
+
+  // when:
+  hostcall_clear_exit (calls);
+  cpu.PC = 0x0201;
+  hostcall_run (&cpu, calls, &cycles);
+
+  // then:
+  EXPECT_FALSE (calls->exited);
+  EXPECT_EQ (calls->calls, 2u);
+}
+
+#ifdef ACE64_HOSTCALL
+TEST_F (hostcallTest, ExecuteReportsAndExits)
+{
+  // given:
+  // $0200: LDA #$00 (WRITE)
+  // $0202: LDX #$00
+  // $0204: LDY #$03
+  // $0206: .byte $FF
+  // $0207: LDA #$05 (EXIT)
+  // $0209: LDX #$10
+  // $020B: .byte $FF
+  Byte program[] = { INS_LDA_IM, HOSTCALL_WRITE, INS_LDX_IM, 0x00,
+                     INS_LDY_IM, 0x03,           0xFF,       INS_LDA_IM,
+                     HOSTCALL_EXIT, INS_LDX_IM,  0x10,       0xFF };
+  Load (0x0200, program, sizeof (program));
+  Byte block[] = { 0, 0x40, 0x03, 2, 0 };
+  Load (0x0300, block, sizeof (block));
+  memcpy (&cpu.Memory[0x0340], "OK", 2);
+  cpu.Memory[0x0310] = 0;
+  cpu.PC = 0x0200;
+  hostcall_attach (&cpu, calls);
+
+  // when:
+  int steps = 0;
+  while (!calls->exited && steps++ < 100)
+    {
+      execute (&cpu);
+    }
+
+  // then:
+  EXPECT_EQ (Output (), "OK");
+  EXPECT_EQ (calls->status, 0);
+  EXPECT_EQ (cpu.PC, 0x020B);
+  EXPECT_EQ (calls->calls, 2u);
+}
+
+TEST_F (hostcallTest, ProfiledCpuServesHostCalls)
+{
+  // given:
+  // $0200: LDA #$05 (EXIT)
+  // $0202: LDX #$10
+  // $0204: LDY #$03
+  // $0206: .byte $FF
+  Byte program[] = { INS_LDA_IM, HOSTCALL_EXIT, INS_LDX_IM, 0x10,
+                     INS_LDY_IM, 0x03,          0xFF };
+  Load (0x0200, program, sizeof (program));
+  cpu.Memory[0x0310] = 4;
+  cpu.PC = 0x0200;
+  hostcall_attach (&cpu, calls);
+  OpcodeProfile profile;
+  profile_clear (&profile);
+  profile_attach (&cpu, &profile);
+
+  // when:
+  for (int step = 0; step < 4; step++)
+    {
+      execute (&cpu);
+    }
+
+  // then:
+  EXPECT_EQ (calls->calls, 1u);
+  EXPECT_TRUE (calls->exited);
+  EXPECT_EQ (calls->status, 4);
+  EXPECT_EQ (profile.opcodes[INS_LDA_IM].executions, 1u);
+}
+#endif
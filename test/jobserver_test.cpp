@@ -0,0 +1,224 @@
+#include "../code/cpu.h"
+#include "../code/jobserver.h"
+#include "../code/run.h"
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+class jobserverTest : public testing::Test
+{
+public:
+  JobServer *server;
+  char directory[32];
+  std::string path;
+  std::thread serving;
+  int listener;
+
+  virtual void
+  SetUp ()
+  {
+    strcpy (directory, "/tmp/ace64_jobsXXXXXX");
+    ASSERT_NE (mkdtemp (directory), nullptr);
+    path = std::string (directory) + "/ace64d.sock";
+
+    JobServerOptions options = { 2, 4 };
+    server = jobserver_create (&options);
+    ASSERT_NE (server, nullptr);
+
+    // Base 0: $0200: INX / $0201: STX $10 / $0203: CPX $11 / $0205: BNE
+    // $0200 / $0207: BRK, booted to the INX with X = 0.
+    CPU *base = (CPU *)malloc (sizeof (CPU));
+    reset (base);
+    memset (base->Memory, 0, sizeof (base->Memory));
+    Byte program[] = { INS_INX,     INS_STX_ZP, 0x10, INS_CPX_ZP,
+                       0x11,        INS_BNE,    0xF9, INS_BRK };
+    memcpy (&base->Memory[0x0200], program, sizeof (program));
+    base->PC = 0x0200;
+    ASSERT_EQ (jobserver_add_base (server, base), 0);
+    free (base);
+  }
+
+  virtual void
+  TearDown ()
+  {
+    if (serving.joinable ())
+      {
+        jobserver_stop (server);
+        serving.join ();
+        close (listener);
+      }
+    jobserver_destroy (server);
+    std::string command = std::string ("rm -rf ") + directory;
+    system (command.c_str ());
+  }
+
+  void
+  Serve ()
+  {
+    listener = jobserver_listen (path.c_str ());
+    ASSERT_GE (listener, 0);
+    serving = std::thread ([this] { jobserver_serve (server, listener); });
+  }
+
+  int
+  Connect ()
+  {
+    struct sockaddr_un remote;
+    memset (&remote, 0, sizeof (remote));
+    remote.sun_family = AF_UNIX;
+    strcpy (remote.sun_path, path.c_str ());
+    int fd = socket (AF_UNIX, SOCK_STREAM, 0);
+    EXPECT_EQ (connect (fd, (struct sockaddr *)&remote, sizeof (remote)),
+               0);
+    return fd;
+  }
+
+  static void
+  Put (std::vector<Byte> &out, Uint64 value, int length)
+  {
+    for (int i = 0; i < length; i++)
+      {
+        out.push_back ((Byte)(value >> (8 * i)));
+      }
+  }
+
+  static Uint64
+  Get (const std::vector<Byte> &in, size_t offset, int length)
+  {
+    Uint64 value = 0;
+    for (int i = length - 1; i >= 0; i--)
+      {
+        value = value << 8 | in[offset + i];
+      }
+    return value;
+  }
+
+  // A job on base that stores limit at $11 and dumps $10.
+  static std::vector<Byte>
+  CountJob (Uint32 tag, Byte base, Byte limit)
+  {
+    std::vector<Byte> body;
+    Put (body, tag, 4);
+    body.push_back (base);
+    body.push_back (JOBSERVER_STOP_BRK | JOBSERVER_STOP_SELF_LOOP);
+    Put (body, 0, 7);       // Registers (not set)
+    Put (body, 100000, 8);  // Cycle limit
+    Put (body, 0, 8);       // Instruction limit
+    Put (body, 0x01010000, 4); // One patch, one dump
+    Put (body, 0x0011, 2);
+    Put (body, 1, 2);
+    body.push_back (limit);
+    Put (body, 0x0010, 2);
+    Put (body, 1, 2);
+
+    std::vector<Byte> request;
+    Put (request, body.size (), 4);
+    request.insert (request.end (), body.begin (), body.end ());
+    return request;
+  }
+
+  static std::vector<Byte>
+  Receive (int fd)
+  {
+    std::vector<Byte> response (4);
+    EXPECT_EQ (recv (fd, response.data (), 4, MSG_WAITALL), 4);
+    size_t size = Get (response, 0, 4);
+    response.resize (4 + size);
+    EXPECT_EQ (recv (fd, response.data () + 4, size, MSG_WAITALL),
+               (ssize_t)size);
+    return response;
+  }
+};
+
+TEST_F (jobserverTest, PipelinedJobsAnswerByTag)
+{
+  // given:
+  Serve ();
+  int fd = Connect ();
+  std::vector<Byte> requests;
+  for (Uint32 tag = 1; tag <= 100; tag++)
+    {
+      std::vector<Byte> job = CountJob (tag, 0, (Byte)tag);
+      requests.insert (requests.end (), job.begin (), job.end ());
+    }
+
+  // when: every request goes out before any response is read
+  ASSERT_EQ (send (fd, requests.data (), requests.size (), 0),
+             (ssize_t)requests.size ());
+  std::map<Uint32, std::vector<Byte> > responses;
+  for (int i = 0; i < 100; i++)
+    {
+      std::vector<Byte> response = Receive (fd);
+      responses[(Uint32)Get (response, 4, 4)] = response;
+    }
+  close (fd);
+
+  // then: X counted up to each job's own limit
+  ASSERT_EQ (responses.size (), 100u);
+  for (Uint32 tag = 1; tag <= 100; tag++)
+    {
+      const std::vector<Byte> &response = responses[tag];
+      ASSERT_EQ (response.size (), 4u + JOBSERVER_RESPONSE_FIXED + 1);
+      EXPECT_EQ (response[8], JOBSERVER_OK);
+      EXPECT_EQ (response[9], RUN_EXIT_BRK);
+      EXPECT_EQ (Get (response, 10, 2), 0x0207u);
+      EXPECT_EQ (response[13], tag); // X
+      EXPECT_EQ (Get (response, 20, 8), 4u * tag);
+      EXPECT_EQ (response[36], tag); // The dumped $10
+    }
+  EXPECT_EQ (jobserver_jobs (server), 100u);
+}
+
+TEST_F (jobserverTest, BadRequestsGetAnErrorStatus)
+{
+  // given:
+  Serve ();
+  int fd = Connect ();
+  std::vector<Byte> noBase = CountJob (7, 5, 1);
+  std::vector<Byte> truncated = CountJob (8, 0, 1);
+  truncated.resize (truncated.size () - 2);
+  truncated[0] -= 2;
+
+  // when:
+  send (fd, noBase.data (), noBase.size (), 0);
+  std::vector<Byte> first = Receive (fd);
+  send (fd, truncated.data (), truncated.size (), 0);
+  std::vector<Byte> second = Receive (fd);
+  close (fd);
+
+  // then:
+  EXPECT_EQ (Get (first, 4, 4), 7u);
+  EXPECT_EQ (first[8], JOBSERVER_NO_BASE);
+  EXPECT_EQ (first.size (), 4u + JOBSERVER_RESPONSE_FIXED);
+  EXPECT_EQ (Get (second, 4, 4), 8u);
+  EXPECT_EQ (second[8], JOBSERVER_MALFORMED);
+}
+
+TEST_F (jobserverTest, StopWaitsForClients)
+{
+  // given:
+  Serve ();
+  int fd = Connect ();
+  std::vector<Byte> job = CountJob (1, 0, 3);
+  send (fd, job.data (), job.size (), 0);
+  std::vector<Byte> response = Receive (fd);
+
+  // when:
+  jobserver_stop (server);
+  serving.join ();
+  close (listener);
+
+  // then: the server closed our connection
+  Byte byte;
+  EXPECT_EQ (recv (fd, &byte, 1, 0), 0);
+  EXPECT_EQ (response[8], JOBSERVER_OK);
+  close (fd);
+}
@@ -0,0 +1,175 @@
+#include "../code/cpu.h"
+#include "../code/libace64.h"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+class libace64Test : public testing::Test
+{
+public:
+  ace64_machine *machine;
+
+  virtual void
+  SetUp ()
+  {
+    machine = ace64_create ();
+    ASSERT_NE (machine, nullptr);
+  }
+
+  virtual void
+  TearDown ()
+  {
+    ace64_destroy (machine);
+  }
+
+  static void
+  Start (ace64_machine *target, uint16_t pc, uint8_t x)
+  {
+    ace64_registers registers;
+    ace64_get_registers (target, &registers);
+    registers.pc = pc;
+    registers.x = x;
+    ace64_set_registers (target, &registers);
+  }
+};
+
+TEST_F (libace64Test, RunsLoadedCodeAndDumpsMemory)
+{
+  // given:
+  // $0200: LDA #$42
+  // $0202: STA $10
+  // $0204: BRK
+  Byte program[] = { INS_LDA_IM, 0x42, INS_STA_ZP, 0x10, INS_BRK };
+  ace64_range load = { 0x0200, 0, sizeof (program), program };
+  ASSERT_EQ (ace64_load (machine, &load, 1), 0);
+  Start (machine, 0x0200, 0);
+
+  // when:
+  ace64_exit exit;
+  ASSERT_EQ (ace64_run (machine, 0, &exit), 0);
+
+  // then:
+  EXPECT_EQ (exit.reason, (uint32_t)ACE64_EXIT_BRK);
+  EXPECT_EQ (exit.pc, 0x0204);
+  EXPECT_EQ (exit.instructions, 2u);
+  EXPECT_EQ (exit.cycles, 5u);
+  ace64_registers registers;
+  ace64_get_registers (machine, &registers);
+  EXPECT_EQ (registers.a, 0x42);
+  EXPECT_EQ (registers.pc, 0x0204);
+
+  Byte zeroPage[2];
+  ace64_range dump = { 0x0010, 0, sizeof (zeroPage), zeroPage };
+  ASSERT_EQ (ace64_dump (machine, &dump, 1), 0);
+  EXPECT_EQ (zeroPage[0], 0x42);
+  EXPECT_EQ (zeroPage[1], 0x00);
+}
+
+TEST_F (libace64Test, MemoryIsSharedNotCopied)
+{
+  size_t length = 0;
+  uint8_t *memory = ace64_memory (machine, &length);
+  ASSERT_EQ (length, (size_t)ACE64_MEMORY_SIZE);
+
+  // $0300: INX
+  // $0301: JMP $0301
+  memory[0x0300] = INS_INX;
+  memory[0x0301] = INS_JMP_ABS;
+  memory[0x0302] = 0x01;
+  memory[0x0303] = 0x03;
+  Start (machine, 0x0300, 0x7F);
+
+  ace64_exit exit;
+  ace64_run (machine, 0, &exit);
+  EXPECT_EQ (exit.reason, (uint32_t)ACE64_EXIT_SELF_LOOP);
+  EXPECT_EQ (exit.address, 0x0301);
+
+  ace64_reset (machine);
+  EXPECT_EQ (memory[0x0300], 0x00);
+}
+
+TEST_F (libace64Test, RejectsRangesPastTheEndOfMemory)
+{
+  Byte bytes[4] = { 1, 2, 3, 4 };
+  ace64_range ranges[2] = { { 0x0000, 0, 4, bytes }, { 0xFFFE, 0, 4, bytes } };
+  EXPECT_EQ (ace64_load (machine, ranges, 2), -1);
+  EXPECT_EQ (ace64_memory (machine, NULL)[0x0000], 0xFF); // Nothing loaded
+  EXPECT_EQ (ace64_dump (machine, ranges, 2), -1);
+  EXPECT_EQ (ace64_memory (machine, NULL)[0xFFFE], 0x00);
+
+  ranges[1].length = 2;
+  EXPECT_EQ (ace64_load (machine, ranges, 2), 0);
+  EXPECT_EQ (ace64_memory (machine, NULL)[0xFFFF], 0x02);
+}
+
+TEST_F (libace64Test, StopsAndCycleLimits)
+{
+  // given:
+  // $0200: INX
+  // $0201: JMP $0200
+  Byte program[] = { INS_INX, INS_JMP_ABS, 0x00, 0x02 };
+  ace64_range load = { 0x0200, 0, sizeof (program), program };
+  ace64_load (machine, &load, 1);
+  Start (machine, 0x0200, 0);
+  ace64_exit exit;
+
+  // when: a cycle limit
+  ace64_run (machine, 50, &exit);
+
+  // then: whole instructions, so at least the limit
+  EXPECT_EQ (exit.reason, (uint32_t)ACE64_EXIT_CYCLES);
+  EXPECT_GE (exit.cycles, 50u);
+  EXPECT_LT (exit.cycles, 55u);
+
+  // when: a stop address, which a second run executes
+  ASSERT_EQ (ace64_stop_at (machine, 0x0201), 0);
+  ace64_run (machine, 0, &exit);
+  EXPECT_EQ (exit.reason, (uint32_t)ACE64_EXIT_PC);
+  EXPECT_EQ (exit.pc, 0x0201);
+  ace64_run (machine, 0, &exit);
+  EXPECT_EQ (exit.reason, (uint32_t)ACE64_EXIT_PC);
+  EXPECT_EQ (exit.instructions, 2u);
+
+  // then: cleared stops leave only the limit
+  ace64_clear_stops (machine);
+  ace64_run (machine, 100, &exit);
+  EXPECT_EQ (exit.reason, (uint32_t)ACE64_EXIT_CYCLES);
+}
+
+TEST_F (libace64Test, BatchesRunEveryMachine)
+{
+  // given: machines counting X up from different starts
+  // $0200: INX
+  // $0201: CPX #$10
+  // $0203: BNE $0200
+  // $0205: BRK
+  Byte program[] = { INS_INX, INS_CPX_IM, 0x10, INS_BNE, 0xFB, INS_BRK };
+  std::vector<ace64_machine *> machines;
+  for (int i = 0; i < 9; i++)
+    {
+      ace64_machine *target = ace64_create ();
+      ace64_range load = { 0x0200, 0, sizeof (program), program };
+      ace64_load (target, &load, 1);
+      Start (target, 0x0200, (uint8_t)i);
+      machines.push_back (target);
+    }
+  std::vector<ace64_exit> exits (machines.size ());
+
+  // when:
+  ASSERT_EQ (ace64_run_batch (machines.data (), machines.size (), 0,
+                              exits.data (), 4),
+             0);
+
+  // then:
+  for (size_t i = 0; i < machines.size (); i++)
+    {
+      ace64_registers registers;
+      ace64_get_registers (machines[i], &registers);
+      EXPECT_EQ (exits[i].reason, (uint32_t)ACE64_EXIT_BRK);
+      EXPECT_EQ (exits[i].instructions, 3 * (16 - i));
+      EXPECT_EQ (registers.x, 0x10);
+      ace64_destroy (machines[i]);
+    }
+  EXPECT_EQ (ace64_run_batch (NULL, 0, 0, NULL, 0), 0);
+  EXPECT_EQ (ace64_abi_version (), (uint32_t)ACE64_ABI_VERSION);
+}
@@ -0,0 +1,331 @@
+#include "../code/cpu.h"
+#include "../code/loops.h"
+#include "../code/trace.h"
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+class loopsTest : public testing::Test
+{
+public:
+  CPU cpu;
+  CPU plain;
+  Loops loops;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    loops_clear (&loops);
+    for (Uint32 i = 0x1000; i < 0x2000; i++)
+      {
+        cpu.Memory[i] = (Byte)(i * 7 + (i >> 8));
+      }
+    cpu.PC = 0x0200;
+  }
+
+  void
+  Load (Word address, const Byte *bytes, unsigned length)
+  {
+    for (unsigned i = 0; i < length; i++)
+      {
+        cpu.Memory[address + i] = bytes[i];
+      }
+  }
+
+  // Runs to stop or exit, trying native loops first when native is set,
+  // and returns the cycles taken.
+  Uint64
+  Run (CPU *cpu, bool native, Word stop, Word exit)
+  {
+    Uint64 cycles = 0;
+    while (cpu->PC != stop && cpu->PC != exit)
+      {
+        Sint32 taken = native ? loops_run (cpu, &loops) : 0;
+        cycles += taken != 0 ? taken : execute (cpu);
+      }
+    return cycles;
+  }
+
+  // Runs the loaded program both ways from the same state and checks that
+  // they end alike.
+  void
+  ExpectSameAsInterpreter (Word stop, Word exit = 0xFFFF)
+  {
+    plain = cpu;
+    Uint64 cycles = Run (&cpu, true, stop, exit);
+    Uint64 plainCycles = Run (&plain, false, stop, exit);
+
+    EXPECT_EQ (cycles, plainCycles);
+    EXPECT_EQ (cpu.PC, plain.PC);
+    EXPECT_EQ (cpu.SP, plain.SP);
+    EXPECT_EQ (cpu.P, plain.P);
+    EXPECT_EQ (cpu.A, plain.A);
+    EXPECT_EQ (cpu.X, plain.X);
+    EXPECT_EQ (cpu.Y, plain.Y);
+    EXPECT_EQ (memcmp (cpu.Memory, plain.Memory, MAX_MEMORY), 0);
+  }
+};
+
+TEST_F (loopsTest, FillsScreenInOneRun)
+{
+  // given:
+  // $0200: LDA #$20
+  // $0202: LDX #$00
+  // $0204: STA $0400,X
+  // $0207: STA $0500,X
+  // $020A: STA $0600,X
+  // $020D: STA $06E8,X
+  // $0210: INX
+  // $0211: BNE $0204
+  Byte program[] = { INS_LDA_IM,  0x20, INS_LDX_IM,  0x00, INS_STA_ABX,
+                     0x00,        0x04, INS_STA_ABX, 0x00, 0x05,
+                     INS_STA_ABX, 0x00, 0x06,        INS_STA_ABX, 0xE8,
+                     0x06,        INS_INX, INS_BNE,  0xF1 };
+  Load (0x0200, program, sizeof (program));
+
+  // when:
+  ExpectSameAsInterpreter (0x0213);
+
+  // then:
+  EXPECT_EQ (loops.runs[LOOP_FILL], 1u);
+  EXPECT_EQ (loops.iterations, 255u);
+  EXPECT_EQ (cpu.Memory[0x07E7], 0x20);
+}
+
+TEST_F (loopsTest, CopiesThroughPointersAcrossPages)
+{
+  // given: ($10) = $12F0, so loads cross a page from Y = $10
+  // $0200: LDY #$00
+  // $0202: LDA ($10),Y
+  // $0204: STA ($12),Y
+  // $0206: INY
+  // $0207: BNE $0202
+  Byte program[] = { INS_LDY_IM, 0x00, INS_LDA_IDY, 0x10, INS_STA_IDY,
+                     0x12,       INS_INY, INS_BNE,  0xF9 };
+  Load (0x0200, program, sizeof (program));
+  Byte pointers[] = { 0xF0, 0x12, 0x00, 0x30 };
+  Load (0x0010, pointers, sizeof (pointers));
+
+  // when:
+  ExpectSameAsInterpreter (0x0209);
+
+  // then:
+  EXPECT_EQ (loops.runs[LOOP_COPY], 1u);
+  EXPECT_EQ (memcmp (&cpu.Memory[0x3000], &cpu.Memory[0x12F0], 256), 0);
+}
+
+TEST_F (loopsTest, OverlappingCopyPropagatesInLoopOrder)
+{
+  // given:
+  // $0200: LDX #$00
+  // $0202: LDA $1000,X
+  // $0205: STA $1001,X
+  // $0208: INX
+  // $0209: CPX #$40
+  // $020B: BNE $0202
+  Byte program[] = { INS_LDX_IM,  0x00, INS_LDA_ABX, 0x00, 0x10,
+                     INS_STA_ABX, 0x01, 0x10,        INS_INX, INS_CPX_IM,
+                     0x40,        INS_BNE, 0xF5 };
+  Load (0x0200, program, sizeof (program));
+  Byte first = cpu.Memory[0x1000];
+
+  // when:
+  ExpectSameAsInterpreter (0x020D);
+
+  // then:
+  EXPECT_EQ (loops.runs[LOOP_COPY], 1u);
+  for (Word address = 0x1000; address <= 0x1040; address++)
+    {
+      EXPECT_EQ (cpu.Memory[address], first);
+    }
+}
+
+TEST_F (loopsTest, CompareStopsAtFirstMismatch)
+{
+  // given:
+  // $0200: LDY #$00
+  // $0202: LDA $1000,Y
+  // $0205: CMP $2080,Y
+  // $0208: BNE $0210
+  // $020A: INY
+  // $020B: CPY #$F0
+  // $020D: BNE $0202
+  // $020F: (equal)   $0210: (differ)
+  Byte program[] = { INS_LDY_IM,  0x00, INS_LDA_ABY, 0x00, 0x10, INS_CMP_ABY,
+                     0x80,        0x20, INS_BNE,     0x06, INS_INY,
+                     INS_CPY_IM,  0xF0, INS_BNE,     0xF3 };
+  Load (0x0200, program, sizeof (program));
+  memcpy (&cpu.Memory[0x2080], &cpu.Memory[0x1000], 0xF0);
+  cpu.Memory[0x2080 + 0xA0] ^= 0xFF;
+
+  // when:
+  ExpectSameAsInterpreter (0x020F, 0x0210);
+
+  // then:
+  EXPECT_EQ (cpu.PC, 0x0210);
+  EXPECT_EQ (cpu.Y, 0xA0);
+  EXPECT_EQ (loops.runs[LOOP_COMPARE], 1u);
+  EXPECT_EQ (loops.iterations, 0xA0u);
+}
+
+TEST_F (loopsTest, CompareRunsToTheLimitWhenEqual)
+{
+  // given: the same loop over equal bytes
+  Byte program[] = { INS_LDY_IM,  0x00, INS_LDA_ABY, 0x00, 0x10, INS_CMP_ABY,
+                     0x80,        0x20, INS_BNE,     0x06, INS_INY,
+                     INS_CPY_IM,  0xF0, INS_BNE,     0xF3 };
+  Load (0x0200, program, sizeof (program));
+  memcpy (&cpu.Memory[0x2080], &cpu.Memory[0x1000], 0xF0);
+
+  // when:
+  ExpectSameAsInterpreter (0x020F, 0x0210);
+
+  // then:
+  EXPECT_EQ (cpu.PC, 0x020F);
+  EXPECT_EQ (cpu.Y, 0xF0);
+}
+
+TEST_F (loopsTest, MatchesInterpreterForEveryStartIndex)
+{
+  // $0200: LDA $10F8,Y
+  // $0203: STA $3000,Y
+  // $0206: DEY
+  // $0207: CPY #$05
+  // $0209: BNE $0200
+  Byte program[] = { INS_LDA_ABY, 0xF8,   0x10, INS_STA_ABY, 0x00, 0x30,
+                     INS_DEY,     INS_CPY_IM, 0x05, INS_BNE, 0xF5 };
+  Load (0x0200, program, sizeof (program));
+  CPU start = cpu;
+
+  for (int y = 0; y < 256; y++)
+    {
+      // given:
+      cpu = start;
+      cpu.Y = y;
+
+      // when:
+      ExpectSameAsInterpreter (0x020B);
+    }
+}
+
+TEST_F (loopsTest, DecrementFromZeroStopsAtTheWrap)
+{
+  // given:
+  // $0200: STA $3000,X
+  // $0203: DEX
+  // $0204: BNE $0200
+  Byte program[] = { INS_STA_ABX, 0x00, 0x30, INS_DEX, INS_BNE, 0xFA };
+  Load (0x0200, program, sizeof (program));
+  cpu.A = 0x55;
+
+  // when:
+  ExpectSameAsInterpreter (0x0206);
+
+  // then: index 0, then $FF down to 2 natively
+  EXPECT_EQ (loops.runs[LOOP_FILL], 2u);
+  EXPECT_EQ (loops.iterations, 255u);
+}
+
+TEST_F (loopsTest, StoresIntoOwnCodeAreInterpreted)
+{
+  // given:
+  // $0200: STA $01F0,X
+  // $0203: INX
+  // $0204: BNE $0200
+  Byte program[] = { INS_STA_ABX, 0xF0, 0x01, INS_INX, INS_BNE, 0xFA };
+  Load (0x0200, program, sizeof (program));
+  cpu.A = INS_NOP;
+
+  // when:
+  plain = cpu;
+  loops_run (&cpu, &loops);
+
+  // then:
+  EXPECT_EQ (loops.refused, 1u);
+  EXPECT_EQ (loops.iterations, 0u);
+  EXPECT_EQ (memcmp (&cpu, &plain, sizeof (CPU)), 0);
+}
+
+TEST_F (loopsTest, IOPagesAreInterpreted)
+{
+  // given:
+  // $0200: LDA $1000,X
+  // $0203: STA $D800,X
+  // $0206: INX
+  // $0207: BNE $0200
+  Byte program[] = { INS_LDA_ABX, 0x00, 0x10, INS_STA_ABX, 0x00, 0xD8,
+                     INS_INX,     INS_BNE, 0xF7 };
+  Load (0x0200, program, sizeof (program));
+
+  // when:
+  ExpectSameAsInterpreter (0x0209);
+
+  // then:
+  EXPECT_GT (loops.refused, 0u);
+  EXPECT_EQ (loops.iterations, 0u);
+}
+
+TEST_F (loopsTest, PointerStoresAreInterpreted)
+{
+  // given: the loop stores over its own pointer at $10
+  // $0200: STA ($10),Y
+  // $0202: INY
+  // $0203: BNE $0200
+  Byte program[] = { INS_STA_IDY, 0x10, INS_INY, INS_BNE, 0xFB };
+  Load (0x0200, program, sizeof (program));
+  cpu.Memory[0x10] = 0x08;
+  cpu.Memory[0x11] = 0x00;
+  cpu.A = 0x09;
+
+  // when:
+  ExpectSameAsInterpreter (0x0205);
+
+  // then: refused until the pointer's new value moves the stores past it
+  EXPECT_GT (loops.refused, 0u);
+}
+
+#ifdef ACE64_LOOPS
+TEST_F (loopsTest, ExecuteRunsLoopsWhileAttached)
+{
+  // given:
+  Byte program[] = { INS_STA_ABX, 0x00, 0x30, INS_DEX, INS_BNE, 0xFA };
+  Load (0x0200, program, sizeof (program));
+  cpu.X = 0x80;
+  loops_attach (&cpu, &loops);
+
+  // when:
+  int steps = 0;
+  while (cpu.PC != 0x0206)
+    {
+      execute (&cpu);
+      steps++;
+    }
+
+  // then: one native run, then the last iteration
+  EXPECT_EQ (steps, 4);
+  EXPECT_EQ (loops.iterations, 0x7Fu);
+}
+
+TEST_F (loopsTest, TracedCpuIsInterpreted)
+{
+  // given:
+  Byte program[] = { INS_STA_ABX, 0x00, 0x30, INS_DEX, INS_BNE, 0xFA };
+  Load (0x0200, program, sizeof (program));
+  cpu.X = 0x80;
+  loops_attach (&cpu, &loops);
+  Trace *trace = trace_create (8);
+  trace_attach (&cpu, trace);
+
+  // when:
+  while (cpu.PC != 0x0206)
+    {
+      execute (&cpu);
+    }
+
+  // then:
+  EXPECT_EQ (trace_count (trace), 3u * 0x80);
+  EXPECT_EQ (loops.iterations, 0u);
+  trace_destroy (trace);
+}
+#endif
@@ -0,0 +1,102 @@
+#include "../code/cpu.h"
+#include "../code/machine.hpp"
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+using ace64::Machine;
+using ace64::MemoryRange;
+using ace64::RegisterState;
+
+TEST (machineTest, MovesWithoutCopying)
+{
+  // given:
+  static_assert (!std::is_copy_constructible_v<Machine>);
+  static_assert (std::is_nothrow_move_constructible_v<Machine>);
+  static_assert (sizeof (RegisterState) <= 8);
+  Machine machine;
+  const Byte *memory = machine.memory ().data ();
+  EXPECT_EQ ((std::uintptr_t)&machine.cpu () % 64, 0u);
+
+  // when:
+  Machine moved (std::move (machine));
+  Machine assigned;
+  assigned = std::move (moved);
+
+  // then: the same CPU, reset
+  EXPECT_EQ (assigned.memory ().data (), memory);
+  EXPECT_EQ (assigned.registers ().pc, 0xFFFC);
+  EXPECT_EQ (assigned.memory ()[0x0001], 0x07);
+}
+
+TEST (machineTest, LoadsAndStoresRanges)
+{
+  // given:
+  Machine machine;
+  std::vector<Byte> program = { INS_LDA_IM, 0x42, INS_STA_ZP, 0x10 };
+  std::array<Byte, 2> out{};
+
+  // then:
+  EXPECT_TRUE (machine.load (0xFFFC, program));
+  EXPECT_FALSE (machine.load (0xFFFD, program));
+  EXPECT_EQ (machine.memory ()[0xFFFD], 0x42);
+
+  // when:
+  machine.step ();
+  machine.step ();
+
+  // then:
+  EXPECT_TRUE (machine.store (0x0010, out));
+  EXPECT_EQ (out[0], 0x42);
+  EXPECT_EQ (out[1], 0x00);
+  EXPECT_FALSE (machine.store (0xFFFF, out));
+}
+
+TEST (machineTest, RegisterStatesCompare)
+{
+  // given:
+  Machine machine;
+  RegisterState before = machine.registers ();
+
+  // when:
+  machine.cpu ().A = 0x01;
+
+  // then:
+  EXPECT_NE (machine.registers (), before);
+  machine.set_registers (before);
+  EXPECT_EQ (machine.registers (), before);
+}
+
+TEST (machineTest, DiffReportsChangedRanges)
+{
+  // given:
+  Machine machine;
+  Machine copy = machine.clone ();
+  EXPECT_TRUE (machine.diff (copy).empty ());
+
+  // when: a lone byte, a run across a 16-byte block, a whole block
+  // and the last byte
+  copy.memory ()[0x0003] = 0xAA;
+  for (int address = 0x020E; address < 0x0213; address++)
+    {
+      copy.memory ()[address] = 0xBB;
+    }
+  for (int address = 0x1000; address < 0x1021; address++)
+    {
+      copy.memory ()[address] ^= 0xFF;
+    }
+  copy.memory ()[0xFFFF] = 0xCC;
+
+  // then:
+  std::vector<MemoryRange> expected = {
+    { 0x0003, 1 }, { 0x020E, 5 }, { 0x1000, 0x21 }, { 0xFFFF, 1 }
+  };
+  EXPECT_EQ (machine.diff (copy), expected);
+
+  std::vector<MemoryRange> tail = ace64::diff_memory (
+      &machine.memory ()[0xFFEF], &copy.memory ()[0xFFEF], 0x11);
+  ASSERT_EQ (tail.size (), 1u);
+  EXPECT_EQ (tail[0].address, 0x10u);
+}
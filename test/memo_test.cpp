@@ -0,0 +1,290 @@
+#include "../code/breakpoints.h"
+#include "../code/cpu.h"
+#include "../code/memo.h"
+#include "../code/statehash.h"
+#include "../code/writers.h"
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+
+class memoTest : public testing::Test
+{
+public:
+  CPU cpu;
+  CPU plain;
+  Memo *memo;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    memo = (Memo *)malloc (sizeof (Memo));
+    memo_clear (memo);
+  }
+
+  virtual void
+  TearDown ()
+  {
+    free (memo);
+  }
+
+  void
+  Load (Word address, const Byte *bytes, unsigned length)
+  {
+    for (unsigned i = 0; i < length; i++)
+      {
+        cpu.Memory[address + i] = bytes[i];
+      }
+  }
+
+  // Calls the routine at $0300 three times from one call site:
+  // $0200: LDA #$03
+  // $0202: STA $20
+  // $0204: LDA #$07     loop
+  // $0206: STA $10
+  // $0208: LDX #$00
+  // $020A: LDA #$0D
+  // $020C: STA $11
+  // $020E: CLC
+  // $020F: CLV
+  // $0210: JSR $0300
+  // $0213: DEC $20
+  // $0215: BNE $0204
+  void
+  LoadCaller ()
+  {
+    Byte caller[] = { INS_LDA_IM,  0x03, INS_STA_ZP, 0x20, INS_LDA_IM,
+                      0x07,        INS_STA_ZP, 0x10, INS_LDX_IM, 0x00,
+                      INS_LDA_IM,  0x0D, INS_STA_ZP, 0x11, INS_CLC,
+                      INS_CLV,     INS_JSR_ABS, 0x00, 0x03, INS_DEC_ZP,
+                      0x20,        INS_BNE,     0xED };
+    Load (0x0200, caller, sizeof (caller));
+    cpu.PC = 0x0200;
+  }
+
+  // 8x8 multiply: $13:$12 = $10 * $11
+  // $0300: LDA #$00
+  // $0302: LDX #$08
+  // $0304: LSR $11      loop
+  // $0306: BCC $030B
+  // $0308: CLC
+  // $0309: ADC $10
+  // $030B: ROR A        skip
+  // $030C: ROR $12
+  // $030E: DEX
+  // $030F: BNE $0304
+  // $0311: STA $13
+  // $0313: RTS
+  void
+  LoadMultiply ()
+  {
+    Byte multiply[] = { INS_LDA_IM, 0x00,       INS_LDX_IM, 0x08,
+                        INS_LSR_ZP, 0x11,       INS_BCC,    0x03,
+                        INS_CLC,    INS_ADC_ZP, 0x10,       INS_ROR_ACC,
+                        INS_ROR_ZP, 0x12,       INS_DEX,    INS_BNE,
+                        0xF3,       INS_STA_ZP, 0x13,       INS_RTS };
+    Load (0x0300, multiply, sizeof (multiply));
+  }
+
+  // Runs from PC to $0217 and returns the cycles taken.
+  static Uint64
+  Run (CPU *cpu)
+  {
+    Uint64 cycles = 0;
+    while (cpu->PC != 0x0217)
+      {
+        cycles += execute (cpu);
+      }
+    return cycles;
+  }
+
+  static void
+  ExpectSameState (const CPU &a, const CPU &b)
+  {
+    EXPECT_EQ (a.PC, b.PC);
+    EXPECT_EQ (a.SP, b.SP);
+    EXPECT_EQ (a.P, b.P);
+    EXPECT_EQ (a.A, b.A);
+    EXPECT_EQ (a.X, b.X);
+    EXPECT_EQ (a.Y, b.Y);
+    EXPECT_EQ (memcmp (a.Memory, b.Memory, MAX_MEMORY), 0);
+  }
+};
+
+TEST_F (memoTest, RecordsReadsBeforeWritesOnly)
+{
+  // given:
+  memo->record = &memo->entries[0];
+
+  // when:
+  memo_read (memo, 0x0010, 0x01);
+  memo_read (memo, 0x0010, 0x01);
+  memo_write (memo, 0x0011);
+  memo_read (memo, 0x0011, 0x05); // Reads back its own write
+  memo_write (memo, 0x0010);
+  memo_write (memo, 0x0010);
+
+  // then:
+  ASSERT_EQ (memo->entries[0].readCount, 1);
+  EXPECT_EQ (memo->entries[0].readAddresses[0], 0x0010);
+  EXPECT_EQ (memo->entries[0].readValues[0], 0x01);
+  ASSERT_EQ (memo->entries[0].writeCount, 2);
+  EXPECT_EQ (memo->entries[0].writeAddresses[0], 0x0011);
+  EXPECT_EQ (memo->entries[0].writeAddresses[1], 0x0010);
+}
+
+TEST_F (memoTest, TooManyReadsMakeTheCallUncacheable)
+{
+  // given:
+  memo->record = &memo->entries[0];
+
+  // when:
+  for (Word address = 0; address <= MEMO_MAX_READS; address++)
+    {
+      memo_read (memo, address, 0);
+    }
+  EXPECT_TRUE (memo->overflowed);
+  memo_end (&cpu, memo, 2); // The instruction that overflowed ends
+
+  // then:
+  EXPECT_EQ (memo->entries[0].readCount, MEMO_MAX_READS);
+  EXPECT_EQ (memo->record, nullptr);
+  EXPECT_EQ (memo->entries[0].state, MEMO_UNCACHEABLE);
+  EXPECT_EQ (memo->aborted, 1u);
+}
+
+#ifdef ACE64_MEMO
+TEST_F (memoTest, ReplaysRepeatedCallExactly)
+{
+  // given:
+  LoadCaller ();
+  LoadMultiply ();
+  plain = cpu;
+  memo_attach (&cpu, memo);
+
+  // when:
+  Uint64 cycles = Run (&cpu);
+  Uint64 plainCycles = Run (&plain);
+
+  // then: ROR $12 reads the product the first call left there, so the
+  // second call is recorded again and the third replays it
+  EXPECT_EQ (cpu.Memory[0x12], 91);
+  EXPECT_EQ (cpu.Memory[0x13], 0);
+  EXPECT_EQ (memo->recorded, 2u);
+  EXPECT_EQ (memo->invalidated, 1u);
+  EXPECT_EQ (memo->hits, 1u);
+  EXPECT_GT (memo->cyclesReplayed, 100u);
+  EXPECT_EQ (cycles, plainCycles);
+  ExpectSameState (cpu, plain);
+}
+
+TEST_F (memoTest, PatchedRoutineIsRecordedAgain)
+{
+  // given:
+  LoadCaller ();
+  LoadMultiply ();
+  memo_attach (&cpu, memo);
+  Run (&cpu);
+
+  // when: LDA #$00 becomes LDA #$01
+  cpu.Memory[0x0301] = 0x01;
+  cpu.PC = 0x0200;
+  plain = cpu;
+  plain.memo = NULL;
+  Uint64 cycles = Run (&cpu);
+  Uint64 plainCycles = Run (&plain);
+
+  // then: the patched opcode fails the first call, the new product the
+  // second; the third replays
+  EXPECT_EQ (memo->invalidated, 3u);
+  EXPECT_EQ (memo->recorded, 4u);
+  EXPECT_EQ (memo->hits, 2u);
+  EXPECT_EQ (cycles, plainCycles);
+  ExpectSameState (cpu, plain);
+}
+
+TEST_F (memoTest, LongCallIsNotCached)
+{
+  // given: a routine of about 130K instructions
+  // $0300: LDY #$00
+  // $0302: DEY
+  // $0303: BNE $0302
+  // $0305: DEX
+  // $0306: BNE $0302
+  // $0308: RTS
+  LoadCaller ();
+  Byte routine[] = { INS_LDY_IM, 0x00, INS_DEY, INS_BNE, 0xFD,
+                     INS_DEX,    INS_BNE, 0xFA, INS_RTS };
+  Load (0x0300, routine, sizeof (routine));
+  plain = cpu;
+  memo_attach (&cpu, memo);
+
+  // when:
+  Uint64 cycles = Run (&cpu);
+  Uint64 plainCycles = Run (&plain);
+
+  // then:
+  EXPECT_EQ (memo->aborted, 1u);
+  EXPECT_EQ (memo->recorded, 0u);
+  EXPECT_EQ (memo->hits, 0u);
+  EXPECT_EQ (cycles, plainCycles);
+  ExpectSameState (cpu, plain);
+}
+#endif
+
+#if defined(ACE64_MEMO) && defined(ACE64_LAST_WRITER)
+TEST_F (memoTest, CallsAreNotReplayedForWriters)
+{
+  // given:
+  LoadCaller ();
+  LoadMultiply ();
+  plain = cpu;
+  LastWriters *writers = (LastWriters *)malloc (2 * sizeof (LastWriters));
+  writers_clear (&writers[0]);
+  writers_clear (&writers[1]);
+  writers_attach (&cpu, &writers[0]);
+  writers_attach (&plain, &writers[1]);
+  memo_attach (&cpu, memo);
+
+  // when:
+  Run (&cpu);
+  Run (&plain);
+
+  // then: every write of the call is stamped, and DEC $20 after it too
+  EXPECT_EQ (memo->hits, 0u);
+  EXPECT_EQ (writers[0].cycle, writers[1].cycle);
+  EXPECT_EQ (writers[0].stamps[0x13], writers[1].stamps[0x13]);
+  EXPECT_EQ (writers[0].stamps[0x20], writers[1].stamps[0x20]);
+  free (writers);
+}
+#endif
+
+#if defined(ACE64_MEMO) && defined(ACE64_STATE_HASH)                          \
+    && defined(ACE64_WATCHPOINTS)
+TEST_F (memoTest, CallsAreNotReplayedPastHashesAndWatchpoints)
+{
+  // given: a cache whose entry would replay the next call
+  LoadCaller ();
+  LoadMultiply ();
+  memo_attach (&cpu, memo);
+  Run (&cpu);
+  cpu.PC = 0x0200;
+  Uint64 hits = memo->hits;
+  StateHash hash;
+  statehash_attach (&cpu, &hash);
+  Breakpoints *breakpoints = (Breakpoints *)malloc (sizeof (Breakpoints));
+  breakpoints_init (breakpoints);
+  breakpoints_add (breakpoints, BREAK_WRITE, 0x0013, 0x0013, NULL);
+
+  // when:
+  breakpoints_run (&cpu, breakpoints, 1000, NULL);
+
+  // then: STA $13 in the call hits the watchpoint, and the hash is current
+  EXPECT_TRUE (breakpoints->hit.triggered);
+  EXPECT_EQ (breakpoints->hit.pc, 0x0311);
+  EXPECT_EQ (memo->hits, hits);
+  EXPECT_EQ (statehash_value (&cpu), statehash_compute (&cpu));
+  free (breakpoints);
+}
+#endif
@@ -0,0 +1,153 @@
+#include "../code/cpu.h"
+#include "../code/profile.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+class profileTest : public testing::Test
+{
+public:
+  CPU cpu;
+  OpcodeProfile profile;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    profile_clear (&profile);
+  }
+};
+
+TEST_F (profileTest, AttachSwapsDispatchTableAndDetachRestoresIt)
+{
+  // given:
+  const OpcodeFunction *plain = cpu.dispatch;
+
+  // when:
+  profile_attach (&cpu, &profile);
+  const OpcodeFunction *instrumented = cpu.dispatch;
+  profile_detach (&cpu);
+
+  // then:
+  EXPECT_EQ (plain, opcode_table);
+  EXPECT_NE (instrumented, opcode_table);
+  EXPECT_EQ (cpu.dispatch, opcode_table);
+  EXPECT_EQ (cpu.profile, nullptr);
+}
+
+TEST_F (profileTest, CountsExecutionsCyclesAndHistogram)
+{
+  // given:
+  cpu.PC = 0x0200;
+  cpu.Memory[0x0200] = INS_LDA_IM;
+  cpu.Memory[0x0201] = 0x42;
+  cpu.Memory[0x0202] = INS_INX;
+  cpu.Memory[0x0203] = INS_INX;
+  profile_attach (&cpu, &profile);
+
+  // when:
+  Sint32 cycles = execute (&cpu) + execute (&cpu) + execute (&cpu);
+
+  // then:
+  EXPECT_EQ (cpu.A, 0x42);
+  EXPECT_EQ (cpu.X, 0x02);
+  EXPECT_EQ (profile.opcodes[INS_LDA_IM].executions, 1u);
+  EXPECT_EQ (profile.opcodes[INS_LDA_IM].cycles, 2u);
+  EXPECT_EQ (profile.opcodes[INS_INX].executions, 2u);
+  EXPECT_EQ (profile.opcodes[INS_INX].cycleHistogram[2], 2u);
+  EXPECT_EQ (profile_total_executions (&profile), 3u);
+  EXPECT_EQ (profile_total_cycles (&profile), (Uint64)cycles);
+}
+
+TEST_F (profileTest, InstrumentedTableMatchesPlainTable)
+{
+  // given:
+  CPU *plain = new CPU;
+  reset (plain);
+  cpu.PC = plain->PC = 0x0200;
+  cpu.X = plain->X = 0xFF;
+  cpu.Memory[0x0200] = plain->Memory[0x0200] = INS_LDA_ABX;
+  cpu.Memory[0x0201] = plain->Memory[0x0201] = 0x80;
+  cpu.Memory[0x0202] = plain->Memory[0x0202] = 0x44;
+  cpu.Memory[0x457F] = plain->Memory[0x457F] = 0x37;
+  profile_attach (&cpu, &profile);
+
+  // when:
+  Sint32 profiledCycles = execute (&cpu);
+  Sint32 plainCycles = execute (plain);
+
+  // then:
+  EXPECT_EQ (profiledCycles, plainCycles);
+  EXPECT_EQ (cpu.A, plain->A);
+  EXPECT_EQ (cpu.PC, plain->PC);
+  EXPECT_EQ (profile.opcodes[INS_LDA_ABX].pageCrossings, 1u);
+  EXPECT_EQ (profile.opcodes[INS_LDA_ABX].cycleHistogram[5], 1u);
+  delete plain;
+}
+
+TEST_F (profileTest, CountsTakenBranchesAndBranchPageCrossings)
+{
+  // given:
+  cpu.PC = 0x02F0;
+  cpu.P |= FLAG_ZERO;
+  cpu.Memory[0x02F0] = INS_BEQ;
+  cpu.Memory[0x02F1] = 0x20; // $02F2 + $20 = $0312
+  cpu.Memory[0x0312] = INS_BNE;
+  cpu.Memory[0x0313] = 0x10;
+  profile_attach (&cpu, &profile);
+
+  // when:
+  execute (&cpu);
+  execute (&cpu);
+
+  // then:
+  EXPECT_EQ (cpu.PC, 0x0314);
+  EXPECT_EQ (profile.opcodes[INS_BEQ].branchesTaken, 1u);
+  EXPECT_EQ (profile.opcodes[INS_BEQ].pageCrossings, 1u);
+  EXPECT_EQ (profile.opcodes[INS_BEQ].cycles, 4u);
+  EXPECT_EQ (profile.opcodes[INS_BNE].branchesTaken, 0u);
+  EXPECT_EQ (profile.opcodes[INS_BNE].pageCrossings, 0u);
+}
+
+TEST_F (profileTest, MergeAddsCounters)
+{
+  // given:
+  OpcodeProfile other;
+  profile_clear (&other);
+  profile.opcodes[INS_INX].executions = 3;
+  profile.opcodes[INS_INX].cycleHistogram[2] = 3;
+  other.opcodes[INS_INX].executions = 4;
+  other.opcodes[INS_INX].cycleHistogram[2] = 4;
+  other.opcodes[INS_BEQ].branchesTaken = 1;
+
+  // when:
+  profile_merge (&profile, &other);
+
+  // then:
+  EXPECT_EQ (profile.opcodes[INS_INX].executions, 7u);
+  EXPECT_EQ (profile.opcodes[INS_INX].cycleHistogram[2], 7u);
+  EXPECT_EQ (profile.opcodes[INS_BEQ].branchesTaken, 1u);
+}
+
+TEST_F (profileTest, CsvHasOneRowPerExecutedOpcode)
+{
+  // given:
+  profile.opcodes[INS_INX].executions = 2;
+  profile.opcodes[INS_INX].cycles = 4;
+  profile.opcodes[INS_INX].cycleHistogram[2] = 2;
+  char buffer[512] = { 0 };
+  FILE *file = fmemopen (buffer, sizeof (buffer) - 1, "w");
+
+  // when:
+  bool written = profile_write_csv (&profile, file);
+  fclose (file);
+
+  // then:
+  std::string csv (buffer);
+  EXPECT_TRUE (written);
+  EXPECT_NE (csv.find ("\nE8,INX,imp,2,4,0,0,0,0,2,0,0,0,0,0\n"),
+             std::string::npos);
+  EXPECT_EQ (std::count (csv.begin (), csv.end (), '\n'), 2);
+}
@@ -0,0 +1,176 @@
+#include "../code/batch.h"
+#include "../code/cpu.h"
+#include "../code/resultcache.h"
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+
+class resultcacheTest : public testing::Test
+{
+public:
+  char directory[32];
+  std::string path;
+  char payload[RESULTCACHE_MAX_PAYLOAD];
+
+  virtual void
+  SetUp ()
+  {
+    strcpy (directory, "/tmp/ace64_cacheXXXXXX");
+    ASSERT_NE (mkdtemp (directory), nullptr);
+    path = std::string (directory) + "/results.cache";
+  }
+
+  virtual void
+  TearDown ()
+  {
+    std::string command = std::string ("rm -rf ") + directory;
+    system (command.c_str ());
+  }
+
+  static ResultKey
+  Key (Uint32 n)
+  {
+    ResultKey key;
+    resultcache_key_init (&key);
+    resultcache_key_add (&key, &n, sizeof (n));
+    return key;
+  }
+
+  std::string
+  Lookup (ResultCache *cache, const ResultKey &key)
+  {
+    long length = resultcache_lookup (cache, &key, payload, sizeof (payload));
+    return length < 0 ? "<miss>" : std::string (payload, length);
+  }
+};
+
+TEST_F (resultcacheTest, KeysDependOnEveryByte)
+{
+  // given:
+  Byte image[100] = { 0 };
+  ResultKey first, second, split;
+  resultcache_key_init (&first);
+  resultcache_key_add (&first, image, sizeof (image));
+  image[99] = 1;
+  resultcache_key_init (&second);
+  resultcache_key_add (&second, image, sizeof (image));
+  resultcache_key_init (&split);
+  resultcache_key_add (&split, image, 50);
+  resultcache_key_add (&split, image + 50, 50);
+
+  // then:
+  EXPECT_NE (first.lanes[0], second.lanes[0]);
+  EXPECT_NE (first.lanes[1], second.lanes[1]);
+  EXPECT_NE (second.lanes[0], split.lanes[0]);
+  EXPECT_STRNE (resultcache_build_id (), "");
+}
+
+TEST_F (resultcacheTest, ResultsPersistAcrossOpens)
+{
+  // given:
+  ResultCache *cache = resultcache_open (path.c_str (), 1 << 20);
+  ASSERT_NE (cache, nullptr);
+  ResultKey key = Key (1);
+  EXPECT_EQ (Lookup (cache, key), "<miss>");
+  EXPECT_TRUE (resultcache_store (cache, &key, "brk pc=0207", 11));
+  resultcache_close (cache);
+
+  // when:
+  cache = resultcache_open (path.c_str (), 1 << 20);
+
+  // then:
+  EXPECT_EQ (Lookup (cache, key), "brk pc=0207");
+  EXPECT_EQ (Lookup (cache, Key (2)), "<miss>");
+  resultcache_close (cache);
+
+  // A different capacity starts over.
+  cache = resultcache_open (path.c_str (), 2 << 20);
+  EXPECT_EQ (Lookup (cache, key), "<miss>");
+  resultcache_close (cache);
+}
+
+TEST_F (resultcacheTest, FullSetEvictsLeastRecentlyUsed)
+{
+  // given: one set
+  ResultCache *cache = resultcache_open (path.c_str (), 0);
+  ASSERT_NE (cache, nullptr);
+  for (Uint32 n = 0; n < RESULTCACHE_WAYS; n++)
+    {
+      ResultKey key = Key (n);
+      std::string text = std::to_string (n);
+      resultcache_store (cache, &key, text.data (), text.size ());
+    }
+  EXPECT_EQ (Lookup (cache, Key (0)), "0");
+
+  // when:
+  ResultKey extra = Key (100);
+  resultcache_store (cache, &extra, "100", 3);
+
+  // then: 1 was the least recently used
+  EXPECT_EQ (Lookup (cache, Key (0)), "0");
+  EXPECT_EQ (Lookup (cache, Key (1)), "<miss>");
+  EXPECT_EQ (Lookup (cache, Key (2)), "2");
+  EXPECT_EQ (Lookup (cache, extra), "100");
+  resultcache_close (cache);
+}
+
+TEST_F (resultcacheTest, LongPayloadsAreNotCached)
+{
+  ResultCache *cache = resultcache_open (path.c_str (), 1 << 20);
+  ResultKey key = Key (1);
+  std::string text (RESULTCACHE_MAX_PAYLOAD + 1, 'x');
+  EXPECT_FALSE (resultcache_store (cache, &key, text.data (), text.size ()));
+  EXPECT_EQ (Lookup (cache, key), "<miss>");
+  resultcache_close (cache);
+}
+
+TEST_F (resultcacheTest, RepeatedBatchJobsComeFromTheCache)
+{
+  // given:
+  // $0200: INX
+  // $0201: CPX #$05
+  // $0203: BNE $0200
+  // $0205: BRK
+  Byte program[] = { INS_INX, INS_CPX_IM, 0x05, INS_BNE, 0xFB, INS_BRK };
+  std::string image = std::string (directory) + "/count.bin";
+  FILE *file = fopen (image.c_str (), "wb");
+  fwrite (program, 1, sizeof (program), file);
+  fclose (file);
+  std::string manifest = std::string (directory) + "/jobs.txt";
+  file = fopen (manifest.c_str (), "w");
+  fputs ("id=a image=count.bin\nid=b image=count.bin x=3\n", file);
+  fclose (file);
+  BatchOptions options = { 1, path.c_str (), 1 << 20 };
+
+  // when:
+  BatchStats first, second;
+  FILE *out = tmpfile ();
+  ASSERT_TRUE (batch_run (manifest.c_str (), out, &options, &first));
+  ASSERT_TRUE (batch_run (manifest.c_str (), out, &options, &second));
+
+  // then:
+  EXPECT_EQ (first.cached, 0u);
+  EXPECT_EQ (second.cached, 2u);
+  EXPECT_EQ (second.instructions, 0u);
+
+  rewind (out);
+  char line[256];
+  std::string lines[4];
+  for (int i = 0; i < 4 && fgets (line, sizeof (line), out) != NULL; i++)
+    {
+      lines[i] = line;
+    }
+  fclose (out);
+  EXPECT_EQ (lines[0].find ("a brk pc=0205 a=00 x=05"), 0u) << lines[0];
+  EXPECT_EQ (lines[0].find ("cached"), std::string::npos);
+  EXPECT_EQ (lines[2].substr (0, lines[2].find (" ns=")),
+             lines[0].substr (0, lines[0].find (" ns=")));
+  EXPECT_NE (lines[2].find (" cached\n"), std::string::npos);
+  EXPECT_EQ (lines[3].find ("b brk pc=0205 a=00 x=05 y=00 p=27 sp=FF "
+                            "instructions=6 "),
+             0u)
+      << lines[3];
+}
@@ -0,0 +1,312 @@
+#include "../code/cpu.h"
+#include "../code/run.h"
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+
+#ifdef ACE64_HOSTCALL
+#include "../code/hostcall.h"
+#endif
+#ifdef ACE64_LOOPS
+#include "../code/loops.h"
+#endif
+#ifdef ACE64_MEMO
+#include "../code/memo.h"
+#endif
+
+class runTest : public testing::Test
+{
+public:
+  CPU cpu;
+  RunStops *stops;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    stops = (RunStops *)malloc (sizeof (RunStops));
+    run_stops_init (stops);
+    cpu.PC = 0x0200;
+  }
+
+  virtual void
+  TearDown ()
+  {
+    free (stops);
+  }
+
+  void
+  Load (Word address, const Byte *bytes, unsigned length)
+  {
+    for (unsigned i = 0; i < length; i++)
+      {
+        cpu.Memory[address + i] = bytes[i];
+      }
+  }
+};
+
+TEST_F (runTest, StopsBeforeBrk)
+{
+  // given:
+  // $0200: LDA #$01
+  // $0202: BRK
+  Byte program[] = { INS_LDA_IM, 0x01, INS_BRK };
+  Load (0x0200, program, sizeof (program));
+
+  // when:
+  RunExit result = run_until (&cpu, stops);
+
+  // then:
+  EXPECT_EQ (result.reason, RUN_EXIT_BRK);
+  EXPECT_EQ (result.pc, 0x0202);
+  EXPECT_EQ (result.instructions, 1u);
+  EXPECT_EQ (result.cycles, 2u);
+  EXPECT_STREQ (run_exit_name (result.reason), "brk");
+}
+
+TEST_F (runTest, StopsAtAddressAndContinuesPastIt)
+{
+  // given:
+  // $0200: INX
+  // $0201: INX
+  // $0202: JMP $0202
+  Byte program[] = { INS_INX, INS_INX, INS_JMP_ABS, 0x02, 0x02 };
+  Load (0x0200, program, sizeof (program));
+  ASSERT_TRUE (run_stop_at (stops, 0x0201));
+
+  // when:
+  RunExit first = run_until (&cpu, stops);
+  RunExit second = run_until (&cpu, stops);
+
+  // then:
+  EXPECT_EQ (first.reason, RUN_EXIT_PC);
+  EXPECT_EQ (first.address, 0x0201);
+  EXPECT_EQ (first.instructions, 1u);
+  EXPECT_EQ (second.reason, RUN_EXIT_SELF_LOOP);
+  EXPECT_EQ (second.address, 0x0202);
+  EXPECT_EQ (second.instructions, 2u);
+  EXPECT_EQ (cpu.X, 2);
+}
+
+TEST_F (runTest, BranchToItselfIsASelfLoop)
+{
+  // given:
+  // $0200: BEQ $0200
+  Byte program[] = { INS_BEQ, 0xFE };
+  Load (0x0200, program, sizeof (program));
+  cpu.P |= FLAG_ZERO;
+
+  // when:
+  RunExit result = run_until (&cpu, stops);
+
+  // then:
+  EXPECT_EQ (result.reason, RUN_EXIT_SELF_LOOP);
+  EXPECT_EQ (result.cycles, 3u);
+}
+
+#ifdef ACE64_LOOPS
+TEST_F (runTest, NativeLoopRunsAreNotSelfLoops)
+{
+  // given:
+  // $0200: LDX #$10
+  // $0202: LDA #$00
+  // $0204: STA $0400,X
+  // $0207: DEX
+  // $0208: BNE $0204
+  // $020A: BRK
+  Byte program[] = { INS_LDX_IM,  0x10, INS_LDA_IM, 0x00,    INS_STA_ABX,
+                     0x00,        0x04, INS_DEX,    INS_BNE, 0xFA,
+                     INS_BRK };
+  Load (0x0200, program, sizeof (program));
+  Loops loops = {};
+  loops_attach (&cpu, &loops);
+
+  // when:
+  RunExit result = run_until (&cpu, stops);
+
+  // then: the native run ends at the loop head, and the run goes on
+  EXPECT_EQ (result.reason, RUN_EXIT_BRK);
+  EXPECT_EQ (result.pc, 0x020A);
+  EXPECT_EQ (cpu.X, 0x00);
+  EXPECT_GT (loops.iterations, 0u);
+}
+
+TEST_F (runTest, StopAddressInsideANativeLoopIsReached)
+{
+  // given: the loop above, with a stop at its DEX
+  Byte program[] = { INS_LDX_IM,  0x10, INS_LDA_IM, 0x00,    INS_STA_ABX,
+                     0x00,        0x04, INS_DEX,    INS_BNE, 0xFA,
+                     INS_BRK };
+  Load (0x0200, program, sizeof (program));
+  Loops loops = {};
+  loops_attach (&cpu, &loops);
+  ASSERT_TRUE (run_stop_at (stops, 0x0207));
+
+  // when:
+  RunExit result = run_until (&cpu, stops);
+
+  // then: the loop ran instruction by instruction
+  EXPECT_EQ (result.reason, RUN_EXIT_PC);
+  EXPECT_EQ (result.pc, 0x0207);
+  EXPECT_EQ (result.instructions, 3u);
+  EXPECT_EQ (cpu.X, 0x10);
+  EXPECT_EQ (loops.iterations, 0u);
+  EXPECT_FALSE (cpu.stepping);
+}
+#endif
+
+#ifdef ACE64_MEMO
+TEST_F (runTest, StopAddressInsideACachedCallIsReached)
+{
+  // given: three calls from one site with the same registers
+  // $0200: JSR $0300
+  // $0203: DEC $10
+  // $0205: BNE $0200
+  // $0207: BRK
+  // $0300: NOP
+  // $0301: RTS
+  Byte program[] = { INS_JSR_ABS, 0x00, 0x03, INS_DEC_ZP, 0x10,
+                     INS_BNE,     0xF9, INS_BRK };
+  Byte routine[] = { INS_NOP, INS_RTS };
+  Load (0x0200, program, sizeof (program));
+  Load (0x0300, routine, sizeof (routine));
+  cpu.Memory[0x10] = 3;
+  Memo *memo = (Memo *)malloc (sizeof (Memo));
+  memo_clear (memo);
+  memo_attach (&cpu, memo);
+  ASSERT_TRUE (run_stop_at (stops, 0x0301));
+
+  // when:
+  RunExit first = run_until (&cpu, stops);
+  RunExit second = run_until (&cpu, stops);
+  RunExit third = run_until (&cpu, stops);
+
+  // then: every call stops at its RTS, none is replayed
+  EXPECT_EQ (first.reason, RUN_EXIT_PC);
+  EXPECT_EQ (second.reason, RUN_EXIT_PC);
+  EXPECT_EQ (second.instructions, 5u);
+  EXPECT_EQ (third.reason, RUN_EXIT_PC);
+  EXPECT_EQ (cpu.Memory[0x10], 1);
+  EXPECT_EQ (memo->hits, 0u);
+  free (memo);
+}
+#endif
+
+TEST_F (runTest, LimitsStopTheRun)
+{
+  // given:
+  // $0200: INX
+  // $0201: JMP $0200
+  Byte program[] = { INS_INX, INS_JMP_ABS, 0x00, 0x02 };
+  Load (0x0200, program, sizeof (program));
+  stops->maxInstructions = 10;
+
+  // when:
+  RunExit byInstructions = run_until (&cpu, stops);
+  stops->maxInstructions = 0;
+  stops->maxCycles = 100;
+  RunExit byCycles = run_until (&cpu, stops);
+
+  // then: 2 + 3 cycles per iteration
+  EXPECT_EQ (byInstructions.reason, RUN_EXIT_INSTRUCTIONS);
+  EXPECT_EQ (byInstructions.instructions, 10u);
+  EXPECT_EQ (byCycles.reason, RUN_EXIT_CYCLES);
+  EXPECT_EQ (byCycles.cycles, 100u);
+  EXPECT_EQ (cpu.X, 5 + 20);
+}
+
+TEST_F (runTest, UnimplementedOpcodesStop)
+{
+  // given:
+  Byte program[] = { INS_NOP, 0x03 }; // An unimplemented SLO
+  Load (0x0200, program, sizeof (program));
+
+  // when:
+  RunExit result = run_until (&cpu, stops);
+
+  // then:
+  EXPECT_EQ (result.reason, RUN_EXIT_ILLEGAL);
+  EXPECT_EQ (result.pc, 0x0201);
+  EXPECT_EQ (result.value, 0x03);
+}
+
+TEST_F (runTest, BrkRunsWhenNotAStop)
+{
+  // given: BRK through a vector to a self-loop
+  cpu.Memory[0x0200] = INS_BRK;
+  cpu.Memory[0xFFFE] = 0x00;
+  cpu.Memory[0xFFFF] = 0x30;
+  Byte loop[] = { INS_JMP_ABS, 0x00, 0x30 };
+  Load (0x3000, loop, sizeof (loop));
+  stops->brk = false;
+
+  // when:
+  RunExit result = run_until (&cpu, stops);
+
+  // then:
+  EXPECT_EQ (result.reason, RUN_EXIT_SELF_LOOP);
+  EXPECT_EQ (result.pc, 0x3000);
+}
+
+#ifdef ACE64_WATCHPOINTS
+TEST_F (runTest, SentinelWriteStopsAfterTheStore)
+{
+  // given:
+  // $0200: LDA #$42
+  // $0202: STA $D7FF
+  // $0205: BRK
+  Byte program[] = { INS_LDA_IM, 0x42, INS_STA_ABS, 0xFF, 0xD7, INS_BRK };
+  Load (0x0200, program, sizeof (program));
+  ASSERT_TRUE (run_stop_on_write (stops, 0xD7FF));
+
+  // when:
+  RunExit result = run_until (&cpu, stops);
+
+  // then:
+  EXPECT_EQ (result.reason, RUN_EXIT_WRITE);
+  EXPECT_EQ (result.address, 0xD7FF);
+  EXPECT_EQ (result.value, 0x42);
+  EXPECT_EQ (result.pc, 0x0205);
+}
+#else
+TEST_F (runTest, SentinelWritesNeedWatchpoints)
+{
+  EXPECT_FALSE (run_stop_on_write (stops, 0xD7FF));
+}
+#endif
+
+#ifdef ACE64_HOSTCALL
+TEST_F (runTest, HostExitStopsWithItsStatus)
+{
+  // given:
+  // $0200: LDA #$05 (EXIT)
+  // $0202: LDX #$10
+  // $0204: LDY #$03
+  // $0206: .byte $FF
+  Byte program[] = { INS_LDA_IM, HOSTCALL_EXIT, INS_LDX_IM, 0x10,
+                     INS_LDY_IM, 0x03,          0xFF };
+  Load (0x0200, program, sizeof (program));
+  cpu.Memory[0x0310] = 7;
+  HostCalls *calls = hostcall_create (HOSTCALL_DEFAULT_OPCODE, false);
+  hostcall_install_standard (calls, NULL);
+  hostcall_attach (&cpu, calls);
+
+  // when:
+  RunExit result = run_until (&cpu, stops);
+
+  // then:
+  EXPECT_EQ (result.reason, RUN_EXIT_HOST);
+  EXPECT_EQ (result.value, 7);
+  EXPECT_EQ (result.pc, 0x0206);
+
+  // when: continued, the program stays halted
+  result = run_until (&cpu, stops);
+
+  // then:
+  EXPECT_EQ (result.reason, RUN_EXIT_HOST);
+  EXPECT_EQ (result.pc, 0x0206);
+  EXPECT_EQ (result.instructions, 1u);
+  EXPECT_EQ (calls->calls, 1u);
+  hostcall_destroy (calls);
+}
+#endif
@@ -0,0 +1,148 @@
+#include "../code/cpu.h"
+#include "../code/statehash.h"
+#include <gtest/gtest.h>
+
+class statehashTest : public testing::Test
+{
+public:
+  CPU cpu;
+  StateHash hash;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+  }
+
+  void
+  Load (const Byte *program, unsigned length)
+  {
+    for (unsigned i = 0; i < length; i++)
+      {
+        cpu.Memory[0x0200 + i] = program[i];
+      }
+    cpu.PC = 0x0200;
+  }
+};
+
+TEST_F (statehashTest, HashFollowsMemoryAndRegisters)
+{
+  // given:
+  Uint64 initial = statehash_compute (&cpu);
+
+  // when:
+  cpu.Memory[0x1234] = 0x56;
+  Uint64 written = statehash_compute (&cpu);
+  cpu.Memory[0x1234] = 0x00;
+  Uint64 restored = statehash_compute (&cpu);
+  cpu.A = 0x01;
+  Uint64 accumulator = statehash_compute (&cpu);
+  cpu.A = 0x00;
+  cpu.X = 0x01;
+  Uint64 index = statehash_compute (&cpu);
+
+  // then:
+  EXPECT_NE (written, initial);
+  EXPECT_EQ (restored, initial);
+  EXPECT_NE (accumulator, initial);
+  EXPECT_NE (index, initial);
+  EXPECT_NE (index, accumulator); // Same value, different register
+}
+
+TEST_F (statehashTest, PokeKeepsValueCurrent)
+{
+  // when:
+  statehash_poke (&cpu, 0x0400, 0xAA);
+  statehash_poke (&cpu, 0xFFFF, 0x01);
+
+  // then:
+  EXPECT_EQ (cpu.Memory[0x0400], 0xAA);
+  EXPECT_EQ (statehash_value (&cpu), statehash_compute (&cpu));
+}
+
+TEST_F (statehashTest, StateSetRejectsDuplicatesAndGrows)
+{
+  // given:
+  StateSet set;
+  ASSERT_TRUE (stateset_init (&set, 4));
+
+  // when:
+  int added = 0;
+  for (Uint64 i = 0; i < 1000; i++)
+    {
+      added += stateset_insert (&set, statehash_mix (i));
+      added += stateset_insert (&set, statehash_mix (i));
+    }
+  int zeroFirst = stateset_insert (&set, 0);
+  int zeroAgain = stateset_insert (&set, 0);
+
+  // then:
+  EXPECT_EQ (added, 1000);
+  EXPECT_EQ (set.count, 1000u);
+  EXPECT_EQ (zeroFirst, 1);
+  EXPECT_EQ (zeroAgain, 0);
+  EXPECT_TRUE (stateset_contains (&set, statehash_mix (999)));
+  EXPECT_TRUE (stateset_contains (&set, 0));
+  EXPECT_FALSE (stateset_contains (&set, statehash_mix (1000)));
+  stateset_free (&set);
+}
+
+TEST_F (statehashTest, RevisitedStateDetectsInfiniteLoop)
+{
+  // given:
+  // $0200: LDX #$03
+  // $0202: DEX
+  // $0203: BNE $0202
+  // $0205: LDA #$00
+  // $0207: BEQ $0205
+  Byte program[] = { INS_LDX_IM, 0x03, INS_DEX,    INS_BNE, 0xFD,
+                     INS_LDA_IM, 0x00, INS_BEQ, 0xFC };
+  Load (program, sizeof (program));
+  StateSet visited;
+  ASSERT_TRUE (stateset_init (&visited, 64));
+
+  // when:
+  int steps = 0;
+  while (stateset_insert (&visited, statehash_value (&cpu)) == 1
+         && steps < 100)
+    {
+      execute (&cpu);
+      steps++;
+    }
+
+  // then: LDX, 3 x (DEX, BNE), LDA, BEQ: back at the LDA with A, X and the
+  // flags as the final BNE left them
+  EXPECT_EQ (steps, 9);
+  EXPECT_EQ (cpu.PC, 0x0205);
+  stateset_free (&visited);
+}
+
+#ifdef ACE64_STATE_HASH
+TEST_F (statehashTest, IncrementalHashMatchesRecomputation)
+{
+  // given:
+  // $0200: LDA #$42
+  // $0202: STA $10
+  // $0204: INC $10
+  // $0206: JSR $0300
+  // $0300: PHA
+  Byte program[] = { INS_LDA_IM, 0x42, INS_STA_ZP, 0x10, INS_INC_ZP,
+                     0x10,       INS_JSR_ABS, 0x00, 0x03 };
+  Load (program, sizeof (program));
+  cpu.Memory[0x0300] = INS_PHA;
+  statehash_attach (&cpu, &hash);
+
+  // when:
+  Uint64 before = statehash_value (&cpu);
+  for (int i = 0; i < 5; i++)
+    {
+      execute (&cpu);
+    }
+
+  // then:
+  EXPECT_NE (statehash_value (&cpu), before);
+  EXPECT_EQ (statehash_value (&cpu), statehash_compute (&cpu));
+  EXPECT_EQ (hash.memory ^ statehash_registers (&cpu),
+             statehash_compute (&cpu));
+}
+#endif
@@ -0,0 +1,90 @@
+#include "../code/cpu.h"
+#include "../code/support.h"
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+class supportTest : public testing::Test
+{
+public:
+  CPU cpu;
+  char path[32];
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    strcpy (path, "/tmp/ace64_supportXXXXXX");
+    int fd = mkstemp (path);
+    ASSERT_GE (fd, 0);
+    close (fd);
+  }
+
+  virtual void
+  TearDown ()
+  {
+    unlink (path);
+  }
+
+  void
+  Write (const Byte *bytes, size_t length)
+  {
+    FILE *file = fopen (path, "wb");
+    ASSERT_NE (file, nullptr);
+    fwrite (bytes, 1, length, file);
+    fclose (file);
+  }
+};
+
+TEST_F (supportTest, ParsesHexAddresses)
+{
+  Word address = 0;
+  EXPECT_TRUE (support_parse_address ("$C000", &address));
+  EXPECT_EQ (address, 0xC000);
+  EXPECT_TRUE (support_parse_address ("ffff", &address));
+  EXPECT_EQ (address, 0xFFFF);
+  EXPECT_FALSE (support_parse_address ("10000", &address));
+  EXPECT_FALSE (support_parse_address ("$", &address));
+  EXPECT_FALSE (support_parse_address ("12G4", &address));
+  EXPECT_EQ (address, 0xFFFF);
+}
+
+TEST_F (supportTest, LoadsRawAndPrgImages)
+{
+  // given:
+  Byte image[] = { 0x01, 0x08, INS_LDA_IM, 0x2A };
+  Write (image, sizeof (image));
+
+  // when:
+  long raw = support_load_image (&cpu, path, 0x0200, false);
+  long prg = support_load_image (&cpu, path, 0x0200, true);
+
+  // then: a PRG loads after its two address bytes, at their address
+  EXPECT_EQ (raw, 0x0200);
+  EXPECT_EQ (cpu.Memory[0x0200], 0x01);
+  EXPECT_EQ (cpu.Memory[0x0203], 0x2A);
+  EXPECT_EQ (prg, 0x0801);
+  EXPECT_EQ (cpu.Memory[0x0801], INS_LDA_IM);
+  EXPECT_EQ (cpu.Memory[0x0802], 0x2A);
+}
+
+TEST_F (supportTest, EmptyAndMissingImagesFail)
+{
+  // given:
+  Write (NULL, 0);
+
+  // then:
+  EXPECT_EQ (support_load_image (&cpu, path, 0x0200, false), -1);
+  EXPECT_EQ (support_load_image (&cpu, path, 0x0200, true), -1);
+  EXPECT_EQ (support_load_image (&cpu, "/nonexistent/image", 0, false), -1);
+}
+
+TEST_F (supportTest, ThreadCountDefaultsToTheProcessors)
+{
+  EXPECT_EQ (support_thread_count (3), 3);
+  EXPECT_GE (support_thread_count (0), 1);
+  EXPECT_EQ (support_thread_count (-1), support_thread_count (0));
+}
@@ -0,0 +1,144 @@
+#include "../code/cpu.h"
+#include "../code/taint.h"
+#include <gtest/gtest.h>
+
+class taintTest : public testing::Test
+{
+public:
+  CPU cpu;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    cpu.PC = 0x0200;
+  }
+
+  void
+  Run (std::initializer_list<Byte> program)
+  {
+    Word address = 0x0200;
+    for (Byte byte : program)
+      {
+        cpu.Memory[address++] = byte;
+      }
+    while (cpu.PC < address)
+      {
+        execute (&cpu);
+      }
+  }
+};
+
+TEST_F (taintTest, LoadAndStoreCopyTags)
+{
+  // given:
+  taint_mark (&cpu, 0x0010, 0x0010, 0x01);
+
+  // when:
+  Run ({ INS_LDA_ZP, 0x10, INS_STA_ABS, 0x00, 0x30 });
+
+  // then:
+  EXPECT_EQ (cpu.taint.a, 0x01);
+  EXPECT_EQ (cpu.taint.memory[0x3000], 0x01);
+  EXPECT_EQ (cpu.taint.p, 0x01);
+}
+
+TEST_F (taintTest, ImmediateLoadClearsTags)
+{
+  // given:
+  taint_mark (&cpu, 0x0010, 0x0010, 0x01);
+
+  // when:
+  Run ({ INS_LDA_ZP, 0x10, INS_LDA_IM, 0x05, INS_STA_ZP, 0x10 });
+
+  // then:
+  EXPECT_EQ (cpu.taint.a, 0x00);
+  EXPECT_EQ (cpu.taint.memory[0x0010], 0x00);
+}
+
+TEST_F (taintTest, AdcMergesOperandAndCarryTags)
+{
+  // given:
+  taint_mark (&cpu, 0x0010, 0x0010, 0x01);
+  taint_mark (&cpu, 0x0011, 0x0011, 0x02);
+  taint_mark (&cpu, 0x0012, 0x0012, 0x04);
+
+  // when:
+  Run ({ INS_LDA_ZP, 0x12,  // P picks up 0x04
+         INS_LDA_ZP, 0x10,  // A = 0x01, P = 0x01
+         INS_ADC_ZP, 0x11,  // A = P = 0x01 | 0x02 | 0x01
+         INS_TAX, INS_LDA_IM, 0x00 });
+
+  // then:
+  EXPECT_EQ (cpu.taint.x, 0x03);
+  EXPECT_EQ (cpu.taint.a, 0x00);
+}
+
+TEST_F (taintTest, ReadModifyWriteKeepsMemoryTags)
+{
+  // given:
+  taint_mark (&cpu, 0x0020, 0x0021, 0x08);
+
+  // when:
+  Run ({ INS_INC_ZP, 0x20, INS_ASL_ZP, 0x21 });
+
+  // then:
+  EXPECT_EQ (taint_range (&cpu, 0x0020, 0x0021), 0x08);
+  EXPECT_EQ (cpu.taint.a, 0x00);
+}
+
+TEST_F (taintTest, StackCarriesTags)
+{
+  // given:
+  taint_mark (&cpu, 0x0010, 0x0010, 0x10);
+
+  // when:
+  Run ({ INS_LDA_ZP, 0x10, INS_PHA, INS_LDA_IM, 0x00, INS_PLA });
+
+  // then:
+  EXPECT_EQ (cpu.taint.a, 0x10);
+}
+
+TEST_F (taintTest, InputSourceTagsEveryRead)
+{
+  // given:
+  taint_add_source (&cpu, 0xDC01, 0xDC01, 0x20);
+
+  // when:
+  Run ({ INS_LDA_IM, 0x00, INS_LDY_ABS, 0x01, 0xDC, INS_LDA_IM, 0x00 });
+
+  // then:
+  EXPECT_EQ (cpu.taint.y, 0x20);
+  EXPECT_EQ (cpu.taint.memory[0xDC01], 0x00);
+}
+
+TEST_F (taintTest, TaintedReturnAddressIsFlagged)
+{
+  // given:
+  taint_mark (&cpu, 0x0010, 0x0011, 0x40);
+  cpu.Memory[0x0010] = 0x02;
+  cpu.Memory[0x0011] = 0x03;
+
+  // when:
+  Run ({ INS_LDA_ZP, 0x11, INS_PHA, INS_LDA_ZP, 0x10, INS_PHA, INS_RTS });
+
+  // then:
+  EXPECT_EQ (cpu.PC, 0x0303);
+  EXPECT_EQ (cpu.taint.pc, 0x40);
+}
+
+TEST_F (taintTest, ResetClearsTagsAndSources)
+{
+  // given:
+  taint_mark (&cpu, 0x0000, 0xFFFF, 0xFF);
+  taint_add_source (&cpu, 0x0000, 0xFFFF, 0xFF);
+
+  // when:
+  reset (&cpu);
+  cpu.PC = 0x0200;
+  Run ({ INS_LDA_ZP, 0x10 });
+
+  // then:
+  EXPECT_EQ (taint_range (&cpu, 0x0000, 0xFFFF), 0x00);
+  EXPECT_EQ (cpu.taint.a, 0x00);
+}
@@ -0,0 +1,222 @@
+#include "../code/cpu.h"
+#include "../code/opinfo.h"
+#include "../code/trace.h"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+class traceTest : public testing::Test
+{
+public:
+  CPU cpu;
+  Trace *trace;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    trace = trace_create (8);
+  }
+  virtual void
+  TearDown ()
+  {
+    trace_destroy (trace);
+  }
+
+  // INX / JMP $0200, forever.
+  void
+  LoadLoop ()
+  {
+    cpu.PC = 0x0200;
+    cpu.Memory[0x0200] = INS_INX;
+    cpu.Memory[0x0201] = INS_JMP_ABS;
+    cpu.Memory[0x0202] = 0x00;
+    cpu.Memory[0x0203] = 0x02;
+  }
+};
+
+TEST_F (traceTest, RecordIsSixteenBytes)
+{
+  EXPECT_EQ (sizeof (TraceRecord), 16u);
+}
+
+TEST_F (traceTest, CapacityRoundsUpToPowerOfTwo)
+{
+  Trace *odd = trace_create (1000);
+  EXPECT_EQ (trace_capacity (odd), 1024u);
+  trace_destroy (odd);
+}
+
+TEST_F (traceTest, RecordsStateBeforeEachInstruction)
+{
+  // given:
+  cpu.PC = 0x0200;
+  cpu.X = 0x41;
+  cpu.Memory[0x0200] = INS_LDX_IM;
+  cpu.Memory[0x0201] = 0x10;
+  cpu.Memory[0x0202] = INS_INX;
+  trace_attach (&cpu, trace);
+
+  // when:
+  Sint32 first = execute (&cpu);
+  execute (&cpu);
+
+  // then:
+  TraceRecord records[8];
+  Uint64 sequence;
+  ASSERT_EQ (trace_snapshot (trace, records, 8, &sequence), 2u);
+  EXPECT_EQ (sequence, 0u);
+  EXPECT_EQ (records[0].pc, 0x0200);
+  EXPECT_EQ (records[0].opcode, INS_LDX_IM);
+  EXPECT_EQ (records[0].operands[0], 0x10);
+  EXPECT_EQ (records[0].x, 0x41);
+  EXPECT_EQ (records[0].cycle, 0u);
+  EXPECT_EQ (records[0].cycles, first);
+  EXPECT_EQ (records[1].pc, 0x0202);
+  EXPECT_EQ (records[1].x, 0x10);
+  EXPECT_EQ (records[1].cycle, (Uint32)first);
+}
+
+TEST_F (traceTest, DisarmedCpuRecordsNothing)
+{
+  // given:
+  LoadLoop ();
+  trace_attach (&cpu, trace);
+  trace_attach (&cpu, NULL);
+
+  // when:
+  execute (&cpu);
+
+  // then:
+  EXPECT_EQ (trace_count (trace), 0u);
+}
+
+TEST_F (traceTest, RingKeepsNewestRecordsInOrder)
+{
+  // given:
+  LoadLoop ();
+  trace_attach (&cpu, trace);
+
+  // when:
+  for (int i = 0; i < 21; i++)
+    {
+      execute (&cpu);
+    }
+
+  // then:
+  TraceRecord records[8];
+  Uint64 sequence;
+  EXPECT_EQ (trace_count (trace), 21u);
+  ASSERT_EQ (trace_snapshot (trace, records, 8, &sequence), 8u);
+  EXPECT_EQ (sequence, 13u);
+  for (int i = 1; i < 8; i++)
+    {
+      EXPECT_EQ (records[i].cycle,
+                 records[i - 1].cycle + records[i - 1].cycles);
+    }
+  EXPECT_EQ (records[7].pc, 0x0200); // 21st instruction is the INX
+}
+
+TEST_F (traceTest, DumpRoundTrips)
+{
+  // given:
+  LoadLoop ();
+  trace_attach (&cpu, trace);
+  for (int i = 0; i < 11; i++)
+    {
+      execute (&cpu);
+    }
+  FILE *file = tmpfile ();
+
+  // when:
+  bool written = trace_write (trace, 5, file);
+  rewind (file);
+  TraceRecord *loaded;
+  Uint32 count;
+  Uint64 sequence;
+  bool read = trace_read (file, &loaded, &count, &sequence);
+  fclose (file);
+
+  // then:
+  TraceRecord expected[5];
+  Uint64 expectedSequence;
+  trace_snapshot (trace, expected, 5, &expectedSequence);
+  ASSERT_TRUE (written);
+  ASSERT_TRUE (read);
+  EXPECT_EQ (count, 5u);
+  EXPECT_EQ (sequence, expectedSequence);
+  EXPECT_EQ (memcmp (loaded, expected, sizeof (expected)), 0);
+  free (loaded);
+}
+
+TEST_F (traceTest, SnapshotsWhileRunningAreNeverTorn)
+{
+  // given:
+  Trace *ring = trace_create (256);
+  LoadLoop ();
+  trace_attach (&cpu, ring);
+  std::atomic<bool> done (false);
+  int torn = 0;
+
+  // when:
+  std::thread reader ([&] () {
+    std::vector<TraceRecord> records (256);
+    while (!done.load ())
+      {
+        Uint64 sequence;
+        Uint32 count = trace_snapshot (ring, records.data (), 256, &sequence);
+        for (Uint32 i = 1; i < count; i++)
+          {
+            const TraceRecord &prev = records[i - 1];
+            const TraceRecord &next = records[i];
+            bool chained = next.cycle == prev.cycle + prev.cycles
+                           && next.pc == (prev.pc == 0x0200 ? 0x0201 : 0x0200);
+            torn += !chained;
+          }
+      }
+  });
+  for (int i = 0; i < 2000000; i++)
+    {
+      execute (&cpu);
+    }
+  done.store (true);
+  reader.join ();
+
+  // then:
+  EXPECT_EQ (torn, 0);
+  trace_destroy (ring);
+}
+
+TEST_F (traceTest, DisassemblesEveryAddressingMode)
+{
+  struct
+  {
+    Byte bytes[3];
+    Word pc;
+    const char *text;
+  } cases[] = {
+    { { 0xEA, 0, 0 }, 0x0200, "NOP" },
+    { { 0x0A, 0, 0 }, 0x0200, "ASL A" },
+    { { 0xA9, 0x42, 0 }, 0x0200, "LDA #$42" },
+    { { 0xB6, 0x10, 0 }, 0x0200, "LDX $10,Y" },
+    { { 0xBD, 0x34, 0x12 }, 0x0200, "LDA $1234,X" },
+    { { 0x6C, 0xFC, 0xFF }, 0x0200, "JMP ($FFFC)" },
+    { { 0xA1, 0x20, 0 }, 0x0200, "LDA ($20,X)" },
+    { { 0xB1, 0x20, 0 }, 0x0200, "LDA ($20),Y" },
+    { { 0xD0, 0xFE, 0 }, 0x0300, "BNE $0300" },
+  };
+
+  for (const auto &c : cases)
+    {
+      char text[32];
+      Byte length = disassemble (c.bytes, c.pc, text, sizeof (text));
+      EXPECT_STREQ (text, c.text);
+      EXPECT_EQ (length,
+                 addressing_mode_length (opcode_info[c.bytes[0]].mode));
+    }
+}
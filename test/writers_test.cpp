@@ -0,0 +1,94 @@
+#include "../code/cpu.h"
+#include "../code/writers.h"
+#include <gtest/gtest.h>
+
+class writersTest : public testing::Test
+{
+public:
+  CPU cpu;
+  LastWriters writers;
+
+  virtual void
+  SetUp ()
+  {
+    reset (&cpu);
+    writers_clear (&writers);
+  }
+};
+
+TEST_F (writersTest, UnwrittenAddressHasNoWriter)
+{
+  Word pc;
+  Uint64 cycle;
+  EXPECT_FALSE (writers_query (&writers, 0x1234, &pc, &cycle));
+}
+
+TEST_F (writersTest, StampRoundTripsPcAndCycle)
+{
+  // given:
+  writers.stamps[0x0010] = writers_stamp (0, 0x0000);
+  writers.stamps[0x0011] = writers_stamp (123456789012ULL, 0xFFFE);
+
+  // then:
+  Word pc;
+  Uint64 cycle;
+  ASSERT_TRUE (writers_query (&writers, 0x0010, &pc, &cycle));
+  EXPECT_EQ (pc, 0x0000);
+  EXPECT_EQ (cycle, 0u);
+  ASSERT_TRUE (writers_query (&writers, 0x0011, &pc, &cycle));
+  EXPECT_EQ (pc, 0xFFFE);
+  EXPECT_EQ (cycle, 123456789012ULL);
+}
+
+#ifdef ACE64_LAST_WRITER
+TEST_F (writersTest, RecordsLastWritingInstruction)
+{
+  // given:
+  // $0200: LDA #$01   (2 cycles)
+  // $0202: STA $10    (3 cycles)
+  // $0204: INC $10    (5 cycles)
+  // $0206: JSR $0300  (6 cycles, pushes the return address)
+  Byte program[] = { INS_LDA_IM, 0x01, INS_STA_ZP, 0x10, INS_INC_ZP,
+                     0x10,       INS_JSR_ABS, 0x00, 0x03 };
+  for (unsigned i = 0; i < sizeof (program); i++)
+    {
+      cpu.Memory[0x0200 + i] = program[i];
+    }
+  cpu.PC = 0x0200;
+  writers_attach (&cpu, &writers);
+
+  // when:
+  for (int i = 0; i < 4; i++)
+    {
+      execute (&cpu);
+    }
+
+  // then:
+  Word pc;
+  Uint64 cycle;
+  ASSERT_TRUE (writers_query (&writers, 0x0010, &pc, &cycle));
+  EXPECT_EQ (pc, 0x0204);
+  EXPECT_EQ (cycle, 5u);
+  ASSERT_TRUE (writers_query (&writers, 0x0100 + (Byte)(cpu.SP + 1), &pc,
+                              &cycle));
+  EXPECT_EQ (pc, 0x0206);
+  EXPECT_EQ (cycle, 10u);
+  EXPECT_FALSE (writers_query (&writers, 0x0011, &pc, &cycle));
+}
+
+TEST_F (writersTest, DetachedCpuDoesNotRecord)
+{
+  // given:
+  cpu.PC = 0x0200;
+  cpu.Memory[0x0200] = INS_STA_ZP;
+  cpu.Memory[0x0201] = 0x10;
+  writers_attach (&cpu, &writers);
+  writers_attach (&cpu, NULL);
+
+  // when:
+  execute (&cpu);
+
+  // then:
+  EXPECT_FALSE (writers_query (&writers, 0x0010, NULL, NULL));
+}
+#endif